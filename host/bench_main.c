@@ -0,0 +1,16 @@
+/**
+ * @file bench_main.c
+ * @brief Host entry point for the Unity benchmarks in test/
+ *
+ * The benchmarks are written for the ESP-IDF unit test app and run their
+ * tests from app_main(); the exit status reports whether any test failed.
+ */
+
+#include "unity.h"
+
+void app_main(void);
+
+int main(void) {
+    app_main();
+    return Unity.TestFailures != 0;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file font_pack.cpp
+ * @brief Packs the generated UI fonts into a bundle for the storage partition
+ *
+ * Links the same font set as the firmware for one layout and writes the tables
+ * of every font into the format described in font_bundle_format.h. Fonts are
+ * stored under their 800x480 names (ui_font_Font16, ...) for both layouts, the
+ * names the firmware looks them up by.
+ *
+ *   host/build/font_pack_s3 fonts_s3.bin
+ *   parttool.py write_partition --partition-name storage --input fonts_s3.bin
+ */
+
+#include "font_bundle_format.h"
+#include "ui_scale.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#if CONFIG_IDF_TARGET_ESP32P4
+#define PACK_LAYOUT_NAME "p4"
+#else
+#define PACK_LAYOUT_NAME "s3"
+#endif
+
+static const struct {
+    const char *name;
+    const lv_font_t *(*get)(void);
+} s_fonts[] = {
+    {"ui_font_Font16", ui_font16},
+    {"ui_font_Font18", ui_font18},
+    {"ui_font_Font30", ui_font30},
+    {"ui_font_Font48", ui_font48},
+    {"ui_font_Frequency", ui_frequency_font},
+    {"ui_font_FrequencyFont", ui_freq_font},
+    {"ui_font_FrequencyFontSmall", ui_freq_small_font},
+    {"ui_font_ButtonFont", ui_btn_font},
+    {"ui_font_ButtonFontLargeBold", ui_btn_large_bold_font},
+    {"ui_font_ButtonFontSmallMedium", ui_btn_small_med_font},
+    {"ui_font_ButtonSmallRegular", ui_btn_small_reg_font},
+    {"ui_font_MeterFont", ui_meter_font},
+    {"ui_font_UTCTime", ui_utc_font},
+    {"ui_font_Glyphs24", ui_glyph24_font},
+    {"ui_font_Glyphs30", ui_glyph30_font},
+    {"ui_font_Glyphs58", ui_glyph58_font},
+    {"ui_font_Glyphs70", ui_glyph70_font},
+};
+
+#define FONT_COUNT (sizeof(s_fonts) / sizeof(s_fonts[0]))
+
+static std::vector<uint8_t> s_bundle;
+
+// Appends a table on the bundle alignment and returns its offset
+static uint32_t append(const void *data, size_t size) {
+    while (s_bundle.size() % FONT_BUNDLE_ALIGN) s_bundle.push_back(0);
+    uint32_t off = (uint32_t)s_bundle.size();
+    const uint8_t *bytes = (const uint8_t *)data;
+    s_bundle.insert(s_bundle.end(), bytes, bytes + size);
+    return off;
+}
+
+// Highest glyph id a character map can produce, plus one
+static uint32_t cmap_glyph_end(const lv_font_fmt_txt_cmap_t *cmap) {
+    uint32_t count = 0;
+    switch (cmap->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            count = cmap->range_length;
+            break;
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+            count = cmap->list_length;
+            break;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+            const uint8_t *ofs = (const uint8_t *)cmap->glyph_id_ofs_list;
+            for (uint32_t i = 0; i < cmap->range_length; i++) {
+                if (ofs[i] + 1u > count) count = ofs[i] + 1u;
+            }
+            break;
+        }
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+            const uint16_t *ofs = (const uint16_t *)cmap->glyph_id_ofs_list;
+            for (uint32_t i = 0; i < cmap->list_length; i++) {
+                if (ofs[i] + 1u > count) count = ofs[i] + 1u;
+            }
+            break;
+        }
+    }
+    return cmap->glyph_id_start + count;
+}
+
+static bool pack_font(const char *name, const lv_font_t *font, uint32_t *font_off) {
+    const lv_font_fmt_txt_dsc_t *dsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    if (dsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN || dsc->stride != 0 || dsc->kern_classes != 0) {
+        fprintf(stderr, "%s: only uncompressed, unaligned fonts with kerning pairs can be packed\n", name);
+        return false;
+    }
+
+    font_bundle_font_t rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.line_height = font->line_height;
+    rec.base_line = font->base_line;
+    rec.underline_position = font->underline_position;
+    rec.underline_thickness = font->underline_thickness;
+    rec.subpx = font->subpx;
+    rec.bpp = dsc->bpp;
+    rec.bitmap_format = dsc->bitmap_format;
+    rec.stride = dsc->stride;
+    rec.kern_scale = dsc->kern_scale;
+    rec.cmap_num = dsc->cmap_num;
+
+    // Glyph descriptors: id 0 is reserved, the cmaps give the highest id
+    for (uint32_t i = 0; i < dsc->cmap_num; i++) {
+        uint32_t end = cmap_glyph_end(&dsc->cmaps[i]);
+        if (end > rec.glyph_count) rec.glyph_count = end;
+    }
+    rec.glyph_dsc_off = append(dsc->glyph_dsc, rec.glyph_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
+
+    // Bitmaps end with the glyph stored last
+    for (uint32_t id = 0; id < rec.glyph_count; id++) {
+        const lv_font_fmt_txt_glyph_dsc_t *g = &dsc->glyph_dsc[id];
+        uint32_t end = g->bitmap_index + ((uint32_t)g->box_w * g->box_h * dsc->bpp + 7) / 8;
+        if (end > rec.bitmap_size) rec.bitmap_size = end;
+    }
+    rec.bitmap_off = append(dsc->glyph_bitmap, rec.bitmap_size);
+
+    std::vector<font_bundle_cmap_t> cmaps(dsc->cmap_num);
+    for (uint32_t i = 0; i < dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *src = &dsc->cmaps[i];
+        font_bundle_cmap_t *dst = &cmaps[i];
+        memset(dst, 0, sizeof(*dst));
+        dst->range_start = src->range_start;
+        dst->range_length = src->range_length;
+        dst->glyph_id_start = src->glyph_id_start;
+        dst->list_length = src->list_length;
+        dst->type = src->type;
+        if (src->unicode_list != NULL) {
+            dst->unicode_list_off = append(src->unicode_list, src->list_length * sizeof(uint16_t));
+        }
+        if (src->glyph_id_ofs_list != NULL) {
+            size_t size = src->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL ? src->range_length
+                                                                        : src->list_length * sizeof(uint16_t);
+            dst->glyph_id_ofs_list_off = append(src->glyph_id_ofs_list, size);
+        }
+    }
+    rec.cmaps_off = append(cmaps.data(), cmaps.size() * sizeof(font_bundle_cmap_t));
+
+    if (dsc->kern_dsc != NULL) {
+        const lv_font_fmt_txt_kern_pair_t *kern = (const lv_font_fmt_txt_kern_pair_t *)dsc->kern_dsc;
+        size_t id_size = kern->glyph_ids_size == 0 ? sizeof(uint8_t) : sizeof(uint16_t);
+        rec.kern_pair_cnt = kern->pair_cnt;
+        rec.kern_glyph_ids_size = kern->glyph_ids_size;
+        rec.kern_glyph_ids_off = append(kern->glyph_ids, kern->pair_cnt * 2 * id_size);
+        rec.kern_values_off = append(kern->values, kern->pair_cnt);
+    }
+
+    *font_off = append(&rec, sizeof(rec));
+    printf("  %-32s %6lu glyphs %8lu bytes\n", name, (unsigned long)rec.glyph_count, (unsigned long)rec.bitmap_size);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <output.bin>\n", argv[0]);
+        return 2;
+    }
+
+    font_bundle_header_t header;
+    memset(&header, 0, sizeof(header));
+    std::vector<font_bundle_entry_t> dir(FONT_COUNT);
+    append(&header, sizeof(header));
+    uint32_t dir_off = append(dir.data(), dir.size() * sizeof(font_bundle_entry_t));
+
+    printf("Packing %u fonts (%s layout)\n", (unsigned)FONT_COUNT, PACK_LAYOUT_NAME);
+    for (size_t i = 0; i < FONT_COUNT; i++) {
+        memset(&dir[i], 0, sizeof(dir[i]));
+        strncpy(dir[i].name, s_fonts[i].name, FONT_BUNDLE_NAME_LEN - 1);
+        if (!pack_font(s_fonts[i].name, s_fonts[i].get(), &dir[i].font_off)) {
+            return 1;
+        }
+    }
+
+    header.magic = FONT_BUNDLE_MAGIC;
+    header.version = FONT_BUNDLE_VERSION;
+    header.font_count = (uint16_t)FONT_COUNT;
+    header.total_size = (uint32_t)s_bundle.size();
+    header.glyph_dsc_size = sizeof(lv_font_fmt_txt_glyph_dsc_t);
+    memcpy(&s_bundle[0], &header, sizeof(header));
+    memcpy(&s_bundle[dir_off], dir.data(), dir.size() * sizeof(font_bundle_entry_t));
+
+    FILE *f = fopen(argv[1], "wb");
+    if (f == NULL || fwrite(s_bundle.data(), 1, s_bundle.size(), f) != s_bundle.size()) {
+        fprintf(stderr, "Cannot write %s\n", argv[1]);
+        if (f != NULL) fclose(f);
+        return 1;
+    }
+    fclose(f);
+    printf("Wrote %s: %lu bytes\n", argv[1], (unsigned long)s_bundle.size());
+    return 0;
+}
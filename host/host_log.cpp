@@ -0,0 +1,29 @@
+/**
+ * @file host_log.cpp
+ * @brief ESP-IDF log output for host builds, printed to stderr
+ *
+ * Kept apart from host_stubs.cpp so that the component benchmarks can log
+ * without pulling in the firmware service stubs.
+ */
+
+#include "esp_log.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+static esp_log_level_t s_log_level = ESP_LOG_WARN;
+
+void host_log(esp_log_level_t level, const char *tag, const char *fmt, ...) {
+    static const char letters[] = "NEWIDV";
+    if (level > s_log_level) return;
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "%c (%s) ", letters[level], tag);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+void esp_log_level_set(const char *tag, esp_log_level_t level) {
+    (void)tag;
+    s_log_level = level;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file host_mem_count.c
+ * @brief LV_STDLIB_CUSTOM allocator: the C library, with call counters
+ */
+
+#include "host_mem_count.h"
+#include "lvgl.h"
+#include <stdlib.h>
+
+static host_mem_count_t s_count;
+
+void lv_mem_init(void) {
+    s_count.allocs = 0;
+    s_count.reallocs = 0;
+    s_count.frees = 0;
+}
+
+void lv_mem_deinit(void) {
+}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes) {
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    LV_UNUSED(pool);
+}
+
+void *lv_malloc_core(size_t size) {
+    s_count.allocs++;
+    return malloc(size);
+}
+
+void *lv_realloc_core(void *p, size_t new_size) {
+    s_count.reallocs++;
+    return realloc(p, new_size);
+}
+
+void lv_free_core(void *p) {
+    s_count.frees++;
+    free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p) {
+    LV_UNUSED(mon_p);
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return LV_RESULT_OK;
+}
+
+void host_mem_count_get(host_mem_count_t *out) {
+    *out = s_count;
+}
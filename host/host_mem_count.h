@@ -0,0 +1,35 @@
+/**
+ * @file host_mem_count.h
+ * @brief LVGL heap call counters for the host builds
+ *
+ * host/lv_conf.h selects LV_STDLIB_CUSTOM and host_mem_count.c implements
+ * LVGL's allocator hooks on top of the C library, counting every call that
+ * reaches it. lv_malloc(0), lv_free(NULL) and lv_realloc() to or from NULL
+ * are resolved inside LVGL and arrive here as the call they turn into.
+ */
+
+#ifndef HOST_MEM_COUNT_H
+#define HOST_MEM_COUNT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t allocs;     // lv_malloc_core calls
+    uint32_t reallocs;   // lv_realloc_core calls
+    uint32_t frees;      // lv_free_core calls
+} host_mem_count_t;
+
+/**
+ * @brief Copy the counts accumulated since lv_init()
+ */
+void host_mem_count_get(host_mem_count_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_MEM_COUNT_H
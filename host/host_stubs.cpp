@@ -0,0 +1,114 @@
+/**
+ * @file host_stubs.cpp
+ * @brief Firmware services the UI calls, reduced to inert host implementations
+ *
+ * Nothing here talks to a radio, NVS or the network. Getters report idle
+ * defaults; transmit status follows radio_tx_status_subject so that scripted
+ * TX toggles are seen consistently by the UI.
+ */
+
+#include "antenna_control.h"
+#include "cat_parser.h"
+#include "cat_polling.h"
+#include "cat_state.hpp"
+#include "esp_log.h"
+#include "lcd_init.h"
+#include "radio_subjects.h"
+#include "screensaver.h"
+#include "settings_storage.h"
+#include "uart.h"
+#include "websocket_client.h"
+#include <stdio.h>
+
+// cat_parser.h
+static transverter_state_t s_transverter_state;
+static pep_data_t s_pep_data;
+
+bool cat_check_and_reset_activity_flag(void) { return false; }
+int cat_get_rx_vfo_function(void) { return 0; }
+bool cat_get_transmit_status(void) { return lv_subject_get_int(&radio_tx_status_subject) != 0; }
+void cat_request_cw_menu_update(void) {}
+void cat_request_transverter_display_refresh(void) {}
+uint64_t compute_radio_frequency_from_display(uint64_t display_frequency) { return display_frequency; }
+float convert_raw_power_to_watts(int raw_power) { return (float)raw_power; }
+transverter_state_t *get_transverter_state(void) { return &s_transverter_state; }
+void pep_enable(bool enabled) { (void)enabled; }
+pep_data_t *pep_get_data(void) { return &s_pep_data; }
+
+// cat_polling.h
+static cat_ai_mode_t s_ai_mode = AI_MODE_ON;
+static bool s_user_override;
+
+cat_ai_mode_t cat_polling_get_ai_mode(void) { return s_ai_mode; }
+esp_err_t cat_polling_set_ai_mode(cat_ai_mode_t mode) {
+    s_ai_mode = mode;
+    return ESP_OK;
+}
+void cat_polling_set_expected_ai_mode(cat_ai_mode_t mode) { (void)mode; }
+bool cat_polling_get_user_override(void) { return s_user_override; }
+void cat_polling_set_user_override(bool enabled) { s_user_override = enabled; }
+void cat_polling_request_macros(void) {}
+
+// cat_state.hpp
+uint8_t radio_get_ssb_filter_mode(void) { return 0; }
+uint8_t radio_get_ssb_data_filter_mode(void) { return 0; }
+
+// lcd_init.h
+static uint8_t s_backlight = 100;
+
+void lcd_force_display_refresh(void) { lv_obj_invalidate(lv_screen_active()); }
+uint8_t lcd_get_backlight_level(void) { return s_backlight; }
+void lcd_set_backlight_level(uint8_t level) { s_backlight = level; }
+
+// uart.h
+esp_err_t uart_write_message(const char *message) {
+    ESP_LOGD("HOST_UART", "TX %s", message);
+    return ESP_OK;
+}
+
+// antenna_control.h
+const char *antenna_get_name(uint8_t antenna_id) {
+    static char name[8];
+    snprintf(name, sizeof(name), "ANT%u", (unsigned)antenna_id);
+    return name;
+}
+
+// screensaver.h
+static screensaver_timeout_t s_screensaver_timeout = SCREENSAVER_DISABLED;
+
+screensaver_timeout_t screensaver_get_timeout(void) { return s_screensaver_timeout; }
+void screensaver_set_timeout(screensaver_timeout_t timeout) { s_screensaver_timeout = timeout; }
+
+// settings_storage.h
+esp_err_t settings_load(user_settings_t *settings) {
+    if (!settings) return ESP_ERR_INVALID_ARG;
+    settings->xvtr_offset_mix_enabled = DEFAULT_XVTR_OFFSET_MIX;
+    settings->cat_polling_enabled = DEFAULT_CAT_POLLING;
+    settings->ai_mode = DEFAULT_AI_MODE;
+    settings->peak_hold_enabled = DEFAULT_PEAK_HOLD;
+    settings->peak_hold_duration_ms = DEFAULT_PEAK_HOLD_DURATION;
+    settings->pep_enabled = DEFAULT_PEP_ENABLED;
+    settings->smeter_averaging_enabled = DEFAULT_SMETER_AVERAGING;
+    settings->antenna_switch_enabled = DEFAULT_ANTENNA_SWITCH;
+    settings->cat_baud_rate = DEFAULT_CAT_BAUD;
+    return ESP_OK;
+}
+
+esp_err_t settings_save_antenna_switch(bool enabled) {
+    (void)enabled;
+    return ESP_OK;
+}
+
+// websocket_client.h: never connects
+esp_err_t websocket_client_init(void) { return ESP_OK; }
+esp_err_t websocket_client_start(void) { return ESP_OK; }
+esp_err_t websocket_client_stop(void) { return ESP_OK; }
+esp_err_t websocket_client_get_status(void) { return ESP_ERR_INVALID_STATE; }
+esp_err_t websocket_client_get_relay_names(void) { return ESP_ERR_INVALID_STATE; }
+esp_err_t websocket_client_subscribe_events(void) { return ESP_ERR_INVALID_STATE; }
+esp_err_t websocket_client_select_antenna_default(uint8_t antenna_id) {
+    (void)antenna_id;
+    return ESP_ERR_INVALID_STATE;
+}
+bool websocket_client_is_connected(void) { return false; }
+esp_err_t websocket_client_trigger_reconnection(void) { return ESP_OK; }
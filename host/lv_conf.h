@@ -0,0 +1,31 @@
+/**
+ * @file lv_conf.h
+ * @brief LVGL configuration for the host UI benchmark
+ *
+ * Uses the firmware configuration (main/lv_conf.h) so that rendering matches
+ * the device, and overrides only what cannot apply on a Linux host.
+ */
+#ifndef HOST_LV_CONF_H
+#define HOST_LV_CONF_H
+
+#include "../main/lv_conf.h"
+
+// Single-threaded: the benchmark owns the tick and calls the timer handler itself
+#undef LV_USE_OS
+#define LV_USE_OS LV_OS_NONE
+
+// The performance overlay would draw over the UI and add its own invalidations
+#undef LV_USE_SYSMON
+#define LV_USE_SYSMON 0
+#undef LV_USE_PERF_MONITOR
+#define LV_USE_PERF_MONITOR 0
+
+// Allocate through host_mem_count.c, which counts heap calls for the benchmarks
+#undef LV_USE_STDLIB_MALLOC
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
+
+// No flash section on the host
+#undef LV_ATTRIBUTE_LARGE_CONST
+#define LV_ATTRIBUTE_LARGE_CONST
+
+#endif // HOST_LV_CONF_H
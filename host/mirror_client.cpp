@@ -0,0 +1,211 @@
+/**
+ * @file mirror_client.cpp
+ * @brief Linux client for the firmware's display mirror (CONFIG_DISPLAY_MIRROR)
+ *
+ * Connects to the device, applies the streamed rectangles to a local copy of
+ * the screen and prints frame rate, bandwidth, dropped frames and decode time
+ * once a second. The screen can be saved as a PPM image, replaced each second
+ * so an image viewer that reloads on change follows it live.
+ *
+ *   host/build/mirror_client 192.168.1.50 --ppm shack.ppm
+ */
+
+#include "display_mirror_format.h"
+#include "mirror_codec.h"
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#define CLIENT_DEFAULT_PORT "5050"
+
+static uint64_t client_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static bool client_read(int fd, void *buf, size_t len) {
+    uint8_t *p = (uint8_t *)buf;
+    while (len > 0) {
+        ssize_t n = recv(fd, p, len, 0);
+        if (n <= 0) return false;
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static int client_connect(const char *host, const char *port) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo *res = NULL;
+    if (getaddrinfo(host, port, &hints, &res) != 0) return -1;
+    int fd = -1;
+    for (struct addrinfo *ai = res; ai != NULL; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    return fd;
+}
+
+// Written to a temporary file and renamed, so readers never see a partial image
+static bool client_write_ppm(const char *path, const std::vector<uint16_t> &screen, uint32_t w, uint32_t h) {
+    char tmp[512];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *f = fopen(tmp, "wb");
+    if (f == NULL) return false;
+    fprintf(f, "P6\n%lu %lu\n255\n", (unsigned long)w, (unsigned long)h);
+    std::vector<uint8_t> row((size_t)w * 3);
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            uint16_t c = screen[(size_t)y * w + x];
+            uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+            row[x * 3] = (uint8_t)((r << 3) | (r >> 2));
+            row[x * 3 + 1] = (uint8_t)((g << 2) | (g >> 4));
+            row[x * 3 + 2] = (uint8_t)((b << 3) | (b >> 2));
+        }
+        fwrite(row.data(), 1, row.size(), f);
+    }
+    bool ok = ferror(f) == 0;
+    fclose(f);
+    return ok && rename(tmp, path) == 0;
+}
+
+static void client_usage(const char *argv0) {
+    printf("Usage: %s <device> [options]\n"
+           "  --port N      TCP port (default %s, CONFIG_DISPLAY_MIRROR_PORT)\n"
+           "  --ppm FILE    Keep FILE updated with the screen, once a second\n"
+           "  --seconds N   Disconnect after N seconds\n",
+           argv0, CLIENT_DEFAULT_PORT);
+}
+
+int main(int argc, char **argv) {
+    const char *host = NULL;
+    const char *port = CLIENT_DEFAULT_PORT;
+    const char *ppm_path = NULL;
+    uint32_t seconds = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--port") == 0 && has_value) {
+            port = argv[++i];
+        } else if (strcmp(argv[i], "--ppm") == 0 && has_value) {
+            ppm_path = argv[++i];
+        } else if (strcmp(argv[i], "--seconds") == 0 && has_value) {
+            seconds = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (argv[i][0] != '-' && host == NULL) {
+            host = argv[i];
+        } else {
+            client_usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 2;
+        }
+    }
+    if (host == NULL) {
+        client_usage(argv[0]);
+        return 2;
+    }
+
+    int fd = client_connect(host, port);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot connect to %s:%s\n", host, port);
+        return 1;
+    }
+    printf("Connected to %s:%s\n", host, port);
+
+    std::vector<uint16_t> screen;
+    std::vector<uint8_t> payload;
+    uint32_t width = 0, height = 0;
+    uint64_t start_us = client_now_us(), report_us = start_us;
+    uint32_t frames = 0, dropped = 0, rects = 0;
+    uint64_t bytes = 0, decode_us = 0;
+    uint64_t total_frames = 0, total_dropped = 0, total_bytes = 0;
+    int status = 0;
+
+    while (seconds == 0 || client_now_us() - start_us < (uint64_t)seconds * 1000000u) {
+        mirror_frame_header_t fh;
+        if (!client_read(fd, &fh, sizeof(fh))) break;
+        if (fh.magic != MIRROR_FRAME_MAGIC) {
+            fprintf(stderr, "Bad frame magic %08lx\n", (unsigned long)fh.magic);
+            status = 1;
+            break;
+        }
+        if (fh.width != width || fh.height != height) {
+            width = fh.width;
+            height = fh.height;
+            screen.assign((size_t)width * height, 0);
+            printf("Screen %lux%lu\n", (unsigned long)width, (unsigned long)height);
+        }
+        payload.resize(fh.payload_size);
+        if (!client_read(fd, payload.data(), payload.size())) break;
+
+        uint64_t t0 = client_now_us();
+        size_t off = 0;
+        for (uint16_t i = 0; i < fh.rect_count && status == 0; i++) {
+            mirror_rect_header_t rh;
+            if (payload.size() - off < sizeof(rh)) {
+                status = 1;
+                break;
+            }
+            memcpy(&rh, &payload[off], sizeof(rh));
+            off += sizeof(rh);
+            if ((uint32_t)rh.x + rh.w > width || (uint32_t)rh.y + rh.h > height || payload.size() - off < rh.data_size ||
+                !mirror_decode_rect(&payload[off], rh.data_size, &screen[(size_t)rh.y * width + rh.x], width, rh.w,
+                                    rh.h)) {
+                status = 1;
+                break;
+            }
+            off += rh.data_size;
+        }
+        if (status != 0) {
+            fprintf(stderr, "Corrupt frame %lu\n", (unsigned long)fh.seq);
+            break;
+        }
+        decode_us += client_now_us() - t0;
+        frames++;
+        rects += fh.rect_count;
+        dropped += fh.dropped;
+        bytes += sizeof(fh) + fh.payload_size;
+
+        uint64_t now_us = client_now_us();
+        if (now_us - report_us >= 1000000u) {
+            double s = (double)(now_us - report_us) / 1e6;
+            printf("%5.1f fps, %7.1f kB/s, %4lu dropped, %5.1f rects/frame, decode %6lu us/frame\n", frames / s,
+                   bytes / 1000.0 / s, (unsigned long)dropped, frames ? (double)rects / frames : 0.0,
+                   (unsigned long)(frames ? decode_us / frames : 0));
+            if (ppm_path != NULL && !client_write_ppm(ppm_path, screen, width, height)) {
+                fprintf(stderr, "Cannot write %s\n", ppm_path);
+            }
+            total_frames += frames;
+            total_dropped += dropped;
+            total_bytes += bytes;
+            report_us = now_us;
+            frames = dropped = rects = 0;
+            bytes = decode_us = 0;
+        }
+    }
+    close(fd);
+
+    total_frames += frames;
+    total_dropped += dropped;
+    total_bytes += bytes;
+    double s = (double)(client_now_us() - start_us) / 1e6;
+    printf("%lu frames (%lu dropped on the device), %.1f kB/s average over %.1f s\n", (unsigned long)total_frames,
+           (unsigned long)total_dropped, s > 0 ? total_bytes / 1000.0 / s : 0.0, s);
+    if (ppm_path != NULL && width > 0 && !client_write_ppm(ppm_path, screen, width, height)) {
+        fprintf(stderr, "Cannot write %s\n", ppm_path);
+        status = 1;
+    }
+    return status;
+}
@@ -0,0 +1,9 @@
+/**
+ * @file gpio.h
+ * @brief Host build stand-in for GPIO numbers referenced by lcd_config.h
+ */
+#pragma once
+
+typedef int gpio_num_t;
+
+#define GPIO_NUM_NC (-1)
@@ -0,0 +1,9 @@
+/**
+ * @file i2c_master.h
+ * @brief Host build stand-in for I2C port numbers referenced by lcd_config.h
+ */
+#pragma once
+
+typedef int i2c_port_num_t;
+
+#define I2C_NUM_0 0
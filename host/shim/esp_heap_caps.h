@@ -0,0 +1,47 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief Host build stand-in for capability-based heap functions
+ *
+ * All capabilities map to the C heap. Free size is reported against a nominal
+ * 1 GiB so that before/after differences show the bytes allocated in between.
+ */
+#pragma once
+
+#include <malloc.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MALLOC_CAP_EXEC     (1 << 0)
+#define MALLOC_CAP_32BIT    (1 << 1)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+static inline size_t heap_caps_get_free_size(unsigned int caps) {
+    (void)caps;
+    return ((size_t)1 << 30) - mallinfo2().uordblks;
+}
+
+static inline void *heap_caps_malloc(size_t size, unsigned int caps) {
+    (void)caps;
+    return malloc(size);
+}
+
+static inline void *heap_caps_calloc(size_t n, size_t size, unsigned int caps) {
+    (void)caps;
+    return calloc(n, size);
+}
+
+static inline void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+#ifdef __cplusplus
+}
+#endif
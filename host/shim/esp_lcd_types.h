@@ -0,0 +1,8 @@
+/**
+ * @file esp_lcd_types.h
+ * @brief Host build stand-in for esp_lcd handle types
+ */
+#pragma once
+
+typedef struct esp_lcd_panel_t *esp_lcd_panel_handle_t;
+typedef struct esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t;
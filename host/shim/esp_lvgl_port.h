@@ -0,0 +1,27 @@
+/**
+ * @file esp_lvgl_port.h
+ * @brief Host build stand-in for the esp_lvgl_port lock
+ *
+ * The benchmark drives LVGL from a single thread, so the lock always succeeds.
+ */
+#pragma once
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline bool lvgl_port_lock(uint32_t timeout_ms) {
+    (void)timeout_ms;
+    return true;
+}
+
+static inline void lvgl_port_unlock(void) {
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,19 @@
+/**
+ * @file esp_system.h
+ * @brief Host build stand-in for esp_restart
+ */
+#pragma once
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline void esp_restart(void) {
+    abort();
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+/**
+ * @file esp_timer.h
+ * @brief Host build stand-in for esp_timer_get_time (monotonic clock)
+ */
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline int64_t esp_timer_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,7 @@
+/**
+ * @file esp_websocket_client.h
+ * @brief Host build stand-in for the websocket client component types
+ */
+#pragma once
+
+typedef struct esp_websocket_client *esp_websocket_client_handle_t;
@@ -0,0 +1,24 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Host build stand-in for the FreeRTOS base types
+ *
+ * The benchmark is single-threaded: tasks, queues and timers are never
+ * created, so code falls back to its direct (no-RTOS-object) paths.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_system.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
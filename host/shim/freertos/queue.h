@@ -0,0 +1,30 @@
+/**
+ * @file queue.h
+ * @brief Host build stand-in for FreeRTOS queues (creation fails, nothing is queued)
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include <stddef.h>
+
+typedef struct QueueDefinition *QueueHandle_t;
+
+static inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    (void)length;
+    (void)item_size;
+    return NULL;
+}
+
+static inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait) {
+    (void)queue;
+    (void)item;
+    (void)wait;
+    return pdFALSE;
+}
+
+static inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait) {
+    (void)queue;
+    (void)item;
+    (void)wait;
+    return pdFALSE;
+}
@@ -0,0 +1,9 @@
+/**
+ * @file semphr.h
+ * @brief Host build stand-in for FreeRTOS semaphore types
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct QueueDefinition *SemaphoreHandle_t;
@@ -0,0 +1,13 @@
+/**
+ * @file task.h
+ * @brief Host build stand-in for FreeRTOS task functions
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct tskTaskControlBlock *TaskHandle_t;
+
+static inline void vTaskDelay(TickType_t ticks) {
+    (void)ticks;
+}
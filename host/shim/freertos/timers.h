@@ -0,0 +1,38 @@
+/**
+ * @file timers.h
+ * @brief Host build stand-in for FreeRTOS software timers (creation fails)
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include <stddef.h>
+
+typedef struct tmrTimerControl *TimerHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t timer);
+
+static inline TimerHandle_t xTimerCreate(const char *name, TickType_t period, UBaseType_t auto_reload,
+                                         void *id, TimerCallbackFunction_t cb) {
+    (void)name;
+    (void)period;
+    (void)auto_reload;
+    (void)id;
+    (void)cb;
+    return NULL;
+}
+
+static inline BaseType_t xTimerStart(TimerHandle_t timer, TickType_t wait) {
+    (void)timer;
+    (void)wait;
+    return pdFAIL;
+}
+
+static inline BaseType_t xTimerReset(TimerHandle_t timer, TickType_t wait) {
+    (void)timer;
+    (void)wait;
+    return pdFAIL;
+}
+
+static inline BaseType_t xTimerIsTimerActive(TimerHandle_t timer) {
+    (void)timer;
+    return pdFALSE;
+}
@@ -0,0 +1,5 @@
+/**
+ * @file spi_types.h
+ * @brief Host build stand-in (no SPI types are used by the UI)
+ */
+#pragma once
@@ -0,0 +1,34 @@
+/**
+ * @file sdkconfig.h
+ * @brief Host build stand-in for the generated ESP-IDF configuration
+ *
+ * CONFIG_IDF_TARGET_ESP32S3 / CONFIG_IDF_TARGET_ESP32P4 come from the compiler
+ * command line (one benchmark binary per layout). The remaining values mirror
+ * the Kconfig defaults and can be overridden with -D.
+ */
+#pragma once
+
+#if !CONFIG_IDF_TARGET_ESP32S3 && !CONFIG_IDF_TARGET_ESP32P4
+#error "Define CONFIG_IDF_TARGET_ESP32S3 or CONFIG_IDF_TARGET_ESP32P4"
+#endif
+
+#ifndef CONFIG_CAT_UART_BAUD
+#define CONFIG_CAT_UART_BAUD 57600
+#endif
+
+#ifndef CONFIG_UI_TUNE_WRITE_INTERVAL_MS
+#define CONFIG_UI_TUNE_WRITE_INTERVAL_MS 50
+#endif
+
+// Settings screen construction policy (default: build on first use, keep warm)
+#if !defined(CONFIG_UI_SETTINGS_AT_BOOT) && !defined(CONFIG_UI_SETTINGS_LAZY_FREE)
+#define CONFIG_UI_SETTINGS_LAZY_KEEP 1
+#endif
+
+// S3 display strategy (default: single partial buffer)
+#ifndef CONFIG_S3_DISP_BUFFER_LINES
+#define CONFIG_S3_DISP_BUFFER_LINES 20
+#endif
+#ifndef CONFIG_S3_DISP_BOUNCE_LINES
+#define CONFIG_S3_DISP_BOUNCE_LINES 0
+#endif
@@ -0,0 +1,282 @@
+/**
+ * @file splash_gen.cpp
+ * @brief Boot splash image generator (CONFIG_BOOT_SPLASH)
+ *
+ * Draws the neutral boot screen - the product name on the UI background with
+ * an accent bar, no frequency, meter or button that could pass for live radio
+ * state - and writes it in the format of main/gfx/boot_splash_format.h. The
+ * committed main/splash/splash_<layout>.bin files are its output; --check
+ * verifies that they are current.
+ *
+ *   host/build/splash_gen s3 main/splash/splash_s3.bin
+ *   host/build/splash_gen p4 main/splash/splash_p4.bin
+ */
+
+#include "boot_splash_format.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// Colours from the UI palette (ui_styles.cpp)
+#define SPLASH_COLOR_BG 0x292831        // COLOR_BG_DARK
+#define SPLASH_COLOR_ACCENT 0x2095F6    // COLOR_BLUE_PRIMARY
+#define SPLASH_COLOR_TEXT 0xFFFFFF      // COLOR_TEXT
+#define SPLASH_COLOR_SUBTEXT 0x8C8C96
+
+#define SPLASH_TITLE "REMOTE RADIO DISPLAY"
+#define SPLASH_SUBTITLE "STARTING"
+
+#define GLYPH_W 5
+#define GLYPH_H 7
+
+typedef struct {
+    const char *name;
+    int width;          ///< Landscape UI resolution (lcd_config.h H_RES x V_RES)
+    int height;
+    bool rotate;        ///< Stored rotated to a portrait panel, as LVGL flushes it
+} splash_layout_t;
+
+static const splash_layout_t s_layouts[] = {
+    {"s3", 800, 480, false},
+    {"p4", 1280, 720, true},    // LVGL rotates by 270 degrees onto the 720x1280 panel
+};
+
+// 5x7 capitals, one byte per row, bit 4 leftmost; only the letters the splash uses
+static const struct {
+    char c;
+    uint8_t rows[GLYPH_H];
+} s_glyphs[] = {
+    {'A', {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+    {'D', {0x1E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E}},
+    {'E', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}},
+    {'G', {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}},
+    {'I', {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+    {'L', {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}},
+    {'M', {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}},
+    {'N', {0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x11}},
+    {'O', {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+    {'P', {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}},
+    {'R', {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}},
+    {'S', {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}},
+    {'T', {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}},
+    {'Y', {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04}},
+};
+
+static uint16_t rgb565(uint32_t rgb) {
+    return (uint16_t)(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+}
+
+// ---------------------------------------------------------------------------
+// Drawing (landscape, as the UI sees the screen)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    std::vector<uint16_t> px;
+    int w;
+    int h;
+} canvas_t;
+
+static void fill_rect(canvas_t *cv, int x, int y, int w, int h, uint16_t c) {
+    for (int yy = y < 0 ? 0 : y; yy < y + h && yy < cv->h; yy++) {
+        for (int xx = x < 0 ? 0 : x; xx < x + w && xx < cv->w; xx++) {
+            cv->px[(size_t)yy * cv->w + xx] = c;
+        }
+    }
+}
+
+static const uint8_t *glyph_rows(char c) {
+    for (size_t i = 0; i < sizeof(s_glyphs) / sizeof(s_glyphs[0]); i++) {
+        if (s_glyphs[i].c == c) return s_glyphs[i].rows;
+    }
+    return NULL;    // Space, or a letter without a glyph
+}
+
+static int text_width(const char *text, int scale) {
+    int n = (int)strlen(text);
+    return n > 0 ? (n * (GLYPH_W + 1) - 1) * scale : 0;
+}
+
+// Draws text with its top edge at y, centred horizontally
+static void draw_text(canvas_t *cv, const char *text, int y, int scale, uint16_t c) {
+    int x = (cv->w - text_width(text, scale)) / 2;
+    for (const char *p = text; *p; p++, x += (GLYPH_W + 1) * scale) {
+        const uint8_t *rows = glyph_rows(*p);
+        if (rows == NULL) continue;
+        for (int row = 0; row < GLYPH_H; row++) {
+            for (int col = 0; col < GLYPH_W; col++) {
+                if (rows[row] & (0x10 >> col)) {
+                    fill_rect(cv, x + col * scale, y + row * scale, scale, scale, c);
+                }
+            }
+        }
+    }
+}
+
+static void draw_splash(canvas_t *cv) {
+    fill_rect(cv, 0, 0, cv->w, cv->h, rgb565(SPLASH_COLOR_BG));
+
+    // Title across about 3/4 of the width, in whole-pixel scale steps
+    int title_scale = (cv->w * 3 / 4) / text_width(SPLASH_TITLE, 1);
+    if (title_scale < 1) title_scale = 1;
+    int sub_scale = title_scale / 2 > 0 ? title_scale / 2 : 1;
+    int title_w = text_width(SPLASH_TITLE, title_scale);
+    int gap = title_scale * 3;
+    int block_h = GLYPH_H * title_scale + gap + title_scale + gap + GLYPH_H * sub_scale;
+    int y = (cv->h - block_h) / 2;
+
+    draw_text(cv, SPLASH_TITLE, y, title_scale, rgb565(SPLASH_COLOR_TEXT));
+    y += GLYPH_H * title_scale + gap;
+    fill_rect(cv, (cv->w - title_w) / 2, y, title_w, title_scale, rgb565(SPLASH_COLOR_ACCENT));
+    y += title_scale + gap;
+    draw_text(cv, SPLASH_SUBTITLE, y, sub_scale, rgb565(SPLASH_COLOR_SUBTEXT));
+}
+
+// ---------------------------------------------------------------------------
+// Encoding (panel scan order)
+// ---------------------------------------------------------------------------
+
+// Pixel i of the panel in its native scan order
+static uint16_t native_px(const canvas_t *cv, const splash_layout_t *layout, uint32_t i) {
+    if (!layout->rotate) return cv->px[i];
+    uint32_t nx = i % (uint32_t)cv->h, ny = i / (uint32_t)cv->h;
+    return cv->px[(size_t)(cv->h - 1 - nx) * cv->w + ny];
+}
+
+static void put_le16(std::vector<uint8_t> &out, uint16_t v) {
+    out.push_back((uint8_t)v);
+    out.push_back((uint8_t)(v >> 8));
+}
+
+static std::vector<uint8_t> encode(const canvas_t *cv, const splash_layout_t *layout) {
+    const uint32_t total = (uint32_t)cv->w * cv->h;
+    std::vector<uint8_t> data;
+    uint32_t pos = 0;
+    while (pos < total) {
+        uint16_t c = native_px(cv, layout, pos);
+        uint32_t run = 1;
+        while (pos + run < total && run < BOOT_SPLASH_COUNT_MASK && native_px(cv, layout, pos + run) == c) run++;
+        if (run >= 3) {
+            put_le16(data, (uint16_t)(BOOT_SPLASH_RUN_FLAG | run));
+            put_le16(data, c);
+            pos += run;
+            continue;
+        }
+        // Literals up to the next run of three
+        uint32_t n = 0;
+        while (pos + n < total && n < BOOT_SPLASH_COUNT_MASK) {
+            uint32_t j = pos + n;
+            if (j + 2 < total && native_px(cv, layout, j) == native_px(cv, layout, j + 1) &&
+                native_px(cv, layout, j) == native_px(cv, layout, j + 2)) {
+                break;
+            }
+            n++;
+        }
+        put_le16(data, (uint16_t)n);
+        for (uint32_t i = 0; i < n; i++) put_le16(data, native_px(cv, layout, pos + i));
+        pos += n;
+    }
+
+    boot_splash_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = BOOT_SPLASH_MAGIC;
+    hdr.width = (uint16_t)(layout->rotate ? cv->h : cv->w);
+    hdr.height = (uint16_t)(layout->rotate ? cv->w : cv->h);
+    hdr.data_size = (uint32_t)data.size();
+    std::vector<uint8_t> out((const uint8_t *)&hdr, (const uint8_t *)&hdr + sizeof(hdr));
+    out.insert(out.end(), data.begin(), data.end());
+    return out;
+}
+
+// Same decoding as the firmware (boot_splash.cpp), to catch encoder mistakes here
+static bool verify(const std::vector<uint8_t> &image, const canvas_t *cv, const splash_layout_t *layout) {
+    const uint32_t total = (uint32_t)cv->w * cv->h;
+    const uint8_t *src = image.data() + sizeof(boot_splash_header_t);
+    const uint8_t *end = image.data() + image.size();
+    uint32_t pos = 0;
+    while (src + 2 <= end && pos < total) {
+        uint16_t token = (uint16_t)(src[0] | (src[1] << 8));
+        src += 2;
+        uint32_t n = token & BOOT_SPLASH_COUNT_MASK;
+        if (n > total - pos) return false;
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t *p = (token & BOOT_SPLASH_RUN_FLAG) ? src : src + i * 2;
+            if (p + 2 > end || (uint16_t)(p[0] | (p[1] << 8)) != native_px(cv, layout, pos + i)) return false;
+        }
+        src += (token & BOOT_SPLASH_RUN_FLAG) ? 2 : n * 2;
+        pos += n;
+    }
+    return pos == total && src == end;
+}
+
+static bool read_file(const char *path, std::vector<uint8_t> &out) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return false;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+    bool ok = ferror(f) == 0;
+    fclose(f);
+    return ok;
+}
+
+static void usage(const char *argv0) {
+    printf("Usage: %s <s3|p4> FILE [--check]\n"
+           "  Writes the boot splash for the layout to FILE; with --check, only\n"
+           "  verifies that FILE holds the current image.\n",
+           argv0);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3 || argc > 4 || (argc == 4 && strcmp(argv[3], "--check") != 0)) {
+        usage(argv[0]);
+        return 2;
+    }
+    const splash_layout_t *layout = NULL;
+    for (size_t i = 0; i < sizeof(s_layouts) / sizeof(s_layouts[0]); i++) {
+        if (strcmp(argv[1], s_layouts[i].name) == 0) layout = &s_layouts[i];
+    }
+    if (layout == NULL) {
+        usage(argv[0]);
+        return 2;
+    }
+    const char *path = argv[2];
+
+    canvas_t cv;
+    cv.w = layout->width;
+    cv.h = layout->height;
+    cv.px.resize((size_t)cv.w * cv.h);
+    draw_splash(&cv);
+    std::vector<uint8_t> image = encode(&cv, layout);
+    if (!verify(image, &cv, layout)) {
+        fprintf(stderr, "Encoded image does not decode back to the drawing\n");
+        return 1;
+    }
+
+    if (argc == 4) {
+        std::vector<uint8_t> current;
+        if (!read_file(path, current) || current != image) {
+            fprintf(stderr, "%s is missing or out of date, regenerate it with: %s %s %s\n", path, argv[0],
+                    layout->name, path);
+            return 1;
+        }
+        printf("%s is current\n", path);
+        return 0;
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return 1;
+    }
+    fwrite(image.data(), 1, image.size(), f);
+    bool ok = ferror(f) == 0;
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return 1;
+    }
+    printf("splash %s: %lu bytes (%lu raw)\n", path, (unsigned long)image.size(),
+           (unsigned long)cv.w * cv.h * 2);
+    return 0;
+}
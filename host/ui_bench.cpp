@@ -0,0 +1,500 @@
+/**
+ * @file ui_bench.cpp
+ * @brief Headless UI render benchmark for the Screen1/Screen2 layouts
+ *
+ * Builds the real UI against LVGL with an in-memory RGB565 display, then drives
+ * scripted subject updates the way the CAT parser does (write the subject
+ * buffer, notify) and measures every refresh. Time is simulated: each frame
+ * advances the LVGL tick by one refresh period, so throttles and animations
+ * behave as on the device while render time is measured with the host clock.
+ *
+ * One binary per layout (ui_bench_s3: 800x480, ui_bench_p4: 1280x720).
+ */
+
+#include "ui.h"
+#include "ui_helpers.h"
+#include "ui_scale.h"
+#include "cat_parser.h"
+#include "radio_subjects.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "display_mirror_format.h"
+#include "mirror_codec.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#if CONFIG_IDF_TARGET_ESP32P4
+#define BENCH_LAYOUT_NAME "p4"
+#else
+#define BENCH_LAYOUT_NAME "s3"
+#endif
+
+#define BENCH_FRAME_MS LV_DEF_REFR_PERIOD   // Simulated time per frame
+#define BENCH_DEFAULT_FRAMES 300
+#define BENCH_DEFAULT_LINES 20
+#define BENCH_SETTLE_FRAMES 15              // Unmeasured frames between scenarios
+
+typedef struct {
+    uint32_t render_us;     ///< Refresh time excluding flush
+    uint32_t flush_us;      ///< Time in flush_cb (framebuffer copy)
+    uint32_t inv_px;        ///< Sum of invalidated areas before merging
+    uint32_t inv_areas;     ///< Invalidation requests
+    uint32_t flush_px;      ///< Pixels passed to flush_cb
+    uint32_t mirror_us;     ///< Display mirror coding (--mirror)
+    uint32_t mirror_bytes;  ///< Display mirror stream bytes (--mirror)
+} bench_frame_t;
+
+typedef struct {
+    const char *name;
+    void (*step)(uint32_t frame);
+} bench_scenario_t;
+
+static uint32_t s_tick_ms;
+static uint16_t *s_fb;              // Simulated panel framebuffer
+static bench_frame_t s_cur;         // Frame being measured
+static FILE *s_csv;
+
+// Display mirror emulation: the device's coding plus a client that decodes it
+static bool s_mirror;
+static bool s_mirror_in_sync = true;
+static uint16_t *s_mirror_shadow;
+static uint16_t *s_mirror_client;
+static uint8_t *s_mirror_buf;
+static size_t s_mirror_cap;
+
+// ---------------------------------------------------------------------------
+// In-memory display
+// ---------------------------------------------------------------------------
+
+static uint32_t bench_tick_cb(void) {
+    return s_tick_ms;
+}
+
+// Codes a flushed area as the display mirror does and applies it to the client copy
+static void bench_mirror_rect(const lv_area_t *area, const uint16_t *src, uint32_t src_stride) {
+    uint16_t w = (uint16_t)lv_area_get_width(area);
+    uint16_t h = (uint16_t)lv_area_get_height(area);
+    size_t offset = (size_t)area->y1 * H_RES + area->x1;
+    int64_t start_us = esp_timer_get_time();
+    size_t n = mirror_encode_rect(src, src_stride, &s_mirror_shadow[offset], H_RES, w, h, s_mirror_buf, s_mirror_cap);
+    s_cur.mirror_us += (uint32_t)(esp_timer_get_time() - start_us);
+    s_cur.mirror_bytes += (uint32_t)(sizeof(mirror_rect_header_t) + n);
+    if (n == 0 || !mirror_decode_rect(s_mirror_buf, n, &s_mirror_client[offset], H_RES, w, h)) {
+        s_mirror_in_sync = false;
+    }
+}
+
+static void bench_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    int64_t start_us = esp_timer_get_time();
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    const uint16_t *src = (const uint16_t *)px_map;
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&s_fb[y * H_RES + area->x1], px_map, w * sizeof(uint16_t));
+        px_map += stride;
+    }
+    s_cur.flush_px += lv_area_get_size(area);
+    s_cur.flush_us += (uint32_t)(esp_timer_get_time() - start_us);
+    if (s_mirror) bench_mirror_rect(area, src, stride / sizeof(uint16_t));
+    lv_display_flush_ready(disp);
+}
+
+static void bench_display_event_cb(lv_event_t *e) {
+    const lv_area_t *area = (const lv_area_t *)lv_event_get_param(e);
+    if (area == NULL) return;
+    s_cur.inv_px += lv_area_get_size(area);
+    s_cur.inv_areas++;
+}
+
+static lv_display_t *bench_display_create(uint32_t lines) {
+    uint32_t stride = lv_draw_buf_width_to_stride(H_RES, LV_COLOR_FORMAT_RGB565);
+    size_t buf_size = ((size_t)stride * lines + 63) & ~(size_t)63;
+    void *buf = aligned_alloc(64, buf_size);
+    s_fb = (uint16_t *)calloc((size_t)H_RES * V_RES, sizeof(uint16_t));
+    if (buf == NULL || s_fb == NULL) return NULL;
+    if (s_mirror) {
+        // Worst case is alternating skips and single literals, 3 bytes per pixel
+        s_mirror_cap = (size_t)H_RES * V_RES * 4;
+        s_mirror_buf = (uint8_t *)malloc(s_mirror_cap);
+        s_mirror_shadow = (uint16_t *)calloc((size_t)H_RES * V_RES, sizeof(uint16_t));
+        s_mirror_client = (uint16_t *)calloc((size_t)H_RES * V_RES, sizeof(uint16_t));
+        if (s_mirror_buf == NULL || s_mirror_shadow == NULL || s_mirror_client == NULL) return NULL;
+    }
+
+    lv_display_t *disp = lv_display_create(H_RES, V_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, buf, NULL, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, bench_flush_cb);
+    lv_display_add_event_cb(disp, bench_display_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    // Refresh only when the benchmark asks for it (lv_refr_now still runs the timer)
+    lv_timer_pause(lv_display_get_refr_timer(disp));
+    return disp;
+}
+
+// Advance one refresh period, let LVGL timers and animations run, then render
+static void bench_frame(lv_display_t *disp, void (*step)(uint32_t), uint32_t frame) {
+    memset(&s_cur, 0, sizeof(s_cur));
+    s_tick_ms += BENCH_FRAME_MS;
+    if (step != NULL) step(frame);
+    lv_timer_handler();
+    int64_t start_us = esp_timer_get_time();
+    lv_refr_now(disp);
+    uint32_t total_us = (uint32_t)(esp_timer_get_time() - start_us);
+    uint32_t other_us = s_cur.flush_us + s_cur.mirror_us;
+    s_cur.render_us = total_us > other_us ? total_us - other_us : 0;
+    if (s_cur.mirror_bytes > 0) s_cur.mirror_bytes += sizeof(mirror_frame_header_t);
+}
+
+// ---------------------------------------------------------------------------
+// Scripted updates (same buffers and subjects the CAT parser feeds)
+// ---------------------------------------------------------------------------
+
+static int32_t bench_triangle(uint32_t frame, uint32_t period, int32_t max) {
+    uint32_t phase = frame % period;
+    uint32_t half = period / 2;
+    return (int32_t)((phase < half ? phase : period - phase) * max / half);
+}
+
+static void bench_set_vfo(uint32_t active_hz, uint32_t inactive_hz) {
+    vfo_update_t *vfo = radio_get_vfo_buffer();
+    vfo->active_freq = active_hz;
+    vfo->inactive_freq = inactive_hz;
+    vfo->active_vfo = 0;
+    lv_subject_notify(&radio_vfo_consolidated_subject);
+}
+
+static void bench_set_tx(bool tx) {
+    kenwood_if_data_t *if_data = radio_get_if_data_buffer();
+    if_data->tx_rx = tx;
+    lv_subject_set_int(&radio_tx_status_subject, tx ? 1 : 0);
+    lv_subject_notify(&radio_if_data_subject);
+}
+
+static void scenario_vfo_spin(uint32_t frame) {
+    // Slow tuning (10 Hz steps), then a fast spin (1 kHz steps), like a VFO knob
+    static uint32_t freq_hz;
+    if (frame == 0) freq_hz = 14074000;
+    freq_hz += ((frame / 50) % 2) ? 1000 : 10;
+    bench_set_vfo(freq_hz, 7074000);
+}
+
+static void scenario_meter_sweep(uint32_t frame) {
+    lv_subject_set_int(&radio_s_meter_subject, bench_triangle(frame, 60, 30));
+}
+
+static void scenario_tx_toggle(uint32_t frame) {
+    bool tx = ((frame / 30) % 2) != 0;
+    if (frame % 30 == 0) bench_set_tx(tx);
+    if (tx) {
+        lv_subject_set_int(&radio_swr_subject, bench_triangle(frame, 20, 10));
+        lv_subject_set_int(&radio_alc_subject, bench_triangle(frame, 24, 30));
+    } else {
+        lv_subject_set_int(&radio_s_meter_subject, bench_triangle(frame, 40, 20));
+    }
+}
+
+static void scenario_settings(uint32_t frame) {
+    // Same calls as the Settings and back buttons; the first visit builds Screen2
+    uint32_t phase = frame % 60;
+    if (phase == 0) {
+        _ui_screen_change(&ui_Screen2, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen2_screen_init);
+    } else if (phase == 30) {
+        _ui_screen_change(&ui_Screen1, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen1_screen_init);
+    }
+}
+
+static const bench_scenario_t s_scenarios[] = {
+    {"idle", NULL},
+    {"vfo_spin", scenario_vfo_spin},
+    {"meter_sweep", scenario_meter_sweep},
+    {"tx_toggle", scenario_tx_toggle},
+    {"settings", scenario_settings},
+};
+
+#define BENCH_SCENARIO_COUNT (sizeof(s_scenarios) / sizeof(s_scenarios[0]))
+
+static void bench_reset_state(lv_display_t *disp) {
+    if (lv_screen_active() != ui_Screen1) {
+        _ui_screen_change(&ui_Screen1, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen1_screen_init);
+    }
+    if (lv_subject_get_int(&radio_tx_status_subject) != 0) bench_set_tx(false);
+    lv_subject_set_int(&radio_s_meter_subject, 0);
+    lv_subject_set_int(&radio_swr_subject, 0);
+    lv_subject_set_int(&radio_alc_subject, 0);
+    for (uint32_t i = 0; i < BENCH_SETTLE_FRAMES; i++) bench_frame(disp, NULL, i);
+}
+
+// ---------------------------------------------------------------------------
+// PNG output (stored deflate blocks: large files, no zlib dependency)
+// ---------------------------------------------------------------------------
+
+static uint32_t bench_crc32(uint32_t crc, const uint8_t *data, size_t len) {
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void bench_put_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void bench_png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+    uint8_t hdr[8];
+    bench_put_be32(hdr, len);
+    memcpy(hdr + 4, type, 4);
+    uint32_t crc = bench_crc32(bench_crc32(0, hdr + 4, 4), data, len);
+    uint8_t crc_be[4];
+    bench_put_be32(crc_be, crc);
+    fwrite(hdr, 1, sizeof(hdr), f);
+    fwrite(data, 1, len, f);
+    fwrite(crc_be, 1, sizeof(crc_be), f);
+}
+
+static bool bench_write_png(const char *path) {
+    const size_t row_len = 1 + (size_t)H_RES * 3;   // Filter byte + RGB888
+    const size_t raw_len = row_len * V_RES;
+    const size_t blocks = (raw_len + 65534) / 65535;
+    const size_t z_len = 2 + raw_len + blocks * 5 + 4;
+    uint8_t *raw = (uint8_t *)malloc(raw_len);
+    uint8_t *z = (uint8_t *)malloc(z_len);
+    FILE *f = fopen(path, "wb");
+    if (raw == NULL || z == NULL || f == NULL) {
+        free(raw);
+        free(z);
+        if (f != NULL) fclose(f);
+        return false;
+    }
+
+    for (int32_t y = 0; y < V_RES; y++) {
+        uint8_t *row = raw + y * row_len;
+        *row++ = 0;
+        for (int32_t x = 0; x < H_RES; x++) {
+            uint16_t c = s_fb[y * H_RES + x];
+            uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+            *row++ = (uint8_t)((r << 3) | (r >> 2));
+            *row++ = (uint8_t)((g << 2) | (g >> 4));
+            *row++ = (uint8_t)((b << 3) | (b >> 2));
+        }
+    }
+
+    uint8_t *p = z;
+    *p++ = 0x78;
+    *p++ = 0x01;
+    uint32_t a = 1, b = 0;
+    for (size_t off = 0; off < raw_len; off += 65535) {
+        uint16_t n = (uint16_t)(raw_len - off < 65535 ? raw_len - off : 65535);
+        *p++ = (off + n >= raw_len) ? 1 : 0;
+        *p++ = (uint8_t)n;
+        *p++ = (uint8_t)(n >> 8);
+        *p++ = (uint8_t)~n;
+        *p++ = (uint8_t)(~n >> 8);
+        memcpy(p, raw + off, n);
+        p += n;
+        for (size_t i = off; i < off + n; i++) {
+            a = (a + raw[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+    }
+    bench_put_be32(p, (b << 16) | a);
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t ihdr[13] = {0};
+    bench_put_be32(ihdr, H_RES);
+    bench_put_be32(ihdr + 4, V_RES);
+    ihdr[8] = 8;    // Bit depth
+    ihdr[9] = 2;    // Truecolor
+    fwrite(signature, 1, sizeof(signature), f);
+    bench_png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    bench_png_chunk(f, "IDAT", z, (uint32_t)z_len);
+    bench_png_chunk(f, "IEND", NULL, 0);
+    bool ok = ferror(f) == 0;
+    fclose(f);
+    free(raw);
+    free(z);
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+// Reporting
+// ---------------------------------------------------------------------------
+
+static int bench_cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_report(const char *name, const bench_frame_t *frames, uint32_t count, const char *png_dir) {
+    uint32_t *render = (uint32_t *)malloc(sizeof(uint32_t) * (count ? count : 1));
+    uint32_t drawn = 0;
+    uint64_t render_total = 0, inv_total = 0, flush_total = 0, mirror_us = 0, mirror_bytes = 0;
+    uint32_t mirror_max_us = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const bench_frame_t *fr = &frames[i];
+        inv_total += fr->inv_px;
+        flush_total += fr->flush_px;
+        mirror_us += fr->mirror_us;
+        mirror_bytes += fr->mirror_bytes;
+        if (fr->mirror_us > mirror_max_us) mirror_max_us = fr->mirror_us;
+        if (fr->flush_px > 0) {
+            render[drawn++] = fr->render_us;
+            render_total += fr->render_us;
+        }
+        if (s_csv != NULL) {
+            fprintf(s_csv, "%s,%s,%lu,%lu,%lu,%lu,%lu,%lu\n", BENCH_LAYOUT_NAME, name, (unsigned long)i,
+                    (unsigned long)fr->render_us, (unsigned long)fr->flush_us, (unsigned long)fr->inv_px,
+                    (unsigned long)fr->inv_areas, (unsigned long)fr->flush_px);
+        }
+    }
+    qsort(render, drawn, sizeof(uint32_t), bench_cmp_u32);
+    uint32_t avg = drawn ? (uint32_t)(render_total / drawn) : 0;
+    uint32_t p95 = drawn ? render[(drawn * 95) / 100] : 0;
+    uint32_t max = drawn ? render[drawn - 1] : 0;
+    uint32_t screen_px = (uint32_t)H_RES * V_RES;
+    uint32_t fb_crc = bench_crc32(0, (const uint8_t *)s_fb, (size_t)screen_px * sizeof(uint16_t));
+
+    printf("%-12s %6lu %6lu %8lu %8lu %8lu %10lu %5.1f%% %10lu   %08lx\n", name, (unsigned long)count,
+           (unsigned long)drawn, (unsigned long)avg, (unsigned long)p95, (unsigned long)max,
+           (unsigned long)(count ? inv_total / count : 0),
+           count ? 100.0 * (double)inv_total / ((double)count * screen_px) : 0.0,
+           (unsigned long)(count ? flush_total / count : 0), (unsigned long)fb_crc);
+    free(render);
+
+    if (s_mirror) {
+        // Device coding cost scales with these; bytes per simulated ms is kB/s
+        bool in_sync = s_mirror_in_sync && memcmp(s_mirror_client, s_fb, (size_t)screen_px * sizeof(uint16_t)) == 0;
+        printf("%-12s mirror %8lu B/frame %6lu kB/s, coding %6lu us/frame avg %6lu max, client %s\n", "",
+               (unsigned long)(count ? mirror_bytes / count : 0),
+               (unsigned long)(count ? mirror_bytes / ((uint64_t)count * BENCH_FRAME_MS) : 0),
+               (unsigned long)(drawn ? mirror_us / drawn : 0), (unsigned long)mirror_max_us,
+               in_sync ? "in sync" : "OUT OF SYNC");
+        if (!in_sync) s_mirror_in_sync = false;
+    }
+
+    if (png_dir != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s_%s.png", png_dir, BENCH_LAYOUT_NAME, name);
+        if (!bench_write_png(path)) fprintf(stderr, "Failed to write %s\n", path);
+    }
+}
+
+static void bench_run_scenario(lv_display_t *disp, const bench_scenario_t *sc, uint32_t count,
+                               const char *png_dir) {
+    bench_frame_t *frames = (bench_frame_t *)calloc(count, sizeof(bench_frame_t));
+    if (frames == NULL) return;
+    bench_reset_state(disp);
+    for (uint32_t i = 0; i < count; i++) {
+        bench_frame(disp, sc->step, i);
+        frames[i] = s_cur;
+    }
+    bench_report(sc->name, frames, count, png_dir);
+    free(frames);
+}
+
+static void bench_usage(const char *argv0) {
+    printf("Usage: %s [options]\n"
+           "  --frames N       Frames per scenario (default %d, %d ms simulated each)\n"
+           "  --lines N        Partial draw buffer height in lines (default %d)\n"
+           "  --scenario NAME  Run one scenario only (idle, vfo_spin, meter_sweep, tx_toggle, settings)\n"
+           "  --png DIR        Write the final frame of each scenario as DIR/%s_<scenario>.png\n"
+           "  --csv FILE       Write per-frame measurements\n"
+           "  --mirror         Measure display mirror stream size and coding time\n"
+           "  --verbose        Show firmware INFO logs\n",
+           argv0, BENCH_DEFAULT_FRAMES, BENCH_FRAME_MS, BENCH_DEFAULT_LINES, BENCH_LAYOUT_NAME);
+}
+
+int main(int argc, char **argv) {
+    uint32_t frame_count = BENCH_DEFAULT_FRAMES;
+    uint32_t lines = BENCH_DEFAULT_LINES;
+    const char *only = NULL;
+    const char *png_dir = NULL;
+    const char *csv_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--frames") == 0 && has_value) {
+            frame_count = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--lines") == 0 && has_value) {
+            lines = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--scenario") == 0 && has_value) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "--png") == 0 && has_value) {
+            png_dir = argv[++i];
+        } else if (strcmp(argv[i], "--csv") == 0 && has_value) {
+            csv_path = argv[++i];
+        } else if (strcmp(argv[i], "--mirror") == 0) {
+            s_mirror = true;
+        } else if (strcmp(argv[i], "--verbose") == 0) {
+            esp_log_level_set("*", ESP_LOG_INFO);
+        } else {
+            bench_usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 2;
+        }
+    }
+    if (frame_count == 0 || lines == 0 || lines > V_RES) {
+        bench_usage(argv[0]);
+        return 2;
+    }
+    if (png_dir != NULL && mkdir(png_dir, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Cannot create %s\n", png_dir);
+        return 1;
+    }
+    if (csv_path != NULL) {
+        s_csv = fopen(csv_path, "w");
+        if (s_csv == NULL) {
+            fprintf(stderr, "Cannot open %s\n", csv_path);
+            return 1;
+        }
+        fprintf(s_csv, "layout,scenario,frame,render_us,flush_us,inv_px,inv_areas,flush_px\n");
+    }
+
+    lv_init();
+    lv_tick_set_cb(bench_tick_cb);
+    lv_display_t *disp = bench_display_create(lines);
+    if (disp == NULL) {
+        fprintf(stderr, "Out of memory creating the display\n");
+        return 1;
+    }
+    radio_subjects_init();
+
+    size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    int64_t start_us = esp_timer_get_time();
+    ui_init();
+    printf("layout %s %dx%d, %lu buffer lines, %d ms/frame simulated\n", BENCH_LAYOUT_NAME, H_RES, V_RES,
+           (unsigned long)lines, BENCH_FRAME_MS);
+    printf("ui_init %lu us, heap %ld bytes\n\n", (unsigned long)(esp_timer_get_time() - start_us),
+           (long)heap_before - (long)heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
+    printf("%-12s %6s %6s %8s %8s %8s %10s %6s %10s   %s\n", "scenario", "frames", "drawn", "avg_us", "p95_us",
+           "max_us", "inv_px/f", "inv%", "flush_px/f", "fb_crc32");
+
+    // First frame after boot: full-screen render
+    bench_frame(disp, NULL, 0);
+    bench_frame_t boot = s_cur;
+    bench_report("boot", &boot, 1, png_dir);
+
+    for (size_t i = 0; i < BENCH_SCENARIO_COUNT; i++) {
+        if (only != NULL && strcmp(only, s_scenarios[i].name) != 0) continue;
+        bench_run_scenario(disp, &s_scenarios[i], frame_count, png_dir);
+    }
+
+    if (s_csv != NULL) fclose(s_csv);
+    if (s_mirror && !s_mirror_in_sync) {
+        fprintf(stderr, "Mirror client copy differs from the framebuffer\n");
+        return 1;
+    }
+    return 0;
+}
@@ -1025,6 +1025,7 @@ void parse_if_command(const char *response) {
 
     // Notify UI of TX/RX status change via LVGL 9 native observer
     radio_subject_set_int_async(&radio_tx_status_subject, g_is_transmitting ? 1 : 0);
+    cat_polling_update_tx_state(g_is_transmitting);
 
     // P9: Operating Mode (1 digit/char, see MD command) - position 27
     char mode_char = payload_ptr[27];
@@ -1352,6 +1353,7 @@ void parse_tx_command(const char *response) {
     if (p1 == '0' || p1 == '1' || p1 == '2') {
         g_is_transmitting = true;
         radio_subject_set_int_async(&radio_tx_status_subject, 1);
+        cat_polling_update_tx_state(true);
 
         // Trigger frequency display update to switch active VFO in split mode
         bool effective_split = cat_get_split_status();
@@ -1370,6 +1372,7 @@ void parse_rx_command(const char *response) {
     (void)response; // Prefix already verified
     g_is_transmitting = false;
     radio_subject_set_int_async(&radio_tx_status_subject, 0);
+    cat_polling_update_tx_state(false);
 
     // Reset PEP data when switching to receive mode
     pep_reset();
@@ -2563,9 +2566,11 @@ static void parse_mx_command(const char *response) {
         if (name[0] == '\0') {
             ESP_LOGD(TAG, "MXR: Skipping empty macro slot %d", id);
         } else {
-            // Update UI cache and request debounced refresh
+            // Update UI cache; a running macro fetch refreshes the list once when it completes
             ui_macro_set_cached(id, name, commands);
-            ui_macro_request_refresh();
+            if (!cat_polling_macro_fetch_active()) {
+                ui_macro_request_refresh();
+            }
             ESP_LOGI(TAG, "MXR: Cached macro %d (%s)", id, name);
         }
 
@@ -2612,7 +2617,9 @@ static void parse_mx_command(const char *response) {
                 }
             }
         }
-        ui_macro_request_refresh();
+        if (!cat_polling_macro_fetch_active()) {
+            ui_macro_request_refresh();
+        }
 
     } else if (subcmd == 'W') {
         // MXW<ID>; - Save acknowledgment
@@ -2656,7 +2663,9 @@ void parse_cat_command(const char *response) {
         parse_if_command(response);
         return;
     }
-    for (size_t i = 1; response[i] != '\0'; ++i) {
+    // Macro frames carry free text (names, command lists) that may contain "IF"
+    bool is_macro = response[0] == 'M' && response[1] == 'X';
+    for (size_t i = 1; !is_macro && response[i] != '\0'; ++i) {
         if (response[i - 1] == 'I' && response[i] == 'F') {
             parse_if_command(&response[i - 1]);
             return;
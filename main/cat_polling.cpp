@@ -4,10 +4,13 @@
 #include "radio/radio_subject_updater.h"
 #include "esp_check.h"
 #include "uart.h"
+#include "cat_transaction.h"
+#include "ui/screens/ui_Screen2.h" // For ui_macro_request_refresh
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "lvgl.h"
 #include "esp_lvgl_port.h"
+#include "screensaver.h"
 #include "task_handles.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -89,12 +92,18 @@ static void safe_lv_timer_set_repeat_count(lv_timer_t* timer, int32_t count) {
 
 // Polling intervals in milliseconds (optimized for ~35% UART traffic reduction)
 #define POLLING_INTERVAL_IF    150   // IF command - main status (was 100ms)
-#define POLLING_INTERVAL_SM    300   // SM command - S-meter (was 200ms, 3.3Hz is sufficient)
-#define POLLING_INTERVAL_RM    100   // RM command - cycles through SWR/PWR/ALC (was 67ms, 300ms cycle)
+#define POLLING_INTERVAL_SM    200   // SM command - S-meter (RM budget moved here while receiving)
+#define POLLING_INTERVAL_RM    0     // RM command - SWR/COMP/ALC are transmit-only meters
 #define POLLING_INTERVAL_FR    500   // FR command - RX VFO
 #define POLLING_INTERVAL_FA    250   // FA command - VFO A frequency (was 200ms)
 #define POLLING_INTERVAL_FB    250   // FB command - VFO B frequency (was 200ms)
 #define POLLING_INTERVAL_FT    500   // FT command - TX VFO
+// Transmit profile: meters get the bus, VFOs cannot change while keyed
+#define POLLING_INTERVAL_SM_TX  300  // SM reads power output during TX
+#define POLLING_INTERVAL_RM_TX  67   // RM1/RM2/RM3 rotation, ~200ms full cycle
+#define POLLING_INTERVAL_VFO_TX 1000 // FR/FA/FB/FT
+// Low-activity profile (screensaver blanked): IF only, to notice the operator keying up
+#define POLLING_INTERVAL_IF_IDLE 1000
 #define POLLING_INTERVAL_FILTER 2000 // SH/SL filter commands - check every 2 seconds
 #define POLLING_INTERVAL_AI_STATUS 10000 // AI status monitoring - check every 10 seconds
 #define CAT_ACTIVITY_TIMEOUT_MS 5000 // Consider CAT inactive after 5 seconds
@@ -124,6 +133,40 @@ static lv_timer_t *timer_ai_check = NULL;
 static lv_timer_t *timer_ai_status_monitor = NULL;
 static lv_timer_t *timer_agc_query = NULL;
 
+// Per-command polling periods for one TX/RX state. A period of 0 pauses the command.
+typedef struct {
+    const char *name;
+    uint32_t if_ms;
+    uint32_t sm_ms;
+    uint32_t rm_ms;
+    uint32_t fr_ms;
+    uint32_t fa_ms;
+    uint32_t fb_ms;
+    uint32_t ft_ms;
+} polling_profile_t;
+
+static const polling_profile_t s_profile_rx = {
+    "RX", POLLING_INTERVAL_IF, POLLING_INTERVAL_SM, POLLING_INTERVAL_RM,
+    POLLING_INTERVAL_FR, POLLING_INTERVAL_FA, POLLING_INTERVAL_FB, POLLING_INTERVAL_FT
+};
+
+static const polling_profile_t s_profile_tx = {
+    "TX", POLLING_INTERVAL_IF, POLLING_INTERVAL_SM_TX, POLLING_INTERVAL_RM_TX,
+    POLLING_INTERVAL_VFO_TX, POLLING_INTERVAL_VFO_TX, POLLING_INTERVAL_VFO_TX, POLLING_INTERVAL_VFO_TX
+};
+
+static const polling_profile_t s_profile_idle = {
+    "IDLE", POLLING_INTERVAL_IF_IDLE, 0, 0, 0, 0, 0, 0
+};
+
+static const polling_profile_t *s_active_profile = &s_profile_rx;
+static bool s_low_activity = false;
+// Set when the LVGL lock could not be taken to apply a profile; the IF poll,
+// which runs in every profile, applies the current one on its next run
+static volatile bool s_profile_apply_pending = false;
+static int64_t s_profile_since_us = 0;
+static uint32_t s_profile_switches = 0;
+
 // RM meter type cycling state (1=SWR, 2=COMP/PWR, 3=ALC)
 static uint8_t s_rm_meter_index = 0;
 static const char *s_rm_meter_commands[] = {"RM1;", "RM2;", "RM3;"};
@@ -150,6 +193,7 @@ static size_t periodic_poll_sequence_index = 0;
 static void boot_seq_timer_cb(lv_timer_t *timer);
 static void periodic_poll_timer_cb(lv_timer_t *timer);
 static void periodic_poll_spacing_cb(lv_timer_t *timer);
+static void start_state_resync(void);
 static void agc_query_timer_cb(lv_timer_t *timer);
 static void start_agc_query(void);
 static void stop_agc_query(void);
@@ -186,6 +230,8 @@ static void polling_timer_ai_status_monitor_cb(lv_timer_t *timer);
 static void update_polling_state(void);
 static void start_polling_timers(void);
 static void stop_polling_timers(void);
+static void apply_polling_profile(void);
+static uint32_t profile_rate_x10(const polling_profile_t *p);
 static void start_ai_status_monitoring(void);
 static void stop_ai_status_monitoring(void);
 static void start_periodic_polling(void);
@@ -203,6 +249,8 @@ esp_err_t cat_polling_init(void) {
     g_polling_state.tx_vfo = VFO_UNKNOWN;
     g_polling_state.cat_connection_active = true;  // Assume CAT is available from start
     g_polling_state.last_cat_activity = esp_timer_get_time() / 1000;
+    s_active_profile = &s_profile_rx;
+    s_profile_since_us = esp_timer_get_time();
     
     // Create AI mode check timer (runs once to check AI mode)
     // Use retry version during init as LVGL may be busy with display setup
@@ -232,13 +280,7 @@ esp_err_t cat_polling_start(void) {
     (void) uart_write_message("PS;AI;FA;FB;");
 
     // Query macro configuration from panel interface using MX protocol
-    // MXA gets F-key assignments, then query all macros individually
-    (void) uart_write_message("MXA;");
-    for (int i = 1; i <= 50; i++) {
-        char cmd[16];
-        snprintf(cmd, sizeof(cmd), "MXR%02d;", i);
-        (void) uart_write_message(cmd);
-    }
+    cat_polling_request_macros();
 
     // Start periodic state refresh (runs independently of polling toggle)
     start_periodic_polling();
@@ -370,6 +412,70 @@ void cat_polling_update_tx_vfo(cat_vfo_t vfo) {
     }
 }
 
+void cat_polling_update_tx_state(bool tx) {
+    const polling_profile_t *next = tx ? &s_profile_tx : &s_profile_rx;
+    if (next == s_active_profile) {
+        return;
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    int64_t held_ms = s_profile_since_us ? (now_us - s_profile_since_us) / 1000 : 0;
+    const polling_profile_t *prev = s_active_profile;
+    s_active_profile = next;
+    s_profile_since_us = now_us;
+    s_profile_switches++;
+
+    // Start TX meter rotation at RM1 (SWR) so the first reading is the one that matters most
+    s_rm_meter_index = 0;
+
+    // Keying up while blanked means the operator is back - wake the display,
+    // which leaves low-activity mode and applies the TX profile
+    if (s_low_activity) {
+        if (tx) {
+            screensaver_trigger_activity();
+        }
+        return;
+    }
+
+    if (g_polling_state.polling_enabled) {
+        apply_polling_profile();
+    }
+
+    int64_t apply_us = esp_timer_get_time() - now_us;
+    uint32_t rate = profile_rate_x10(next);
+    ESP_LOGI(TAG, "Polling profile %s -> %s after %lld ms (switch #%lu, applied in %lld us%s)",
+             prev->name, next->name, (long long)held_ms, (unsigned long)s_profile_switches,
+             (long long)apply_us, g_polling_state.polling_enabled ? "" : ", polling off");
+    ESP_LOGI(TAG, "  %s periods ms: IF=%lu SM=%lu RM=%lu FR=%lu FA=%lu FB=%lu FT=%lu (%lu.%lu cmd/s)",
+             next->name, (unsigned long)next->if_ms, (unsigned long)next->sm_ms, (unsigned long)next->rm_ms,
+             (unsigned long)next->fr_ms, (unsigned long)next->fa_ms, (unsigned long)next->fb_ms,
+             (unsigned long)next->ft_ms, (unsigned long)(rate / 10), (unsigned long)(rate % 10));
+}
+
+void cat_polling_set_low_activity(bool low_activity) {
+    if (s_low_activity == low_activity) {
+        return;
+    }
+    s_low_activity = low_activity;
+
+    if (g_polling_state.polling_enabled) {
+        apply_polling_profile();
+    }
+
+    if (low_activity) {
+        ESP_LOGI(TAG, "Low-activity polling: IF every %d ms, meters and VFOs paused",
+                 POLLING_INTERVAL_IF_IDLE);
+    } else {
+        ESP_LOGI(TAG, "Leaving low-activity polling, %s profile restored", s_active_profile->name);
+        // Subject updates were discarded while blanked - bring every display back in line
+        start_state_resync();
+    }
+}
+
+bool cat_polling_is_tx_profile(void) {
+    return s_active_profile == &s_profile_tx;
+}
+
 cat_vfo_t cat_polling_get_rx_vfo(void) {
     return g_polling_state.rx_vfo;
 }
@@ -451,15 +557,16 @@ static void start_polling_timers(void) {
     ESP_LOGI(TAG, "Querying current VFO and frequency state");
     uart_write_message("FR;FT;FA;FB;");
 
-    // Create timers if they don't exist (all wrapped with mutex protection)
+    // Create timers if they don't exist (all wrapped with mutex protection).
+    // Periods are set from the active profile below.
     if (timer_if == NULL) {
         timer_if = safe_lv_timer_create(polling_timer_if_cb, POLLING_INTERVAL_IF, NULL);
     }
     if (timer_sm == NULL) {
-        timer_sm = safe_lv_timer_create(polling_timer_sm_cb, POLLING_INTERVAL_SM, NULL);
+        timer_sm = safe_lv_timer_create(polling_timer_sm_cb, POLLING_INTERVAL_SM_TX, NULL);
     }
     if (timer_rm == NULL) {
-        timer_rm = safe_lv_timer_create(polling_timer_rm_cb, POLLING_INTERVAL_RM, NULL);
+        timer_rm = safe_lv_timer_create(polling_timer_rm_cb, POLLING_INTERVAL_RM_TX, NULL);
     }
     if (timer_fr == NULL) {
         timer_fr = safe_lv_timer_create(polling_timer_fr_cb, POLLING_INTERVAL_FR, NULL);
@@ -475,14 +582,53 @@ static void start_polling_timers(void) {
     }
     // Note: Filter polling removed - SH/SL commands only sent during boot sequence
 
-    // Resume timers
-    safe_lv_timer_resume(timer_if);
-    safe_lv_timer_resume(timer_sm);
-    safe_lv_timer_resume(timer_rm);
-    safe_lv_timer_resume(timer_fr);
-    safe_lv_timer_resume(timer_fa);
-    safe_lv_timer_resume(timer_fb);
-    safe_lv_timer_resume(timer_ft);
+    // Set periods and resume timers for the current TX/RX profile
+    apply_polling_profile();
+}
+
+// Sets one polling timer to a profile period; 0 leaves it paused. LVGL lock must be held.
+static void apply_profile_period(lv_timer_t *timer, uint32_t period_ms) {
+    if (timer == NULL) {
+        return;
+    }
+    if (period_ms == 0) {
+        lv_timer_pause(timer);
+        return;
+    }
+    lv_timer_set_period(timer, period_ms);
+    lv_timer_resume(timer);
+}
+
+// Called from the CAT parser task on TX/RX changes, so all timers are set under
+// one lock; if LVGL is busy the change is left to the next IF poll instead of lost
+static void apply_polling_profile(void) {
+    if (!lvgl_port_lock(LVGL_TIMER_MUTEX_TIMEOUT_MS)) {
+        s_profile_apply_pending = true;
+        ESP_LOGW(TAG, "LVGL busy, polling profile deferred to the next IF poll");
+        return;
+    }
+    s_profile_apply_pending = false;
+    const polling_profile_t *p = s_low_activity ? &s_profile_idle : s_active_profile;
+    apply_profile_period(timer_if, p->if_ms);
+    apply_profile_period(timer_sm, p->sm_ms);
+    apply_profile_period(timer_rm, p->rm_ms);
+    apply_profile_period(timer_fr, p->fr_ms);
+    apply_profile_period(timer_fa, p->fa_ms);
+    apply_profile_period(timer_fb, p->fb_ms);
+    apply_profile_period(timer_ft, p->ft_ms);
+    lvgl_port_unlock();
+}
+
+// Commands per second a profile puts on the bus, x10 for one decimal place
+static uint32_t profile_rate_x10(const polling_profile_t *p) {
+    const uint32_t periods[] = {p->if_ms, p->sm_ms, p->rm_ms, p->fr_ms, p->fa_ms, p->fb_ms, p->ft_ms};
+    uint32_t rate = 0;
+    for (size_t i = 0; i < sizeof(periods) / sizeof(periods[0]); i++) {
+        if (periods[i] > 0) {
+            rate += 10000 / periods[i];
+        }
+    }
+    return rate;
 }
 
 static void stop_polling_timers(void) {
@@ -527,6 +673,11 @@ static void stop_periodic_polling(void) {
 static void polling_timer_if_cb(lv_timer_t *timer) {
     (void)timer;
 
+    // Runs in the LVGL task, so the (recursive) lock is free to take
+    if (s_profile_apply_pending && g_polling_state.polling_enabled) {
+        apply_polling_profile();
+    }
+
     if (g_polling_state.polling_enabled && g_polling_state.cat_connection_active) {
         esp_err_t ret = uart_write_message("IF;");
         if (ret != ESP_OK) {
@@ -730,6 +881,14 @@ static void periodic_poll_timer_cb(lv_timer_t *timer) {
     }
 
     ESP_LOGI(TAG, "Periodic state refresh - querying radio state");
+    start_state_resync();
+}
+
+// Re-queries the boot sequence state, paced by the spacing timer
+static void start_state_resync(void) {
+    if (!g_polling_state.cat_connection_active) {
+        return;
+    }
 
     // Start the periodic polling sequence
     periodic_poll_sequence_running = true;
@@ -824,13 +983,31 @@ void cat_polling_handle_agc_response(void) {
 // Memory Channel Polling
 // ============================================================================
 
-static uint16_t s_last_memory_channel = 0xFFFF;  // 0xFFFF = not yet requested
+static uint16_t s_last_memory_channel = 0xFFFF;  // 0xFFFF = not yet received
+static volatile uint16_t s_pending_memory_channel = 0xFFFF;  // MR query awaiting its answer
+
+// Runs in the parser task once the MR answer has been routed (parse_mr_command
+// handles the payload) or the query has timed out
+static void memory_channel_answer_cb(cat_txn_result_t result, const char *answer, void *user_data) {
+    (void)answer;
+    uint16_t channel = (uint16_t)(uintptr_t)user_data;
+    s_pending_memory_channel = 0xFFFF;
+    if (result == CAT_TXN_OK) {
+        s_last_memory_channel = channel;
+    } else {
+        // Leave s_last_memory_channel alone so the next IF answer asks again
+        ESP_LOGW(TAG, "No answer for memory channel %u (%d)", channel, result);
+    }
+}
 
 void cat_polling_request_memory_channel(uint16_t channel) {
     if (channel > 999) {
         ESP_LOGW(TAG, "Invalid memory channel: %u", channel);
         return;
     }
+    if (channel == s_pending_memory_channel) {
+        return;  // Already on its way
+    }
 
     // Build MR command: MR0[hundreds][tens][units];
     // P1=0 (simplex), P2=hundreds digit, P3=last two digits
@@ -838,14 +1015,58 @@ void cat_polling_request_memory_channel(uint16_t channel) {
     snprintf(cmd, sizeof(cmd), "MR0%d%02d;", channel / 100, channel % 100);
 
     ESP_LOGI(TAG, "Requesting memory channel %u: %s", channel, cmd);
-    esp_err_t ret = uart_write_message(cmd);
-    if (ret == ESP_OK) {
-        s_last_memory_channel = channel;
-    } else {
-        ESP_LOGW(TAG, "Failed to send MR command: %s", esp_err_to_name(ret));
+    s_pending_memory_channel = channel;
+    if (cat_txn_submit(cmd, NULL, CAT_TXN_DEFAULT_TIMEOUT_MS, memory_channel_answer_cb,
+                       (void *)(uintptr_t)channel) == 0) {
+        s_pending_memory_channel = 0xFFFF;
+        ESP_LOGW(TAG, "Failed to send MR command: %s", cmd);
     }
 }
 
 uint16_t cat_polling_get_last_memory_channel(void) {
     return s_last_memory_channel;
 }
+
+// ============================================================================
+// Macro Fetch
+// ============================================================================
+
+#define MACRO_FETCH_COUNT 50
+#define MACRO_FETCH_WINDOW 4         // MXR queries in flight at once
+#define MACRO_FETCH_TIMEOUT_MS 400
+
+static volatile bool s_macro_fetch_active = false;
+
+// Index 0 is the F-key assignment query, 1..50 the macro slots
+static void macro_fetch_query(size_t index, char *query, size_t size) {
+    if (index == 0) {
+        snprintf(query, size, "MXA;");
+    } else {
+        snprintf(query, size, "MXR%02u;", (unsigned)index);
+    }
+}
+
+static void macro_fetch_done_cb(size_t answered, size_t failed, void *user_data) {
+    (void)user_data;
+    s_macro_fetch_active = false;
+    ESP_LOGI(TAG, "Macro fetch complete: %u answered, %u without answer", (unsigned)answered, (unsigned)failed);
+    ui_macro_request_refresh();
+}
+
+void cat_polling_request_macros(void) {
+    if (s_macro_fetch_active) {
+        ESP_LOGD(TAG, "Macro fetch already running");
+        return;
+    }
+    s_macro_fetch_active = true;
+    esp_err_t ret = cat_txn_batch_start(MACRO_FETCH_COUNT + 1, MACRO_FETCH_WINDOW, macro_fetch_query,
+                                        MACRO_FETCH_TIMEOUT_MS, macro_fetch_done_cb, NULL);
+    if (ret != ESP_OK) {
+        s_macro_fetch_active = false;
+        ESP_LOGW(TAG, "Failed to start macro fetch: %s", esp_err_to_name(ret));
+    }
+}
+
+bool cat_polling_macro_fetch_active(void) {
+    return s_macro_fetch_active;
+}
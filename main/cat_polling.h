@@ -107,6 +107,26 @@ void cat_polling_update_rx_vfo(cat_vfo_t vfo);
  */
 void cat_polling_update_tx_vfo(cat_vfo_t vfo);
 
+/**
+ * Update TX/RX state from IF/TX/RX answers and switch the polling profile
+ * @param tx true while transmitting
+ */
+void cat_polling_update_tx_state(bool tx);
+
+/**
+ * Get the active polling profile
+ * @return true if the transmit profile is active
+ */
+bool cat_polling_is_tx_profile(void);
+
+/**
+ * Enter or leave low-activity mode (screensaver blanked)
+ * Entering pauses meter/VFO polling and keeps a slow IF poll for activity detection.
+ * Leaving restores the TX/RX profile and re-queries the full radio state.
+ * @param low_activity true while the display is blanked
+ */
+void cat_polling_set_low_activity(bool low_activity);
+
 /**
  * Get current RX VFO
  * @return Current RX VFO
@@ -156,9 +176,21 @@ void cat_polling_handle_agc_response(void);
 void cat_polling_request_memory_channel(uint16_t channel);
 
 /**
- * Get the last requested memory channel
- * @return Last requested memory channel number
+ * Get the last memory channel whose MR data was received
+ * @return Memory channel number, 0xFFFF if none yet
  */
 uint16_t cat_polling_get_last_memory_channel(void);
 
+/**
+ * Read F-key assignments and all macro slots from the panel (MXA, MXR01-50)
+ * Queries are pipelined as answers arrive; the macro list refreshes once at the end
+ */
+void cat_polling_request_macros(void);
+
+/**
+ * Check if a macro fetch is in progress
+ * @return true while MXR answers from cat_polling_request_macros() are expected
+ */
+bool cat_polling_macro_fetch_active(void);
+
 #endif // CAT_POLLING_H
@@ -0,0 +1,71 @@
+#ifndef CAT_RX_FRAMER_H
+#define CAT_RX_FRAMER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Splits the received CAT byte stream into frames at ';', CR or LF.
+// The buffer is sized for the longest frame either way (CAT_FRAME_MAX_LEN), so
+// an MXR answer for a long macro arrives whole. A frame that still does not fit
+// is dropped as one at its terminator, never split into a truncated command and
+// a headless tail that could parse as another answer.
+//
+// No locking is done here - only the UART read task feeds a framer.
+
+typedef enum {
+    CAT_RX_NONE = 0,   // Byte consumed, no frame complete
+    CAT_RX_FRAME,      // Frame complete in buf, NUL terminated, valid until the next byte
+    CAT_RX_OVERFLOW,   // Frame longer than the buffer ended and was discarded
+} cat_rx_result_t;
+
+typedef struct {
+    char *buf;
+    size_t size;       // Capacity including the NUL
+    size_t len;
+    bool overflow;     // Current frame no longer fits, discard at its terminator
+} cat_rx_framer_t;
+
+static inline void cat_rx_framer_init(cat_rx_framer_t *framer, char *buf, size_t size) {
+    framer->buf = buf;
+    framer->size = size;
+    framer->len = 0;
+    framer->overflow = false;
+}
+
+// Forgets a partial frame (e.g. bytes received at a previous baud rate)
+static inline void cat_rx_framer_reset(cat_rx_framer_t *framer) {
+    framer->len = 0;
+    framer->overflow = false;
+}
+
+static inline cat_rx_result_t cat_rx_framer_push(cat_rx_framer_t *framer, char c, size_t *frame_len) {
+    if (c != ';' && c != '\r' && c != '\n') {
+        if (framer->len < framer->size - 1) {
+            framer->buf[framer->len++] = c;
+        } else {
+            framer->overflow = true;
+        }
+        return CAT_RX_NONE;
+    }
+    if (framer->overflow) {
+        cat_rx_framer_reset(framer);
+        return CAT_RX_OVERFLOW;
+    }
+    if (framer->len == 0) {
+        return CAT_RX_NONE;
+    }
+    framer->buf[framer->len] = '\0';
+    *frame_len = framer->len;
+    framer->len = 0;
+    return CAT_RX_FRAME;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CAT_RX_FRAMER_H
@@ -0,0 +1,409 @@
+#include "cat_transaction.h"
+#include "uart.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "CAT_TXN";
+
+#define CAT_TXN_MATCH_SIZE 16
+#define CAT_TXN_INDEX_BITS 5
+#define CAT_TXN_INDEX_MASK ((1u << CAT_TXN_INDEX_BITS) - 1u)
+#define CAT_TXN_WAIT_GRACE_MS 100  // Extra wait beyond the deadline in case the sweep is late
+
+typedef struct {
+    cat_txn_handle_t handle;      // 0 = slot free
+    char match[CAT_TXN_MATCH_SIZE];
+    uint8_t match_len;
+    int64_t submitted_us;
+    int64_t deadline_us;
+    cat_txn_cb_t cb;
+    void *user_data;
+    bool done;                    // Completed, waiting for cat_txn_wait() to collect
+    cat_txn_result_t result;
+    char answer[CAT_TXN_ANSWER_SIZE];
+    SemaphoreHandle_t done_sem;
+    StaticSemaphore_t done_sem_buf;
+} cat_txn_slot_t;
+
+// Completion to signal once the lock is released
+typedef struct {
+    cat_txn_cb_t cb;
+    void *user_data;
+    cat_txn_result_t result;
+    SemaphoreHandle_t sem;        // Set instead of cb for waitable transactions
+} cat_txn_fired_t;
+
+static cat_txn_slot_t s_slots[CAT_TXN_MAX_PENDING];
+static volatile uint32_t s_active_count = 0;
+static uint32_t s_generation = 0;
+static portMUX_TYPE s_txn_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static struct {
+    uint32_t submitted;
+    uint32_t answered;
+    uint32_t timeouts;
+    uint32_t send_failed;
+    uint32_t pool_full;
+    uint64_t latency_sum_us;
+    uint32_t latency_max_us;
+} s_stats;
+
+// Pipelined batch state (one batch at a time)
+static struct {
+    bool active;
+    size_t count;
+    size_t next;
+    size_t answered;
+    size_t failed;
+    uint32_t timeout_ms;
+    cat_txn_batch_query_fn make_query;
+    cat_txn_batch_done_cb_t done_cb;
+    void *user_data;
+} s_batch;
+
+static inline size_t cat_txn_slot_index(cat_txn_handle_t handle) {
+    return (size_t)(handle & CAT_TXN_INDEX_MASK) - 1;
+}
+
+// Must be called with s_txn_lock held
+static void cat_txn_release_slot(cat_txn_slot_t *slot) {
+    slot->handle = 0;
+    slot->done = false;
+    s_active_count--;
+}
+
+// Must be called with s_txn_lock held; fills in what to signal after unlocking
+static void cat_txn_finish_slot(cat_txn_slot_t *slot, cat_txn_result_t result, const char *answer,
+                                int64_t now_us, cat_txn_fired_t *fired) {
+    if (result == CAT_TXN_OK) {
+        uint32_t latency_us = (uint32_t)(now_us - slot->submitted_us);
+        s_stats.answered++;
+        s_stats.latency_sum_us += latency_us;
+        if (latency_us > s_stats.latency_max_us) {
+            s_stats.latency_max_us = latency_us;
+        }
+    } else {
+        s_stats.timeouts++;
+    }
+
+    fired->cb = slot->cb;
+    fired->user_data = slot->user_data;
+    fired->result = result;
+    fired->sem = NULL;
+    if (slot->cb != NULL) {
+        cat_txn_release_slot(slot);
+        return;
+    }
+
+    // Waitable: keep the slot until cat_txn_wait() collects it
+    slot->result = result;
+    if (answer != NULL) {
+        strncpy(slot->answer, answer, sizeof(slot->answer) - 1);
+        slot->answer[sizeof(slot->answer) - 1] = '\0';
+    } else {
+        slot->answer[0] = '\0';
+    }
+    slot->done = true;
+    fired->sem = slot->done_sem;
+}
+
+static void cat_txn_signal(const cat_txn_fired_t *fired, size_t count, const char *answer) {
+    for (size_t i = 0; i < count; i++) {
+        if (fired[i].cb != NULL) {
+            fired[i].cb(fired[i].result, answer, fired[i].user_data);
+        } else if (fired[i].sem != NULL) {
+            xSemaphoreGive(fired[i].sem);
+        }
+    }
+}
+
+void cat_txn_sweep(void) {
+    if (s_active_count == 0) {
+        return;
+    }
+
+    cat_txn_fired_t fired[CAT_TXN_MAX_PENDING];
+    size_t fired_count = 0;
+    const int64_t now_us = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&s_txn_lock);
+    for (size_t i = 0; i < CAT_TXN_MAX_PENDING; i++) {
+        cat_txn_slot_t *slot = &s_slots[i];
+        if (slot->handle != 0 && !slot->done && now_us >= slot->deadline_us) {
+            cat_txn_finish_slot(slot, CAT_TXN_TIMEOUT, NULL, now_us, &fired[fired_count++]);
+        }
+    }
+    taskEXIT_CRITICAL(&s_txn_lock);
+
+    cat_txn_signal(fired, fired_count, NULL);
+}
+
+esp_err_t cat_txn_init(void) {
+    for (size_t i = 0; i < CAT_TXN_MAX_PENDING; i++) {
+        memset(&s_slots[i], 0, sizeof(s_slots[i]));
+        s_slots[i].done_sem = xSemaphoreCreateBinaryStatic(&s_slots[i].done_sem_buf);
+    }
+    s_active_count = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+    memset(&s_batch, 0, sizeof(s_batch));
+
+    // Timeouts are swept by the parser task (cat_txn_sweep), not an esp_timer
+    ESP_LOGI(TAG, "CAT transactions initialized (%d slots)", CAT_TXN_MAX_PENDING);
+    return ESP_OK;
+}
+
+cat_txn_handle_t cat_txn_submit(const char *query, const char *match, uint32_t timeout_ms,
+                                cat_txn_cb_t cb, void *user_data) {
+    if (query == NULL || query[0] == '\0') {
+        return 0;
+    }
+
+    // Default match is the query itself without its terminator
+    const char *match_src = match ? match : query;
+    size_t match_len = match ? strlen(match) : strcspn(query, ";");
+    if (match_len == 0 || match_len >= CAT_TXN_MATCH_SIZE) {
+        ESP_LOGW(TAG, "Unsupported match prefix for %s", query);
+        return 0;
+    }
+
+    const int64_t now_us = esp_timer_get_time();
+    cat_txn_slot_t *slot = NULL;
+    cat_txn_handle_t handle = 0;
+
+    taskENTER_CRITICAL(&s_txn_lock);
+    for (size_t i = 0; i < CAT_TXN_MAX_PENDING; i++) {
+        if (s_slots[i].handle == 0) {
+            slot = &s_slots[i];
+            s_generation++;
+            handle = (s_generation << CAT_TXN_INDEX_BITS) | (cat_txn_handle_t)(i + 1);
+            slot->handle = handle;
+            memcpy(slot->match, match_src, match_len);
+            slot->match[match_len] = '\0';
+            slot->match_len = (uint8_t)match_len;
+            slot->submitted_us = now_us;
+            slot->deadline_us = now_us + (int64_t)timeout_ms * 1000;
+            slot->cb = cb;
+            slot->user_data = user_data;
+            slot->done = false;
+            s_active_count++;
+            s_stats.submitted++;
+            break;
+        }
+    }
+    if (slot == NULL) {
+        s_stats.pool_full++;
+    }
+    taskEXIT_CRITICAL(&s_txn_lock);
+
+    if (slot == NULL) {
+        ESP_LOGW(TAG, "Transaction pool full, dropping %s", query);
+        return 0;
+    }
+
+    // If the same query is already in flight the TX path drops this copy and
+    // the earlier query's answer completes this transaction too
+    if (uart_write_message(query) != ESP_OK) {
+        taskENTER_CRITICAL(&s_txn_lock);
+        if (slot->handle == handle) {
+            cat_txn_release_slot(slot);
+        }
+        s_stats.send_failed++;
+        taskEXIT_CRITICAL(&s_txn_lock);
+        return 0;
+    }
+    return handle;
+}
+
+cat_txn_result_t cat_txn_wait(cat_txn_handle_t handle, char *answer, size_t answer_size) {
+    size_t index = cat_txn_slot_index(handle);
+    if (handle == 0 || index >= CAT_TXN_MAX_PENDING) {
+        return CAT_TXN_SEND_FAILED;
+    }
+    cat_txn_slot_t *slot = &s_slots[index];
+
+    taskENTER_CRITICAL(&s_txn_lock);
+    bool valid = (slot->handle == handle && slot->cb == NULL);
+    int64_t remaining_us = slot->deadline_us - esp_timer_get_time();
+    taskEXIT_CRITICAL(&s_txn_lock);
+    if (!valid) {
+        return CAT_TXN_SEND_FAILED;
+    }
+
+    uint32_t wait_ms = (remaining_us > 0 ? (uint32_t)(remaining_us / 1000) : 0) + CAT_TXN_WAIT_GRACE_MS;
+    bool signalled = (xSemaphoreTake(slot->done_sem, pdMS_TO_TICKS(wait_ms)) == pdTRUE);
+
+    cat_txn_result_t result = CAT_TXN_TIMEOUT;
+    bool completed_late = false;
+    taskENTER_CRITICAL(&s_txn_lock);
+    if (slot->handle == handle) {
+        if (slot->done) {
+            completed_late = !signalled;
+            result = slot->result;
+            if (answer != NULL && answer_size > 0) {
+                strncpy(answer, slot->answer, answer_size - 1);
+                answer[answer_size - 1] = '\0';
+            }
+        } else {
+            s_stats.timeouts++;
+        }
+        cat_txn_release_slot(slot);
+    }
+    taskEXIT_CRITICAL(&s_txn_lock);
+
+    if (completed_late) {
+        xSemaphoreTake(slot->done_sem, 0); // Consume the give so the slot starts clean
+    }
+    return result;
+}
+
+void cat_txn_complete(const char *answer) {
+    if (s_active_count == 0 || answer == NULL) {
+        return;
+    }
+
+    cat_txn_fired_t fired[CAT_TXN_MAX_PENDING];
+    size_t fired_count = 0;
+    const int64_t now_us = esp_timer_get_time();
+
+    // Every pending transaction with a matching prefix completes; duplicates of
+    // an in-flight query share its single answer
+    taskENTER_CRITICAL(&s_txn_lock);
+    for (size_t i = 0; i < CAT_TXN_MAX_PENDING; i++) {
+        cat_txn_slot_t *slot = &s_slots[i];
+        if (slot->handle == 0 || slot->done || slot->match[0] != answer[0]) {
+            continue;
+        }
+        if (strncmp(answer, slot->match, slot->match_len) == 0) {
+            cat_txn_finish_slot(slot, CAT_TXN_OK, answer, now_us, &fired[fired_count++]);
+        }
+    }
+    taskEXIT_CRITICAL(&s_txn_lock);
+
+    cat_txn_signal(fired, fired_count, answer);
+}
+
+// ============================================================================
+// Pipelined batches
+// ============================================================================
+
+// Counts a finished item; returns true (after running done_cb) when it was the last one
+static bool cat_txn_batch_account(cat_txn_result_t result) {
+    bool finished = false;
+    size_t answered = 0;
+    size_t failed = 0;
+    cat_txn_batch_done_cb_t done_cb = NULL;
+    void *done_user_data = NULL;
+
+    taskENTER_CRITICAL(&s_txn_lock);
+    if (result == CAT_TXN_OK) {
+        s_batch.answered++;
+    } else {
+        s_batch.failed++;
+    }
+    if (s_batch.answered + s_batch.failed >= s_batch.count) {
+        finished = true;
+        answered = s_batch.answered;
+        failed = s_batch.failed;
+        done_cb = s_batch.done_cb;
+        done_user_data = s_batch.user_data;
+        s_batch.active = false;
+    }
+    taskEXIT_CRITICAL(&s_txn_lock);
+
+    if (finished && done_cb != NULL) {
+        done_cb(answered, failed, done_user_data);
+    }
+    return finished;
+}
+
+static void cat_txn_batch_item_cb(cat_txn_result_t result, const char *answer, void *user_data);
+
+// Sends the next batch query; returns false when nothing is left to send
+static bool cat_txn_batch_send_next(void) {
+    char query[CAT_TXN_QUERY_SIZE];
+
+    while (true) {
+        taskENTER_CRITICAL(&s_txn_lock);
+        if (!s_batch.active || s_batch.next >= s_batch.count) {
+            taskEXIT_CRITICAL(&s_txn_lock);
+            return false;
+        }
+        size_t index = s_batch.next++;
+        taskEXIT_CRITICAL(&s_txn_lock);
+
+        s_batch.make_query(index, query, sizeof(query));
+        if (cat_txn_submit(query, NULL, s_batch.timeout_ms, cat_txn_batch_item_cb, NULL) != 0) {
+            return true;
+        }
+        // Could not send: count it and move on to the next item
+        if (cat_txn_batch_account(CAT_TXN_SEND_FAILED)) {
+            return false;
+        }
+    }
+}
+
+static void cat_txn_batch_item_cb(cat_txn_result_t result, const char *answer, void *user_data) {
+    (void)answer;
+    (void)user_data;
+    if (!cat_txn_batch_account(result)) {
+        cat_txn_batch_send_next();
+    }
+}
+
+esp_err_t cat_txn_batch_start(size_t count, uint8_t window, cat_txn_batch_query_fn make_query,
+                              uint32_t timeout_ms, cat_txn_batch_done_cb_t done_cb, void *user_data) {
+    if (count == 0 || window == 0 || make_query == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    taskENTER_CRITICAL(&s_txn_lock);
+    if (s_batch.active) {
+        taskEXIT_CRITICAL(&s_txn_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_batch.active = true;
+    s_batch.count = count;
+    s_batch.next = 0;
+    s_batch.answered = 0;
+    s_batch.failed = 0;
+    s_batch.timeout_ms = timeout_ms;
+    s_batch.make_query = make_query;
+    s_batch.done_cb = done_cb;
+    s_batch.user_data = user_data;
+    taskEXIT_CRITICAL(&s_txn_lock);
+
+    ESP_LOGD(TAG, "Batch of %u queries started (window %u)", (unsigned)count, window);
+    for (uint8_t i = 0; i < window; i++) {
+        if (!cat_txn_batch_send_next()) {
+            break;
+        }
+    }
+    return ESP_OK;
+}
+
+bool cat_txn_batch_active(void) {
+    return s_batch.active;
+}
+
+void cat_txn_log_stats(void) {
+    taskENTER_CRITICAL(&s_txn_lock);
+    uint32_t submitted = s_stats.submitted;
+    uint32_t answered = s_stats.answered;
+    uint32_t timeouts = s_stats.timeouts;
+    uint32_t send_failed = s_stats.send_failed;
+    uint32_t pool_full = s_stats.pool_full;
+    uint64_t latency_sum_us = s_stats.latency_sum_us;
+    uint32_t latency_max_us = s_stats.latency_max_us;
+    uint32_t active = s_active_count;
+    taskEXIT_CRITICAL(&s_txn_lock);
+
+    ESP_LOGI(TAG, "Transactions: %lu submitted, %lu answered, %lu timed out, %lu send failed, %lu pool full, %lu active, "
+             "latency avg %lu us max %lu us",
+             (unsigned long)submitted, (unsigned long)answered, (unsigned long)timeouts,
+             (unsigned long)send_failed, (unsigned long)pool_full, (unsigned long)active,
+             (unsigned long)(answered ? latency_sum_us / answered : 0), (unsigned long)latency_max_us);
+}
@@ -0,0 +1,157 @@
+/**
+ * @file cat_transaction.h
+ * @brief Request/response transactions on top of the CAT TX queue
+ *
+ * A transaction sends one query and is completed by the first received frame
+ * that starts with its match prefix, or by its timeout. Completion is reported
+ * through a callback or by waiting on the returned handle. Answers are still
+ * handed to parse_cat_command as usual, so radio state and subjects update
+ * exactly as for untracked queries.
+ */
+#ifndef CAT_TRANSACTION_H
+#define CAT_TRANSACTION_H
+
+#include "esp_err.h"
+#include "uart.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CAT_TXN_MAX_PENDING 16      ///< Concurrent transactions (pool size)
+#define CAT_TXN_ANSWER_SIZE CAT_FRAME_MAX_LEN  ///< Matches the parser's frame buffer
+#define CAT_TXN_QUERY_SIZE 64       ///< Batch queries are short reads
+#define CAT_TXN_DEFAULT_TIMEOUT_MS 500
+
+/**
+ * @brief Transaction outcome
+ */
+typedef enum {
+    CAT_TXN_OK = 0,         ///< Matching answer received
+    CAT_TXN_TIMEOUT,        ///< No matching answer before the deadline
+    CAT_TXN_SEND_FAILED,    ///< Query could not be queued for transmit
+} cat_txn_result_t;
+
+/**
+ * @brief Opaque transaction handle, 0 is invalid
+ */
+typedef uint32_t cat_txn_handle_t;
+
+/**
+ * @brief Completion callback
+ *
+ * Runs in the CAT parser task, for answers and timeouts alike. Keep it
+ * short; use lv_async_call() or the subject updater to reach the UI.
+ *
+ * @param result    Outcome of the transaction
+ * @param answer    Received frame without terminator, or NULL if not CAT_TXN_OK
+ * @param user_data Pointer passed to cat_txn_submit()
+ */
+typedef void (*cat_txn_cb_t)(cat_txn_result_t result, const char *answer, void *user_data);
+
+/**
+ * @brief Batch query generator
+ *
+ * @param index Item index, 0 .. count-1
+ * @param query Buffer receiving the query, including ';'
+ * @param size  Size of query buffer
+ */
+typedef void (*cat_txn_batch_query_fn)(size_t index, char *query, size_t size);
+
+/**
+ * @brief Batch completion callback
+ *
+ * @param answered  Items completed with CAT_TXN_OK
+ * @param failed    Items that timed out or could not be sent
+ * @param user_data Pointer passed to cat_txn_batch_start()
+ */
+typedef void (*cat_txn_batch_done_cb_t)(size_t answered, size_t failed, void *user_data);
+
+/**
+ * @brief Initialize the transaction pool
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t cat_txn_init(void);
+
+/**
+ * @brief Send a query and track its answer
+ *
+ * With a callback the slot is released after the callback returns. Without
+ * one the caller must collect the result with cat_txn_wait().
+ *
+ * @param query      Query to send, e.g. "MR0123;"
+ * @param match      Answer prefix; NULL uses the query without its ';'
+ * @param timeout_ms Time allowed for the answer
+ * @param cb         Completion callback, or NULL to wait on the handle
+ * @param user_data  Passed to cb
+ * @return Handle, or 0 if the pool is full or the query could not be sent
+ */
+cat_txn_handle_t cat_txn_submit(const char *query, const char *match, uint32_t timeout_ms,
+                                cat_txn_cb_t cb, void *user_data);
+
+/**
+ * @brief Block until a callback-less transaction completes
+ *
+ * Not for use from the LVGL task.
+ *
+ * @param handle      Handle from cat_txn_submit() with cb == NULL
+ * @param answer      Buffer receiving the answer (may be NULL)
+ * @param answer_size Size of answer buffer
+ * @return Transaction outcome
+ */
+cat_txn_result_t cat_txn_wait(cat_txn_handle_t handle, char *answer, size_t answer_size);
+
+/**
+ * @brief Run a series of queries with a bounded number in flight
+ *
+ * The next query is sent as soon as an earlier one completes, so a batch of
+ * reads is paced by the radio's answers instead of fixed delays.
+ *
+ * @param count      Number of queries
+ * @param window     Maximum queries outstanding at once
+ * @param make_query Generates query for each index
+ * @param timeout_ms Per-query timeout
+ * @param done_cb    Called once after every item has completed
+ * @param user_data  Passed to done_cb
+ * @return ESP_OK if started, ESP_ERR_INVALID_STATE if a batch is already running
+ */
+esp_err_t cat_txn_batch_start(size_t count, uint8_t window, cat_txn_batch_query_fn make_query,
+                              uint32_t timeout_ms, cat_txn_batch_done_cb_t done_cb, void *user_data);
+
+/**
+ * @brief Check whether a batch is currently running
+ */
+bool cat_txn_batch_active(void);
+
+/**
+ * @brief Route a received frame to pending transactions
+ *
+ * Called by the CAT parser task for every frame, before parse_cat_command().
+ *
+ * @param answer Frame without terminator
+ */
+void cat_txn_complete(const char *answer);
+
+/**
+ * @brief Time out overdue transactions and advance a running batch
+ *
+ * Called by the CAT parser task on every loop pass (at least every 25 ms),
+ * so callbacks and the batch's follow-up queries never run in the esp_timer
+ * task, where a blocking UART write would hold up every other timer.
+ */
+void cat_txn_sweep(void);
+
+/**
+ * @brief Log transaction counters and answer latency
+ */
+void cat_txn_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CAT_TRANSACTION_H
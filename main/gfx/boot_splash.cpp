@@ -0,0 +1,151 @@
+/**
+ * @file boot_splash.cpp
+ * @brief Pre-rendered boot splash written straight into the panel framebuffer
+ */
+
+#include "boot_splash.h"
+#include "sdkconfig.h"
+
+#if CONFIG_BOOT_SPLASH
+
+#include "boot_splash_format.h"
+#include "lcd_config.h"
+#include "esp_cache.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp_lcd_panel_rgb.h"
+#elif CONFIG_IDF_TARGET_ESP32P4
+#include "esp_lcd_mipi_dsi.h"
+#endif
+
+static const char *TAG = "SPLASH";
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#define SPLASH_PANEL_W H_RES
+#define SPLASH_PANEL_H V_RES
+#define SPLASH_PANEL_FBS LCD_RGB_NUM_FBS
+// The panel is mounted upside down; LVGL or the panel driver rotates every
+// flush, so a direct framebuffer write has to as well
+#if CONFIG_S3_DISP_ROTATE_SW || CONFIG_S3_DISP_ROTATE_HW
+#define SPLASH_REVERSE 1
+#else
+#define SPLASH_REVERSE 0
+#endif
+#else
+#define SPLASH_PANEL_W DSI_LCD_H_RES
+#define SPLASH_PANEL_H DSI_LCD_V_RES
+#define SPLASH_PANEL_FBS 1
+#define SPLASH_REVERSE 0            // Stored pre-rotated to the portrait panel
+#endif
+
+#define SPLASH_PX ((uint32_t)SPLASH_PANEL_W * SPLASH_PANEL_H)
+
+#if BOOT_SPLASH_EMBEDDED
+// main/CMakeLists.txt embeds splash/splash_<layout>.bin
+#if CONFIG_IDF_TARGET_ESP32P4
+extern const uint8_t s_splash_start[] asm("_binary_splash_p4_bin_start");
+extern const uint8_t s_splash_end[] asm("_binary_splash_p4_bin_end");
+#else
+extern const uint8_t s_splash_start[] asm("_binary_splash_s3_bin_start");
+extern const uint8_t s_splash_end[] asm("_binary_splash_s3_bin_end");
+#endif
+#endif
+
+// Embedded data has no alignment guarantee, so 16-bit values are read bytewise
+static inline uint16_t read16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static bool decode(const uint8_t *src, size_t size, uint16_t *fb) {
+    const uint8_t *end = src + size;
+    uint32_t pos = 0;
+    while (src + 2 <= end && pos < SPLASH_PX) {
+        uint16_t token = read16(src);
+        src += 2;
+        uint32_t n = token & BOOT_SPLASH_COUNT_MASK;
+        if (n > SPLASH_PX - pos) return false;
+
+        if (token & BOOT_SPLASH_RUN_FLAG) {
+            if (src + 2 > end) return false;
+            uint16_t c = read16(src);
+            src += 2;
+            uint16_t *dst = SPLASH_REVERSE ? &fb[SPLASH_PX - pos - n] : &fb[pos];
+            for (uint32_t i = 0; i < n; i++) dst[i] = c;
+        } else {
+            if ((size_t)(end - src) < n * 2) return false;
+            if (SPLASH_REVERSE) {
+                for (uint32_t i = 0; i < n; i++) fb[SPLASH_PX - 1 - pos - i] = read16(src + i * 2);
+            } else {
+                memcpy(&fb[pos], src, n * 2);
+            }
+            src += n * 2;
+        }
+        pos += n;
+    }
+    return pos == SPLASH_PX;
+}
+
+esp_err_t boot_splash_show(esp_lcd_panel_handle_t panel) {
+    void *fbs[2] = {NULL, NULL};
+#if CONFIG_IDF_TARGET_ESP32S3
+    esp_err_t ret = esp_lcd_rgb_panel_get_frame_buffer(panel, SPLASH_PANEL_FBS, &fbs[0], &fbs[1]);
+#else
+    // The HX8394 driver extends the DPI panel, so its handle is the DPI panel's
+    esp_err_t ret = esp_lcd_dpi_panel_get_frame_buffer(panel, SPLASH_PANEL_FBS, &fbs[0]);
+#endif
+    if (ret != ESP_OK || fbs[0] == NULL) {
+        ESP_LOGW(TAG, "No framebuffer access: %s", esp_err_to_name(ret));
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    uint16_t *fb = (uint16_t *)fbs[0];
+    const size_t fb_size = SPLASH_PX * sizeof(uint16_t);
+    const char *shown = "blank";
+    ret = ESP_OK;
+#if BOOT_SPLASH_EMBEDDED
+    boot_splash_header_t hdr;
+    size_t image_size = (size_t)(s_splash_end - s_splash_start);
+    memset(&hdr, 0, sizeof(hdr));
+    if (image_size >= sizeof(hdr)) {
+        memcpy(&hdr, s_splash_start, sizeof(hdr));
+    }
+    if (hdr.magic != BOOT_SPLASH_MAGIC || hdr.width != SPLASH_PANEL_W || hdr.height != SPLASH_PANEL_H ||
+        hdr.data_size > image_size - sizeof(hdr)) {
+        ESP_LOGW(TAG, "Splash image does not match the %dx%d panel", SPLASH_PANEL_W, SPLASH_PANEL_H);
+        ret = ESP_ERR_INVALID_SIZE;
+    } else if (!decode(s_splash_start + sizeof(hdr), hdr.data_size, fb)) {
+        ESP_LOGW(TAG, "Splash image is corrupt");
+        ret = ESP_ERR_INVALID_SIZE;
+    } else {
+        shown = "image";
+    }
+    if (ret != ESP_OK) memset(fb, 0, fb_size);
+#else
+    memset(fb, 0, fb_size);
+#endif
+    for (int i = 1; i < SPLASH_PANEL_FBS; i++) {
+        if (fbs[i] != NULL) memcpy(fbs[i], fb, fb_size);
+    }
+    // The display DMA reads PSRAM directly, past the CPU cache
+    for (int i = 0; i < SPLASH_PANEL_FBS; i++) {
+        if (fbs[i] != NULL) {
+            esp_cache_msync(fbs[i], fb_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+        }
+    }
+    int64_t now_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "First pixels %lu ms after app start (%s, drawn in %lu us)", (unsigned long)(now_us / 1000),
+             shown, (unsigned long)(now_us - start_us));
+    return ret;
+}
+
+#else // !CONFIG_BOOT_SPLASH
+
+esp_err_t boot_splash_show(esp_lcd_panel_handle_t panel) {
+    (void)panel;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_BOOT_SPLASH
@@ -0,0 +1,38 @@
+/**
+ * @file boot_splash.h
+ * @brief Pre-rendered boot splash written straight into the panel framebuffer
+ *
+ * Optional (CONFIG_BOOT_SPLASH). Shows a neutral boot screen, generated on the
+ * host and stored compressed in flash, before LVGL exists, so the panel does
+ * not show stale or random framebuffer contents while the rest of the system
+ * initializes. LVGL's first full-screen refresh replaces it. Without an
+ * embedded image the framebuffer is cleared instead.
+ */
+#ifndef BOOT_SPLASH_H
+#define BOOT_SPLASH_H
+
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Draw the splash into the framebuffer(s) of a freshly initialized panel
+ *
+ * Call right after lcd_init(), before LVGL takes over the panel. Logs the
+ * time from app start to the splash being on screen.
+ *
+ * @param panel Panel from lcd_init()
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if the framebuffer is not accessible,
+ *         ESP_ERR_INVALID_SIZE if the image does not match the panel,
+ *         or ESP_ERR_NOT_SUPPORTED if the option is disabled
+ */
+esp_err_t boot_splash_show(esp_lcd_panel_handle_t panel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BOOT_SPLASH_H
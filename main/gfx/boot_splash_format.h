@@ -0,0 +1,41 @@
+/**
+ * @file boot_splash_format.h
+ * @brief Layout of the pre-rendered boot splash image
+ *
+ * Written by the host splash generator (host/splash_gen.cpp) to
+ * main/splash/ and embedded into the firmware by main/CMakeLists.txt. Pixels are
+ * RGB565 in the panel's scan order (the P4 image is stored rotated to the
+ * native portrait panel), run-length coded as 16-bit little-endian tokens:
+ *
+ *   token with BOOT_SPLASH_RUN_FLAG:  (token & BOOT_SPLASH_COUNT_MASK) copies of the next pixel
+ *   token without it:                 (token & BOOT_SPLASH_COUNT_MASK) literal pixels follow
+ */
+
+#ifndef BOOT_SPLASH_FORMAT_H
+#define BOOT_SPLASH_FORMAT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOT_SPLASH_MAGIC 0x50535252u   // "RRSP"
+#define BOOT_SPLASH_RUN_FLAG 0x8000u
+#define BOOT_SPLASH_COUNT_MASK 0x7FFFu
+
+/**
+ * @brief Image header, followed by data_size bytes of tokens
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t width;         ///< Panel-native width
+    uint16_t height;        ///< Panel-native height
+    uint32_t data_size;
+} boot_splash_header_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BOOT_SPLASH_FORMAT_H
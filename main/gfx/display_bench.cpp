@@ -0,0 +1,324 @@
+/**
+ * @file display_bench.cpp
+ * @brief Synthetic UI load for comparing draw-buffer / framebuffer strategies
+ *
+ * The load is fixed so that runs with different strategies (menuconfig:
+ * Display Strategy) are comparable on the same board.
+ */
+
+#include "display_bench.h"
+#include "lcd_config.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char *TAG = "DISP_BENCH";
+
+#define BENCH_RECT_COUNT 12
+#define BENCH_LABEL_PERIOD_MS 20        // Fast-changing text, like the VFO readout
+#define BENCH_FULL_REDRAW_PERIOD_MS 2000 // Screen switch
+#define BENCH_PROBE_PERIOD_US 5000      // CAT wake probe period
+#define BENCH_PROBE_PRIORITY 4          // Same as cat_parser_task (uart.cpp)
+#define BENCH_PROBE_CORE 0
+#define BENCH_PROBE_STACK_SIZE 2048
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#define BENCH_FLUSH_SYNCED LCD_RGB_AVOID_TEARING
+#if CONFIG_S3_DISP_ROTATE_SW
+#define BENCH_ROTATION_NAME "lvgl"
+#elif CONFIG_S3_DISP_ROTATE_HW
+#define BENCH_ROTATION_NAME "panel"
+#else
+#define BENCH_ROTATION_NAME "none"
+#endif
+#else
+#define BENCH_FLUSH_SYNCED false
+#endif
+
+typedef struct {
+    display_bench_result_t result;  // Copied out at the end; the hooks never see the caller's
+    int64_t refr_start_us;
+    int64_t flush_start_us;
+    int64_t wait_start_us;
+    uint32_t frame_flush_us;
+    uint32_t frame_flushes;
+    uint64_t render_total_us;
+    uint64_t flush_total_us;
+    uint64_t wait_total_us;
+    bool full_pending;              // The next rendered frame redraws the whole screen
+    uint64_t full_total_us;
+    uint64_t partial_total_us;
+} bench_state_t;
+
+// Stand-in for the CAT parser: woken from a timer, as the UART reader wakes it
+typedef struct {
+    TaskHandle_t task;
+    esp_timer_handle_t timer;
+    volatile int64_t sent_us;
+    volatile bool stop;
+    volatile bool done;
+    uint32_t wakes;
+    uint64_t total_us;
+    uint32_t max_us;
+} bench_probe_t;
+
+static bench_state_t s_bench;
+static bench_probe_t s_probe;
+
+static void bench_display_event_cb(lv_event_t *e) {
+    display_bench_result_t *r = &s_bench.result;
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_REFR_START:
+            s_bench.refr_start_us = esp_timer_get_time();
+            s_bench.frame_flush_us = 0;
+            s_bench.frame_flushes = 0;
+            break;
+        case LV_EVENT_FLUSH_START:
+            s_bench.flush_start_us = esp_timer_get_time();
+            break;
+        case LV_EVENT_FLUSH_FINISH: {
+            uint32_t us = (uint32_t)(esp_timer_get_time() - s_bench.flush_start_us);
+            s_bench.frame_flush_us += us;
+            s_bench.frame_flushes++;
+            s_bench.flush_total_us += us;
+            if (us > r->flush_max_us) r->flush_max_us = us;
+            r->flushes++;
+            if (!BENCH_FLUSH_SYNCED) r->unpaced_flushes++;
+            break;
+        }
+        case LV_EVENT_FLUSH_WAIT_START:
+            s_bench.wait_start_us = esp_timer_get_time();
+            break;
+        case LV_EVENT_FLUSH_WAIT_FINISH: {
+            uint32_t us = (uint32_t)(esp_timer_get_time() - s_bench.wait_start_us);
+            s_bench.frame_flush_us += us;
+            s_bench.wait_total_us += us;
+            r->vsync_waits++;
+            break;
+        }
+        case LV_EVENT_REFR_READY: {
+            if (s_bench.frame_flushes == 0) break; // Nothing was redrawn
+            uint32_t total_us = (uint32_t)(esp_timer_get_time() - s_bench.refr_start_us);
+            uint32_t render_us = (total_us > s_bench.frame_flush_us) ? total_us - s_bench.frame_flush_us : 0;
+            s_bench.render_total_us += render_us;
+            r->frames++;
+            if (s_bench.full_pending) {
+                s_bench.full_pending = false;
+                s_bench.full_total_us += render_us;
+                if (render_us > r->full_render_max_us) r->full_render_max_us = render_us;
+                r->full_frames++;
+            } else {
+                s_bench.partial_total_us += render_us;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void bench_label_timer_cb(lv_timer_t *timer) {
+    static uint32_t counter = 0;
+    lv_obj_t *label = (lv_obj_t *)lv_timer_get_user_data(timer);
+    counter += 10;
+    lv_label_set_text_fmt(label, "%lu.%03lu.%03lu", (unsigned long)(14 + (counter / 1000000) % 16),
+                          (unsigned long)((counter / 1000) % 1000), (unsigned long)(counter % 1000));
+}
+
+static void bench_full_redraw_timer_cb(lv_timer_t *timer) {
+    s_bench.full_pending = true;
+    lv_obj_invalidate((lv_obj_t *)lv_timer_get_user_data(timer));
+}
+
+static void bench_probe_timer_cb(void *arg) {
+    LV_UNUSED(arg);
+    s_probe.sent_us = esp_timer_get_time();
+    xTaskNotifyGive(s_probe.task);
+}
+
+static void bench_probe_task(void *arg) {
+    LV_UNUSED(arg);
+    while (!s_probe.stop) {
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100)) == 0) continue;
+        uint32_t us = (uint32_t)(esp_timer_get_time() - s_probe.sent_us);
+        s_probe.total_us += us;
+        if (us > s_probe.max_us) s_probe.max_us = us;
+        s_probe.wakes++;
+    }
+    s_probe.done = true;
+    vTaskDelete(NULL);
+}
+
+static void bench_probe_start(void) {
+    memset(&s_probe, 0, sizeof(s_probe));
+    if (xTaskCreatePinnedToCore(bench_probe_task, "bench_probe", BENCH_PROBE_STACK_SIZE, NULL,
+                                BENCH_PROBE_PRIORITY, &s_probe.task, BENCH_PROBE_CORE) != pdPASS) {
+        ESP_LOGW(TAG, "No CAT wake probe (task create failed)");
+        s_probe.task = NULL;
+        return;
+    }
+    const esp_timer_create_args_t args = {
+        .callback = bench_probe_timer_cb,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "bench_probe",
+        .skip_unhandled_events = true,
+    };
+    if (esp_timer_create(&args, &s_probe.timer) != ESP_OK) {
+        s_probe.timer = NULL;
+        return;
+    }
+    esp_timer_start_periodic(s_probe.timer, BENCH_PROBE_PERIOD_US);
+}
+
+static void bench_probe_stop(display_bench_result_t *result) {
+    if (s_probe.timer != NULL) {
+        esp_timer_stop(s_probe.timer);
+        esp_timer_delete(s_probe.timer);
+    }
+    if (s_probe.task != NULL) {
+        s_probe.stop = true;
+        while (!s_probe.done) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+    result->cat_wake_avg_us = s_probe.wakes ? (uint32_t)(s_probe.total_us / s_probe.wakes) : 0;
+    result->cat_wake_max_us = s_probe.max_us;
+}
+
+static void bench_anim_x_cb(void *obj, int32_t v) {
+    lv_obj_set_x((lv_obj_t *)obj, v);
+}
+
+static void bench_anim_bar_cb(void *obj, int32_t v) {
+    lv_bar_set_value((lv_obj_t *)obj, v, LV_ANIM_OFF);
+}
+
+static lv_obj_t *bench_build_load(lv_obj_t **label_out) {
+    int32_t w = lv_display_get_horizontal_resolution(NULL);
+    int32_t h = lv_display_get_vertical_resolution(NULL);
+
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_remove_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x292831), 0);
+
+    // Rectangles sliding across the screen at different speeds
+    for (int i = 0; i < BENCH_RECT_COUNT; i++) {
+        lv_obj_t *rect = lv_obj_create(scr);
+        lv_obj_remove_style_all(rect);
+        lv_obj_set_size(rect, w / 14, h / 14);
+        lv_obj_set_style_bg_opa(rect, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(rect, lv_palette_main((lv_palette_t)(i % LV_PALETTE_LAST)), 0);
+        lv_obj_set_style_radius(rect, 6, 0);
+        lv_obj_set_y(rect, (h / 2) + (i * h / 2) / BENCH_RECT_COUNT - h / 14);
+
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, rect);
+        lv_anim_set_exec_cb(&a, bench_anim_x_cb);
+        lv_anim_set_values(&a, 0, w - w / 14);
+        lv_anim_set_duration(&a, 1000 + i * 150);
+        lv_anim_set_playback_duration(&a, 1000 + i * 150);
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        lv_anim_start(&a);
+    }
+
+    // Meter-like bar
+    lv_obj_t *bar = lv_bar_create(scr);
+    lv_obj_set_size(bar, w * 3 / 4, h / 20);
+    lv_obj_align(bar, LV_ALIGN_TOP_MID, 0, h / 20);
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, bar);
+    lv_anim_set_exec_cb(&a, bench_anim_bar_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_duration(&a, 400);
+    lv_anim_set_playback_duration(&a, 700);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+
+    // Frequency-like text
+    lv_obj_t *label = lv_label_create(scr);
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, h / 6);
+    lv_label_set_text_static(label, "14.000.000");
+
+    *label_out = label;
+    return scr;
+}
+
+esp_err_t display_bench_run(lv_display_t *disp, uint32_t duration_ms, display_bench_result_t *result) {
+    if (disp == NULL || result == NULL) return ESP_ERR_INVALID_ARG;
+
+    memset(result, 0, sizeof(*result));
+    memset(&s_bench, 0, sizeof(s_bench));
+
+    lv_obj_t *prev_scr = NULL;
+    lv_obj_t *scr = NULL;
+    lv_timer_t *label_timer = NULL;
+    lv_timer_t *redraw_timer = NULL;
+
+    if (!lvgl_port_lock(1000)) return ESP_ERR_TIMEOUT;
+    prev_scr = lv_display_get_screen_active(disp);
+    lv_obj_t *label = NULL;
+    scr = bench_build_load(&label);
+    lv_screen_load(scr);
+    label_timer = lv_timer_create(bench_label_timer_cb, BENCH_LABEL_PERIOD_MS, label);
+    redraw_timer = lv_timer_create(bench_full_redraw_timer_cb, BENCH_FULL_REDRAW_PERIOD_MS, scr);
+    lv_display_add_event_cb(disp, bench_display_event_cb, LV_EVENT_ALL, NULL);
+    int64_t start_us = esp_timer_get_time();
+    lvgl_port_unlock();
+
+    bench_probe_start();
+    vTaskDelay(pdMS_TO_TICKS(duration_ms));
+    bench_probe_stop(&s_bench.result);
+
+    // The hooks, timers and load screen must not outlive the run, so wait for the lock
+    while (!lvgl_port_lock(1000)) {
+        ESP_LOGW(TAG, "LVGL lock timeout ending benchmark, retrying");
+    }
+    lv_display_remove_event_cb_with_user_data(disp, bench_display_event_cb, NULL);
+    *result = s_bench.result;
+    result->duration_ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+    lv_timer_delete(label_timer);
+    lv_timer_delete(redraw_timer);
+    if (prev_scr != NULL) lv_screen_load(prev_scr);
+    lv_obj_delete(scr); // Also removes the animations bound to its children
+    lvgl_port_unlock();
+
+    uint32_t frames = result->frames ? result->frames : 1;
+    uint32_t flushes = result->flushes ? result->flushes : 1;
+    uint32_t waits = result->vsync_waits ? result->vsync_waits : 1;
+    result->fps_x10 = result->duration_ms ? (result->frames * 10000) / result->duration_ms : 0;
+    result->render_avg_us = (uint32_t)(s_bench.render_total_us / frames);
+    result->flush_avg_us = (uint32_t)(s_bench.flush_total_us / flushes);
+    result->vsync_wait_avg_us = (uint32_t)(s_bench.wait_total_us / waits);
+    uint32_t partial_frames = result->frames - result->full_frames;
+    result->full_render_avg_us = result->full_frames ? (uint32_t)(s_bench.full_total_us / result->full_frames) : 0;
+    result->partial_render_avg_us = partial_frames ? (uint32_t)(s_bench.partial_total_us / partial_frames) : 0;
+
+#if CONFIG_IDF_TARGET_ESP32S3
+    ESP_LOGI(TAG, "Strategy %s: %d buffer lines%s, bounce %d lines, rotation %s",
+             LCD_DISPLAY_STRATEGY_NAME, LVGL_DRAW_BUF_LINES, LVGL_DRAW_DOUBLE_BUFFER ? " x2" : "",
+             LCD_RGB_BOUNCE_BUFFER_HEIGHT, BENCH_ROTATION_NAME);
+#endif
+    ESP_LOGI(TAG, "%lu frames in %lu ms: %lu.%lu FPS, render %lu us/frame",
+             (unsigned long)result->frames, (unsigned long)result->duration_ms,
+             (unsigned long)(result->fps_x10 / 10), (unsigned long)(result->fps_x10 % 10),
+             (unsigned long)result->render_avg_us);
+    ESP_LOGI(TAG, "Flush: %lu calls, avg %lu us, max %lu us; vsync waits %lu (avg %lu us); unpaced %lu",
+             (unsigned long)result->flushes, (unsigned long)result->flush_avg_us,
+             (unsigned long)result->flush_max_us, (unsigned long)result->vsync_waits,
+             (unsigned long)result->vsync_wait_avg_us, (unsigned long)result->unpaced_flushes);
+    ESP_LOGI(TAG, "%d draw unit(s): full redraw %lu frames, avg %lu us, max %lu us; partial avg %lu us",
+             LV_DRAW_SW_DRAW_UNIT_CNT, (unsigned long)result->full_frames, (unsigned long)result->full_render_avg_us,
+             (unsigned long)result->full_render_max_us, (unsigned long)result->partial_render_avg_us);
+    ESP_LOGI(TAG, "CAT wake latency (prio %d, core %d): %lu wakes, avg %lu us, max %lu us", BENCH_PROBE_PRIORITY,
+             BENCH_PROBE_CORE, (unsigned long)s_probe.wakes, (unsigned long)result->cat_wake_avg_us,
+             (unsigned long)result->cat_wake_max_us);
+    return ESP_OK;
+}
@@ -0,0 +1,49 @@
+#ifndef DISPLAY_BENCH_H
+#define DISPLAY_BENCH_H
+
+#include "esp_err.h"
+#include "lvgl.h"
+#include <stdint.h>
+
+/**
+ * @brief Display benchmark results for one run
+ */
+typedef struct {
+    uint32_t duration_ms;
+    uint32_t frames;            ///< Refreshes that rendered something
+    uint32_t fps_x10;           ///< Frames per second x10
+    uint32_t render_avg_us;     ///< Refresh time excluding flush, per frame
+    uint32_t flush_avg_us;      ///< flush_cb duration per call
+    uint32_t flush_max_us;
+    uint32_t flushes;           ///< flush_cb calls
+    uint32_t vsync_waits;       ///< Flushes that waited for a framebuffer swap (tear-free modes)
+    uint32_t vsync_wait_avg_us;
+    uint32_t unpaced_flushes;   ///< Flushes in a strategy without VSYNC pacing: all of them, or 0 if tear-free
+    uint32_t full_frames;       ///< Frames redrawing the whole screen (screen switch)
+    uint32_t full_render_avg_us;
+    uint32_t full_render_max_us;
+    uint32_t partial_render_avg_us; ///< Frames redrawing only the animated objects
+    uint32_t cat_wake_avg_us;   ///< Wake latency of a task at CAT parser priority on core 0
+    uint32_t cat_wake_max_us;
+} display_bench_result_t;
+
+/**
+ * @brief Drive a synthetic UI load on a temporary screen and measure the display path
+ *
+ * Alongside the load, a probe task with the CAT parser's priority and core is
+ * woken periodically from a timer, as the UART reader wakes the parser, and its
+ * wake latency is recorded: this shows how much rendering (e.g. a draw unit on
+ * core 0) delays CAT handling.
+ *
+ * Runs from a normal task (not the LVGL task): takes the LVGL lock to build and
+ * tear down the load, and sleeps while the LVGL task renders. The previously
+ * active screen is restored afterwards.
+ *
+ * @param disp        Display to measure
+ * @param duration_ms Measurement time
+ * @param result      Filled with the measurements
+ * @return ESP_OK, or ESP_ERR_TIMEOUT if the LVGL lock could not be taken to start
+ */
+esp_err_t display_bench_run(lv_display_t *disp, uint32_t duration_ms, display_bench_result_t *result);
+
+#endif // DISPLAY_BENCH_H
@@ -0,0 +1,411 @@
+/**
+ * @file display_mirror.cpp
+ * @brief Streams the screen's dirty rectangles to a TCP client
+ */
+
+#include "display_mirror.h"
+#include "sdkconfig.h"
+
+#if CONFIG_DISPLAY_MIRROR
+
+#include "display_mirror_format.h"
+#include "mirror_codec.h"
+#include "lcd_config.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+#include "lvgl_private.h"    // lv_area_intersect, lv_area_join
+#include <string.h>
+
+static const char *TAG = "MIRROR";
+
+#define MIRROR_SLOT_SIZE (CONFIG_DISPLAY_MIRROR_BUFFER_KB * 1024)
+#define MIRROR_PENDING_MAX 8            // Areas awaiting a full resend; more are merged
+#define MIRROR_TASK_STACK_SIZE 3072
+#define MIRROR_TASK_PRIORITY 2          // Below the CAT tasks on core 0
+#define MIRROR_SEND_TIMEOUT_S 3         // A client this far behind is dropped
+#define MIRROR_REPORT_INTERVAL_MS 10000
+
+#if CONFIG_IDF_TARGET_ESP32S3 && CONFIG_S3_DISP_DIRECT_PSRAM
+#define MIRROR_DIRECT_MODE 1            // Flushed areas sit at their screen position in a full frame
+#else
+#define MIRROR_DIRECT_MODE 0            // Flushed areas start at the draw buffer's origin
+#endif
+
+typedef struct {
+    uint8_t *data;          // Frame header, then rectangles
+    size_t len;
+    uint16_t rects;
+} mirror_slot_t;
+
+// ============================================================================
+// State
+// ============================================================================
+
+static lv_display_t *s_disp = NULL;
+static TaskHandle_t s_task = NULL;
+static uint16_t *s_shadow = NULL;      // Screen contents as last sent or queued for resend
+static mirror_slot_t s_slots[2];
+static uint8_t s_fill = 0;              // Slot the LVGL task codes into
+
+// Connection state changes under the LVGL lock, so they never land mid-frame
+static volatile bool s_connected = false;
+static bool s_resync = false;           // Next frame codes the whole screen without skips
+static uint32_t s_seq = 0;
+
+// Handoff of a finished slot to the server task
+static portMUX_TYPE s_slot_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool s_send_busy = false;
+static uint8_t s_send_slot = 0;
+
+// Frame being coded (LVGL task only)
+static bool s_frame_live = false;       // Coding into the fill slot
+static bool s_frame_key = false;        // Without skips
+static bool s_frame_flushed = false;
+static uint16_t s_dropped = 0;          // Since the last frame sent
+static lv_area_t s_pending[MIRROR_PENDING_MAX];
+static uint8_t s_pending_count = 0;
+
+// Statistics, read by the server task for its report
+static volatile uint32_t s_stat_code_us = 0;
+static volatile uint32_t s_stat_coded = 0;
+static volatile uint32_t s_stat_dropped = 0;
+
+// ============================================================================
+// Coding (LVGL task)
+// ============================================================================
+
+static void shadow_copy(const lv_area_t *a, const uint16_t *src, size_t src_stride) {
+    int32_t w = lv_area_get_width(a);
+    for (int32_t y = a->y1; y <= a->y2; y++) {
+        memcpy(&s_shadow[y * H_RES + a->x1], src, w * sizeof(uint16_t));
+        src += src_stride;
+    }
+}
+
+static void pending_add(const lv_area_t *a) {
+    for (uint8_t i = 0; i < s_pending_count; i++) {
+        if (lv_area_is_in(a, &s_pending[i], 0)) return;
+    }
+    if (s_pending_count < MIRROR_PENDING_MAX) {
+        s_pending[s_pending_count++] = *a;
+        return;
+    }
+    // Merge into the area whose bounding box grows least
+    uint8_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < s_pending_count; i++) {
+        lv_area_t u;
+        lv_area_join(&u, &s_pending[i], a);
+        uint32_t growth = lv_area_get_size(&u) - lv_area_get_size(&s_pending[i]);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    lv_area_join(&s_pending[best], &s_pending[best], a);
+}
+
+// Appends a rectangle to the fill slot; false if it does not fit
+static bool slot_add_rect(const lv_area_t *a, const uint16_t *src, size_t src_stride, bool delta) {
+    mirror_slot_t *slot = &s_slots[s_fill];
+    if (slot->len + sizeof(mirror_rect_header_t) >= MIRROR_SLOT_SIZE) return false;
+    uint8_t *out = slot->data + slot->len + sizeof(mirror_rect_header_t);
+    size_t cap = MIRROR_SLOT_SIZE - slot->len - sizeof(mirror_rect_header_t);
+    uint16_t w = (uint16_t)lv_area_get_width(a);
+    uint16_t h = (uint16_t)lv_area_get_height(a);
+    uint16_t *shadow = delta ? &s_shadow[a->y1 * H_RES + a->x1] : NULL;
+    size_t n = mirror_encode_rect(src, src_stride, shadow, H_RES, w, h, out, cap);
+    if (n == 0) return false;
+
+    mirror_rect_header_t rh = {(uint16_t)a->x1, (uint16_t)a->y1, w, h, (uint32_t)n};
+    memcpy(slot->data + slot->len, &rh, sizeof(rh));
+    slot->len += sizeof(rh) + n;
+    slot->rects++;
+    return true;
+}
+
+static void on_flush_start(const lv_area_t *area) {
+    lv_area_t a;
+    const lv_area_t screen = {0, 0, H_RES - 1, V_RES - 1};
+    if (!lv_area_intersect(&a, area, &screen)) return;
+
+    lv_draw_buf_t *buf = lv_display_get_buf_active(s_disp);
+    if (buf == NULL) return;
+#if MIRROR_DIRECT_MODE
+    size_t stride = buf->header.stride / sizeof(uint16_t);
+    const uint16_t *src = (const uint16_t *)buf->data + a.y1 * stride + a.x1;
+#else
+    size_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_RGB565) / sizeof(uint16_t);
+    const uint16_t *src = (const uint16_t *)buf->data + (a.y1 - area->y1) * stride + (a.x1 - area->x1);
+#endif
+    s_frame_flushed = true;
+
+    if (s_frame_live && slot_add_rect(&a, src, stride, !s_frame_key)) {
+        if (s_frame_key) shadow_copy(&a, src, stride);
+        return;
+    }
+    // Not sent in this frame: remember the contents and resend them in full later
+    shadow_copy(&a, src, stride);
+    pending_add(&a);
+}
+
+// Codes as much of the pending areas as fits, in row bands from the top
+static void code_pending(void) {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < s_pending_count; i++) {
+        lv_area_t a = s_pending[i];
+        int32_t rows = lv_area_get_height(&a);
+        while (rows > 0 && a.y1 <= a.y2) {
+            lv_area_t band = a;
+            band.y2 = a.y1 + rows - 1;
+            if (slot_add_rect(&band, &s_shadow[band.y1 * H_RES + band.x1], H_RES, false)) {
+                a.y1 = band.y2 + 1;
+                rows = lv_area_get_height(&a);
+            } else {
+                rows /= 2;
+            }
+        }
+        if (a.y1 <= a.y2) s_pending[kept++] = a;
+    }
+    s_pending_count = kept;
+}
+
+static void on_refr_start(void) {
+    bool busy;
+    portENTER_CRITICAL(&s_slot_lock);
+    busy = s_send_busy;
+    portEXIT_CRITICAL(&s_slot_lock);
+
+    s_frame_live = s_connected && !busy;
+    s_frame_key = s_frame_live && s_resync;
+    s_frame_flushed = false;
+    if (s_frame_key) {
+        // The whole screen was invalidated on connect and is coded afresh
+        s_resync = false;
+        s_pending_count = 0;
+        s_dropped = 0;
+    }
+    s_slots[s_fill].len = sizeof(mirror_frame_header_t);
+    s_slots[s_fill].rects = 0;
+}
+
+static void on_refr_ready(void) {
+    if (!s_connected) return;
+    if (!s_frame_live) {
+        if (s_frame_flushed) {
+            s_dropped++;
+            s_stat_dropped++;
+        }
+        return;
+    }
+    code_pending();
+
+    mirror_slot_t *slot = &s_slots[s_fill];
+    if (slot->rects == 0) return;
+    mirror_frame_header_t fh = {};
+    fh.magic = MIRROR_FRAME_MAGIC;
+    fh.seq = s_seq++;
+    fh.timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    fh.width = H_RES;
+    fh.height = V_RES;
+    fh.rect_count = slot->rects;
+    fh.dropped = s_dropped;
+    fh.payload_size = (uint32_t)(slot->len - sizeof(fh));
+    memcpy(slot->data, &fh, sizeof(fh));
+    s_dropped = 0;
+    s_stat_coded++;
+
+    portENTER_CRITICAL(&s_slot_lock);
+    s_send_slot = s_fill;
+    s_send_busy = true;
+    portEXIT_CRITICAL(&s_slot_lock);
+    s_fill ^= 1;
+    xTaskNotifyGive(s_task);
+}
+
+static void display_event_cb(lv_event_t *e) {
+    if (!s_connected) return;
+    int64_t start_us = esp_timer_get_time();
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_REFR_START:
+            on_refr_start();
+            break;
+        case LV_EVENT_FLUSH_START: {
+            const lv_area_t *area = (const lv_area_t *)lv_event_get_param(e);
+            if (area != NULL) on_flush_start(area);
+            break;
+        }
+        case LV_EVENT_REFR_READY:
+            on_refr_ready();
+            break;
+        default:
+            break;
+    }
+    s_stat_code_us += (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+// ============================================================================
+// Server task
+// ============================================================================
+
+static int mirror_listen(void) {
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+    if (fd < 0) return -1;
+    int opt = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(CONFIG_DISPLAY_MIRROR_PORT);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, 1) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool send_all(int fd, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        int n = send(fd, data, len, 0);
+        if (n <= 0) return false;
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Connection changes take the LVGL lock so the event handler sees them between frames
+static void set_connected(bool connected) {
+    while (!lvgl_port_lock(1000)) {
+        ESP_LOGW(TAG, "Waiting for the LVGL lock");
+    }
+    s_connected = connected;
+    portENTER_CRITICAL(&s_slot_lock);
+    s_send_busy = false;
+    portEXIT_CRITICAL(&s_slot_lock);
+    ulTaskNotifyValueClear(NULL, UINT32_MAX);
+    if (connected) {
+        s_resync = true;
+        s_seq = 0;
+        lv_obj_invalidate(lv_display_get_screen_active(s_disp));
+    }
+    lvgl_port_unlock();
+}
+
+static void report(uint32_t elapsed_ms, uint32_t frames, uint32_t bytes) {
+    uint32_t coded = s_stat_coded;
+    uint32_t code_us = s_stat_code_us;
+    uint32_t dropped = s_stat_dropped;
+    s_stat_coded = 0;
+    s_stat_code_us = 0;
+    s_stat_dropped = 0;
+    // code_us includes the shadow copies of dropped frames, so it is the whole LVGL-task cost
+    ESP_LOGI(TAG, "%lu frames sent, %lu dropped, %lu kB/s, %lu us/frame coding (%lu.%lu%% of a core)",
+             (unsigned long)frames, (unsigned long)dropped, (unsigned long)(bytes / elapsed_ms),
+             (unsigned long)(coded ? code_us / coded : 0), (unsigned long)(code_us / (elapsed_ms * 10)),
+             (unsigned long)((code_us / elapsed_ms) % 10));
+}
+
+static void mirror_task(void *arg) {
+    LV_UNUSED(arg);
+    int listen_fd = -1;
+    while ((listen_fd = mirror_listen()) < 0) {
+        ESP_LOGW(TAG, "Cannot listen on port %d, retrying", CONFIG_DISPLAY_MIRROR_PORT);
+        vTaskDelay(pdMS_TO_TICKS(5000));
+    }
+    ESP_LOGI(TAG, "Listening on port %d", CONFIG_DISPLAY_MIRROR_PORT);
+
+    while (true) {
+        struct sockaddr_in peer = {};
+        socklen_t peer_len = sizeof(peer);
+        int fd = accept(listen_fd, (struct sockaddr *)&peer, &peer_len);
+        if (fd < 0) {
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            continue;
+        }
+        int opt = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+        struct timeval timeout = {MIRROR_SEND_TIMEOUT_S, 0};
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        char peer_ip[16];
+        inet_ntop(AF_INET, &peer.sin_addr, peer_ip, sizeof(peer_ip));
+        ESP_LOGI(TAG, "Client %s connected", peer_ip);
+        set_connected(true);
+
+        int64_t report_start_us = esp_timer_get_time();
+        uint32_t frames = 0, bytes = 0;
+        while (true) {
+            if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)) > 0) {
+                const mirror_slot_t *slot = &s_slots[s_send_slot];
+                if (!send_all(fd, slot->data, slot->len)) break;
+                frames++;
+                bytes += slot->len;
+                portENTER_CRITICAL(&s_slot_lock);
+                s_send_busy = false;
+                portEXIT_CRITICAL(&s_slot_lock);
+            }
+            uint32_t elapsed_ms = (uint32_t)((esp_timer_get_time() - report_start_us) / 1000);
+            if (elapsed_ms >= MIRROR_REPORT_INTERVAL_MS) {
+                report(elapsed_ms, frames, bytes);
+                report_start_us = esp_timer_get_time();
+                frames = 0;
+                bytes = 0;
+            }
+        }
+
+        set_connected(false);
+        close(fd);
+        ESP_LOGI(TAG, "Client %s disconnected", peer_ip);
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+esp_err_t display_mirror_init(lv_display_t *disp) {
+    if (disp == NULL) return ESP_ERR_INVALID_ARG;
+    if (s_task != NULL) return ESP_OK;
+
+    s_shadow = (uint16_t *)heap_caps_malloc((size_t)H_RES * V_RES * sizeof(uint16_t),
+                                            MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    for (int i = 0; i < 2; i++) {
+        s_slots[i].data = (uint8_t *)heap_caps_malloc(MIRROR_SLOT_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (s_shadow == NULL || s_slots[0].data == NULL || s_slots[1].data == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate buffers");
+        heap_caps_free(s_shadow);
+        heap_caps_free(s_slots[0].data);
+        heap_caps_free(s_slots[1].data);
+        s_shadow = NULL;
+        s_slots[0].data = s_slots[1].data = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_disp = disp;
+    if (xTaskCreatePinnedToCore(mirror_task, "mirror", MIRROR_TASK_STACK_SIZE, NULL, MIRROR_TASK_PRIORITY, &s_task,
+                                0) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create server task");
+        return ESP_FAIL;
+    }
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_REFR_READY, NULL);
+
+    ESP_LOGI(TAG, "Mirroring %dx%d, 2 x %d KB frame buffers", H_RES, V_RES, CONFIG_DISPLAY_MIRROR_BUFFER_KB);
+    return ESP_OK;
+}
+
+#else // !CONFIG_DISPLAY_MIRROR
+
+esp_err_t display_mirror_init(lv_display_t *disp) {
+    LV_UNUSED(disp);
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_DISPLAY_MIRROR
@@ -0,0 +1,41 @@
+/**
+ * @file display_mirror.h
+ * @brief Streams the screen's dirty rectangles to a TCP client
+ *
+ * Optional (CONFIG_DISPLAY_MIRROR). Every area LVGL flushes to the panel is
+ * coded against the previous screen contents (mirror_codec.h) into one of two
+ * frame buffers in PSRAM; a low-priority task sends finished frames to a
+ * single client (host/mirror_client.cpp). The LVGL task never waits for the
+ * network: a frame that starts while the previous one is still being sent is
+ * dropped and its areas resent in full later. Costs nothing while no client
+ * is connected.
+ *
+ * Stream layout in display_mirror_format.h.
+ */
+#ifndef DISPLAY_MIRROR_H
+#define DISPLAY_MIRROR_H
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hook the display's flush events and start listening for a client
+ *
+ * Call with the LVGL lock held, after the network stack is initialized.
+ *
+ * @param disp Display to mirror
+ * @return ESP_OK, ESP_ERR_NO_MEM if the buffers cannot be allocated,
+ *         ESP_FAIL if the server task cannot be started,
+ *         or ESP_ERR_NOT_SUPPORTED if the option is disabled
+ */
+esp_err_t display_mirror_init(lv_display_t *disp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_MIRROR_H
@@ -0,0 +1,60 @@
+/**
+ * @file display_mirror_format.h
+ * @brief Stream layout of the display mirror
+ *
+ * The firmware (display_mirror.cpp) accepts one TCP client and sends it a
+ * stream of frames; the client only reads. Each frame is a header followed by
+ * rect_count rectangles, each a rectangle header followed by data_size bytes
+ * coded as described in mirror_codec.h. Rectangles are applied in order.
+ * Coordinates are in the UI's orientation (800x480 or 1280x720), whatever the
+ * panel's mounting.
+ *
+ * The first frame after connecting covers the whole screen without skips.
+ * Frames the client could not take in time are dropped on the device and
+ * their areas resent in full in a later frame, so skips in a frame are always
+ * relative to the frames the client actually received.
+ *
+ * Integers are little-endian.
+ */
+
+#ifndef DISPLAY_MIRROR_FORMAT_H
+#define DISPLAY_MIRROR_FORMAT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MIRROR_FRAME_MAGIC 0x464D5252u  // "RRMF"
+
+/**
+ * @brief Frame header
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;               ///< Frames sent on this connection
+    uint32_t timestamp_ms;      ///< Device uptime when the frame was rendered
+    uint16_t width;             ///< Screen size
+    uint16_t height;
+    uint16_t rect_count;
+    uint16_t dropped;           ///< Frames dropped since the previous one sent
+    uint32_t payload_size;      ///< Bytes of rectangles following this header
+} mirror_frame_header_t;
+
+/**
+ * @brief Rectangle header, followed by data_size bytes of tokens
+ */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint32_t data_size;
+} mirror_rect_header_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_MIRROR_FORMAT_H
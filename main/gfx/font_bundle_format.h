@@ -0,0 +1,93 @@
+/**
+ * @file font_bundle_format.h
+ * @brief Binary layout of the font bundle stored on the storage partition
+ *
+ * Written by host/font_pack.cpp from the generated fonts in main/ui/fonts and
+ * read by font_store.cpp. The bundle keeps the glyph descriptors, bitmaps,
+ * character maps and kerning tables of each font exactly as the generated C
+ * arrays hold them; only the small descriptors that hold pointers are stored
+ * as offsets and rebuilt at boot.
+ *
+ * All offsets are in bytes from the start of the bundle, 0 means absent.
+ * Integers are little-endian, as on both the host and the targets.
+ */
+
+#ifndef FONT_BUNDLE_FORMAT_H
+#define FONT_BUNDLE_FORMAT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FONT_BUNDLE_MAGIC 0x46445252u   // "RRDF"
+#define FONT_BUNDLE_VERSION 1
+#define FONT_BUNDLE_NAME_LEN 32
+#define FONT_BUNDLE_ALIGN 8             // Every table starts on this boundary
+
+/**
+ * @brief Bundle header, at offset 0
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t font_count;
+    uint32_t total_size;        ///< Bundle size including this header
+    uint32_t glyph_dsc_size;    ///< sizeof(lv_font_fmt_txt_glyph_dsc_t) the bundle was packed with
+} font_bundle_header_t;
+
+/**
+ * @brief Directory entry, font_count of them follow the header
+ */
+typedef struct {
+    char name[FONT_BUNDLE_NAME_LEN];    ///< Generated font name, e.g. "ui_font_Font16"
+    uint32_t font_off;                  ///< font_bundle_font_t
+} font_bundle_entry_t;
+
+/**
+ * @brief lv_font_t and lv_font_fmt_txt_dsc_t fields of one font
+ */
+typedef struct {
+    int32_t line_height;
+    int32_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint8_t subpx;
+    uint8_t bpp;
+    uint8_t bitmap_format;
+    uint8_t stride;
+    uint16_t kern_scale;
+    uint16_t cmap_num;
+    uint16_t reserved;
+    uint32_t glyph_count;       ///< Entries in the glyph descriptor table, including id 0
+    uint32_t glyph_dsc_off;     ///< lv_font_fmt_txt_glyph_dsc_t[glyph_count]
+    uint32_t bitmap_off;
+    uint32_t bitmap_size;
+    uint32_t cmaps_off;         ///< font_bundle_cmap_t[cmap_num]
+    uint32_t kern_glyph_ids_off;
+    uint32_t kern_values_off;
+    uint32_t kern_pair_cnt;     ///< 0 if the font has no kerning
+    uint8_t kern_glyph_ids_size;
+    uint8_t reserved2[3];
+} font_bundle_font_t;
+
+/**
+ * @brief lv_font_fmt_txt_cmap_t with offsets for its lists
+ */
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint32_t unicode_list_off;
+    uint32_t glyph_id_ofs_list_off;
+    uint16_t list_length;
+    uint8_t type;
+    uint8_t reserved;
+} font_bundle_cmap_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONT_BUNDLE_FORMAT_H
@@ -0,0 +1,389 @@
+/**
+ * @file font_store.cpp
+ * @brief UI fonts loaded at boot from a bundle on the storage partition
+ */
+
+#include "font_store.h"
+#include "sdkconfig.h"
+
+#if CONFIG_UI_FONTS_FROM_STORAGE
+
+#include "font_bundle_format.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include <string.h>
+#if CONFIG_UI_FONTS_BENCHMARK
+#include "esp_lvgl_port.h"
+#endif
+
+static const char *TAG = "FONT_STORE";
+
+#define FONT_STORE_PARTITION "storage"
+
+// lv_font_t and the pointer-holding descriptors of one font; tables stay in the bundle
+typedef struct {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_kern_pair_t kern;
+    char name[FONT_BUNDLE_NAME_LEN];
+} store_font_t;
+
+// One loaded bundle
+typedef struct {
+    const uint8_t *base;
+    uint32_t size;
+    store_font_t *fonts;            // Internal RAM
+    lv_font_fmt_txt_cmap_t *cmaps;  // Internal RAM, all fonts' maps
+    uint16_t count;
+    bool mapped;
+    esp_partition_mmap_handle_t map;
+} font_set_t;
+
+static font_set_t s_set;
+
+// ============================================================================
+// Loading
+// ============================================================================
+
+static bool in_bundle(uint32_t off, uint32_t size, uint32_t total) {
+    return off != 0 && off <= total && size <= total - off;
+}
+
+static uint32_t dir_offset(void) {
+    return (sizeof(font_bundle_header_t) + FONT_BUNDLE_ALIGN - 1) & ~(uint32_t)(FONT_BUNDLE_ALIGN - 1);
+}
+
+static esp_err_t read_header(const esp_partition_t **part_out, font_bundle_header_t *hdr) {
+    const esp_partition_t *part =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, FONT_STORE_PARTITION);
+    if (part == NULL) {
+        ESP_LOGE(TAG, "No \"%s\" partition", FONT_STORE_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+    esp_err_t ret = esp_partition_read(part, 0, hdr, sizeof(*hdr));
+    if (ret != ESP_OK) return ret;
+
+    if (hdr->magic != FONT_BUNDLE_MAGIC || hdr->version != FONT_BUNDLE_VERSION) {
+        ESP_LOGE(TAG, "No font bundle on \"%s\" (flash one built by host/font_pack)", FONT_STORE_PARTITION);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (hdr->glyph_dsc_size != sizeof(lv_font_fmt_txt_glyph_dsc_t) || hdr->total_size > part->size ||
+        dir_offset() + (uint32_t)hdr->font_count * sizeof(font_bundle_entry_t) > hdr->total_size) {
+        ESP_LOGE(TAG, "Font bundle does not match this build (glyph size %lu, %lu bytes)",
+                 (unsigned long)hdr->glyph_dsc_size, (unsigned long)hdr->total_size);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    *part_out = part;
+    return ESP_OK;
+}
+
+static bool build_font(font_set_t *set, const font_bundle_entry_t *entry, store_font_t *sf,
+                       lv_font_fmt_txt_cmap_t *cmaps) {
+    const uint8_t *base = set->base;
+    uint32_t total = set->size;
+    if (!in_bundle(entry->font_off, sizeof(font_bundle_font_t), total)) return false;
+    const font_bundle_font_t *rec = (const font_bundle_font_t *)(base + entry->font_off);
+
+    if (!in_bundle(rec->glyph_dsc_off, rec->glyph_count * sizeof(lv_font_fmt_txt_glyph_dsc_t), total) ||
+        !in_bundle(rec->bitmap_off, rec->bitmap_size, total) ||
+        !in_bundle(rec->cmaps_off, rec->cmap_num * sizeof(font_bundle_cmap_t), total)) {
+        return false;
+    }
+
+    const font_bundle_cmap_t *src = (const font_bundle_cmap_t *)(base + rec->cmaps_off);
+    for (uint32_t i = 0; i < rec->cmap_num; i++) {
+        lv_font_fmt_txt_cmap_t *cmap = &cmaps[i];
+        cmap->range_start = src[i].range_start;
+        cmap->range_length = src[i].range_length;
+        cmap->glyph_id_start = src[i].glyph_id_start;
+        cmap->list_length = src[i].list_length;
+        cmap->type = (lv_font_fmt_txt_cmap_type_t)src[i].type;
+        cmap->unicode_list = src[i].unicode_list_off ? (const uint16_t *)(base + src[i].unicode_list_off) : NULL;
+        cmap->glyph_id_ofs_list = src[i].glyph_id_ofs_list_off ? base + src[i].glyph_id_ofs_list_off : NULL;
+    }
+
+    lv_font_fmt_txt_dsc_t *dsc = &sf->dsc;
+    dsc->glyph_bitmap = base + rec->bitmap_off;
+    dsc->glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(base + rec->glyph_dsc_off);
+    dsc->cmaps = cmaps;
+    dsc->kern_scale = rec->kern_scale;
+    dsc->cmap_num = rec->cmap_num;
+    dsc->bpp = rec->bpp;
+    dsc->kern_classes = 0;
+    dsc->bitmap_format = rec->bitmap_format;
+    dsc->stride = rec->stride;
+    if (rec->kern_pair_cnt > 0) {
+        uint32_t id_size = rec->kern_glyph_ids_size == 0 ? 1 : 2;
+        if (!in_bundle(rec->kern_glyph_ids_off, rec->kern_pair_cnt * 2 * id_size, total) ||
+            !in_bundle(rec->kern_values_off, rec->kern_pair_cnt, total)) {
+            return false;
+        }
+        sf->kern.glyph_ids = base + rec->kern_glyph_ids_off;
+        sf->kern.values = base + rec->kern_values_off;
+        sf->kern.pair_cnt = rec->kern_pair_cnt;
+        sf->kern.glyph_ids_size = rec->kern_glyph_ids_size;
+        dsc->kern_dsc = &sf->kern;
+    }
+
+    lv_font_t *font = &sf->font;
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->line_height = rec->line_height;
+    font->base_line = rec->base_line;
+    font->subpx = rec->subpx;
+    font->underline_position = rec->underline_position;
+    font->underline_thickness = rec->underline_thickness;
+    font->dsc = dsc;
+
+    memcpy(sf->name, entry->name, FONT_BUNDLE_NAME_LEN);
+    sf->name[FONT_BUNDLE_NAME_LEN - 1] = '\0';
+    return true;
+}
+
+static void free_set(font_set_t *set) {
+    heap_caps_free(set->fonts);
+    heap_caps_free(set->cmaps);
+    if (set->mapped) {
+        esp_partition_munmap(set->map);
+    } else {
+        heap_caps_free((void *)set->base);
+    }
+    memset(set, 0, sizeof(*set));
+}
+
+static esp_err_t load_set(bool mapped, font_set_t *set) {
+    const esp_partition_t *part;
+    font_bundle_header_t hdr;
+    esp_err_t ret = read_header(&part, &hdr);
+    if (ret != ESP_OK) return ret;
+
+    memset(set, 0, sizeof(*set));
+    set->size = hdr.total_size;
+    set->mapped = mapped;
+    int64_t start_us = esp_timer_get_time();
+    if (mapped) {
+        const void *ptr;
+        ret = esp_partition_mmap(part, 0, hdr.total_size, ESP_PARTITION_MMAP_DATA, &ptr, &set->map);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Cannot map the font bundle: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        set->base = (const uint8_t *)ptr;
+    } else {
+        uint8_t *copy = (uint8_t *)heap_caps_malloc(hdr.total_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (copy == NULL) {
+            ESP_LOGE(TAG, "No PSRAM for the font bundle (%lu bytes)", (unsigned long)hdr.total_size);
+            return ESP_ERR_NO_MEM;
+        }
+        ret = esp_partition_read(part, 0, copy, hdr.total_size);
+        if (ret != ESP_OK) {
+            heap_caps_free(copy);
+            return ret;
+        }
+        set->base = copy;
+    }
+    uint32_t load_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+    const font_bundle_entry_t *dir = (const font_bundle_entry_t *)(set->base + dir_offset());
+    uint32_t cmap_total = 0;
+    for (uint16_t i = 0; i < hdr.font_count; i++) {
+        if (!in_bundle(dir[i].font_off, sizeof(font_bundle_font_t), set->size)) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        cmap_total += ((const font_bundle_font_t *)(set->base + dir[i].font_off))->cmap_num;
+    }
+    if (ret == ESP_OK) {
+        set->fonts = (store_font_t *)heap_caps_calloc(hdr.font_count, sizeof(store_font_t), MALLOC_CAP_INTERNAL);
+        set->cmaps = (lv_font_fmt_txt_cmap_t *)heap_caps_calloc(cmap_total ? cmap_total : 1,
+                                                                sizeof(lv_font_fmt_txt_cmap_t), MALLOC_CAP_INTERNAL);
+        if (set->fonts == NULL || set->cmaps == NULL) ret = ESP_ERR_NO_MEM;
+    }
+
+    lv_font_fmt_txt_cmap_t *cmaps = set->cmaps;
+    for (uint16_t i = 0; ret == ESP_OK && i < hdr.font_count; i++) {
+        if (!build_font(set, &dir[i], &set->fonts[i], cmaps)) {
+            ESP_LOGE(TAG, "Font %u of the bundle is corrupt", (unsigned)i);
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        cmaps += set->fonts[i].dsc.cmap_num;
+        set->count++;
+    }
+    if (ret != ESP_OK) {
+        free_set(set);
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "%u fonts, %lu KB %s in %lu ms", (unsigned)set->count, (unsigned long)(set->size / 1024),
+             mapped ? "mapped" : "copied to PSRAM", (unsigned long)(load_us / 1000));
+    return ESP_OK;
+}
+
+static const lv_font_t *find_font(const font_set_t *set, const char *name) {
+    for (uint16_t i = 0; i < set->count; i++) {
+        if (strcmp(set->fonts[i].name, name) == 0) return &set->fonts[i].font;
+    }
+    return NULL;
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+#if CONFIG_UI_FONTS_BENCHMARK
+
+#define BENCH_CANVAS_W 480
+#define BENCH_CANVAS_H 100
+#define BENCH_ROUNDS 10
+#define BENCH_TEXT_CHARS 24
+
+// Up to BENCH_TEXT_CHARS characters the font has, from its first character map
+static void sample_text(const lv_font_t *font, char *buf, size_t size) {
+    const lv_font_fmt_txt_dsc_t *dsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_cmap_t *cmap = &dsc->cmaps[0];
+    bool sparse = cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY || cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL;
+    uint32_t n = sparse ? cmap->list_length : cmap->range_length;
+    if (n > BENCH_TEXT_CHARS) n = BENCH_TEXT_CHARS;
+
+    size_t len = 0;
+    for (uint32_t i = 0; i < n && len + 5 < size; i++) {
+        uint32_t cp = cmap->range_start + (sparse ? cmap->unicode_list[i] : i);
+        if (cp < 0x80) {
+            buf[len++] = (char)cp;
+        } else if (cp < 0x800) {
+            buf[len++] = (char)(0xC0 | (cp >> 6));
+            buf[len++] = (char)(0x80 | (cp & 0x3F));
+        } else {
+            buf[len++] = (char)(0xE0 | (cp >> 12));
+            buf[len++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+            buf[len++] = (char)(0x80 | (cp & 0x3F));
+        }
+    }
+    buf[len] = '\0';
+}
+
+// Renders every font once; returns the time in microseconds
+static uint32_t bench_round(const font_set_t *set, lv_obj_t *canvas) {
+    char text[BENCH_TEXT_CHARS * 3 + 1];
+    lv_area_t coords = {0, 0, BENCH_CANVAS_W - 1, BENCH_CANVAS_H - 1};
+    int64_t start_us = esp_timer_get_time();
+    for (uint16_t i = 0; i < set->count; i++) {
+        const lv_font_t *font = &set->fonts[i].font;
+        sample_text(font, text, sizeof(text));
+
+        lv_layer_t layer;
+        lv_canvas_init_layer(canvas, &layer);
+        lv_draw_label_dsc_t label;
+        lv_draw_label_dsc_init(&label);
+        label.font = font;
+        label.color = lv_color_white();
+        label.text = text;
+        lv_draw_label(&layer, &label, &coords);
+        lv_canvas_finish_layer(canvas, &layer);
+    }
+    return (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+static void bench_set(const char *label, const font_set_t *set, lv_obj_t *canvas) {
+    uint32_t first_us = bench_round(set, canvas);
+    uint32_t total_us = 0;
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        total_us += bench_round(set, canvas);
+    }
+    uint32_t avg_us = total_us / BENCH_ROUNDS;
+    ESP_LOGI(TAG, "%-5s: first pass %lu.%02lu ms, then %lu.%02lu ms per pass of %u fonts", label,
+             (unsigned long)(first_us / 1000), (unsigned long)(first_us % 1000 / 10),
+             (unsigned long)(avg_us / 1000), (unsigned long)(avg_us % 1000 / 10), (unsigned)set->count);
+}
+
+esp_err_t font_store_bench_run(void) {
+    font_set_t mapped;
+    font_set_t copied;
+    esp_err_t ret = load_set(true, &mapped);
+    if (ret != ESP_OK) return ret;
+    ret = load_set(false, &copied);
+    if (ret != ESP_OK) {
+        free_set(&mapped);
+        return ret;
+    }
+
+    if (!lvgl_port_lock(1000)) {
+        free_set(&mapped);
+        free_set(&copied);
+        return ESP_ERR_TIMEOUT;
+    }
+    lv_draw_buf_t *buf = lv_draw_buf_create(BENCH_CANVAS_W, BENCH_CANVAS_H, LV_COLOR_FORMAT_RGB565, 0);
+    if (buf == NULL) {
+        lvgl_port_unlock();
+        free_set(&mapped);
+        free_set(&copied);
+        return ESP_ERR_NO_MEM;
+    }
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *canvas = lv_canvas_create(scr);
+    lv_canvas_set_draw_buf(canvas, buf);
+
+    // Alternate so neither placement always runs with the other's data in the cache
+    bench_set("mmap", &mapped, canvas);
+    bench_set("psram", &copied, canvas);
+    bench_set("mmap", &mapped, canvas);
+    bench_set("psram", &copied, canvas);
+
+    lv_obj_delete(scr);
+    lv_draw_buf_destroy(buf);
+    lvgl_port_unlock();
+
+    free_set(&mapped);
+    free_set(&copied);
+    return ESP_OK;
+}
+
+#else // !CONFIG_UI_FONTS_BENCHMARK
+
+esp_err_t font_store_bench_run(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_UI_FONTS_BENCHMARK
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+esp_err_t font_store_init(void) {
+    if (s_set.count > 0) return ESP_OK;
+#if CONFIG_UI_FONTS_MMAP
+    return load_set(true, &s_set);
+#else
+    return load_set(false, &s_set);
+#endif
+}
+
+const lv_font_t *font_store_get(const char *name) {
+    const lv_font_t *font = find_font(&s_set, name);
+    if (font == NULL) {
+        ESP_LOGW(TAG, "Font %s not loaded, using the default font", name);
+        return LV_FONT_DEFAULT;
+    }
+    return font;
+}
+
+#else // !CONFIG_UI_FONTS_FROM_STORAGE
+
+esp_err_t font_store_init(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+const lv_font_t *font_store_get(const char *name) {
+    LV_UNUSED(name);
+    return LV_FONT_DEFAULT;
+}
+
+esp_err_t font_store_bench_run(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_UI_FONTS_FROM_STORAGE
@@ -0,0 +1,56 @@
+/**
+ * @file font_store.h
+ * @brief UI fonts loaded at boot from a bundle on the storage partition
+ *
+ * Optional (CONFIG_UI_FONTS_FROM_STORAGE). The bundle built by
+ * host/font_pack.cpp is either memory-mapped (CONFIG_UI_FONTS_MMAP) or copied
+ * into PSRAM (CONFIG_UI_FONTS_PSRAM). Glyph tables and bitmaps are used in
+ * place; only the lv_font_t descriptors are built in internal RAM. The font
+ * accessors in ui_scale.h look fonts up here by their generated name.
+ */
+#ifndef FONT_STORE_H
+#define FONT_STORE_H
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Load the font bundle
+ *
+ * Call once before the UI is created.
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if there is no storage partition,
+ *         ESP_ERR_INVALID_VERSION if it holds no valid bundle, ESP_ERR_NO_MEM,
+ *         or ESP_ERR_NOT_SUPPORTED if the option is disabled
+ */
+esp_err_t font_store_init(void);
+
+/**
+ * @brief Get a font by its generated name, e.g. "ui_font_Font16"
+ *
+ * @param name Font name
+ * @return The font, or LV_FONT_DEFAULT if the bundle is not loaded or lacks it
+ */
+const lv_font_t *font_store_get(const char *name);
+
+/**
+ * @brief Compare rendering from the memory-mapped bundle and a PSRAM copy
+ *
+ * Optional (CONFIG_UI_FONTS_BENCHMARK). Renders sample text with every font
+ * into an off-screen canvas from each placement and logs the times. Runs from
+ * a normal task and takes the LVGL lock; call after LVGL is initialized.
+ *
+ * @return ESP_OK, ESP_ERR_TIMEOUT if the LVGL lock could not be taken,
+ *         ESP_ERR_NO_MEM, or an error from loading the bundle
+ */
+esp_err_t font_store_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONT_STORE_H
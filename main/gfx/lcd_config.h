@@ -5,9 +5,14 @@
 #include "driver/gpio.h"
 #include "sdkconfig.h"
 
-// Whether or not to apply rotation in `lcd_init` and `lvgl_init`
+// Whether or not to apply rotation in `lcd_init` and `touch_init`
+// (LVGL display rotation in `lvgl_init` already transforms touch points)
 #define SW_ROTATE_180 false
+#if CONFIG_S3_DISP_ROTATE_HW
+#define HW_ROTATE_180 true
+#else
 #define HW_ROTATE_180 false
+#endif
 
 // LVGL task timing (shared across targets)
 #define LVGL_TICK_PERIOD_MS 2
@@ -35,9 +40,32 @@
 #define H_RES 800
 #define V_RES 480
 #define PIXEL_CLOCK_HZ (16 * 1000 * 1000)
-#define LCD_RGB_BOUNCE_BUFFER_HEIGHT 0   // No bounce buffers
+
+// Draw-buffer / framebuffer strategy, selected in menuconfig
+#define LCD_RGB_BOUNCE_BUFFER_HEIGHT CONFIG_S3_DISP_BOUNCE_LINES   // 0 = no bounce buffers
+#if CONFIG_S3_DISP_DIRECT_PSRAM
+#define LCD_RGB_AVOID_TEARING true       // Swap framebuffers on VSYNC
+#define LCD_RGB_DIRECT_MODE true         // LVGL renders into the PSRAM framebuffer
+#define LCD_RGB_NUM_FBS 2
+#define LVGL_DRAW_BUF_LINES V_RES
+#define LVGL_DRAW_DOUBLE_BUFFER false
+#define LCD_DISPLAY_STRATEGY_NAME "direct-psram"
+#elif CONFIG_S3_DISP_PARTIAL_DOUBLE
 #define LCD_RGB_AVOID_TEARING false      // No VSYNC sync
-#define LCD_RGB_DIRECT_MODE false        // Normal mode
+#define LCD_RGB_DIRECT_MODE false        // Partial buffers copied into the framebuffer
+#define LCD_RGB_NUM_FBS 1
+#define LVGL_DRAW_BUF_LINES CONFIG_S3_DISP_BUFFER_LINES
+#define LVGL_DRAW_DOUBLE_BUFFER true
+#define LCD_DISPLAY_STRATEGY_NAME "partial-double"
+#else
+#define LCD_RGB_AVOID_TEARING false      // No VSYNC sync
+#define LCD_RGB_DIRECT_MODE false        // Partial buffer copied into the framebuffer
+#define LCD_RGB_NUM_FBS 1
+#define LVGL_DRAW_BUF_LINES CONFIG_S3_DISP_BUFFER_LINES
+#define LVGL_DRAW_DOUBLE_BUFFER false
+#define LCD_DISPLAY_STRATEGY_NAME "partial-single"
+#endif
+
 #define BK_LIGHT_PIN_NUM 2
 #define BK_LIGHT_ON_LEVEL 1
 #define BK_LIGHT_OFF_LEVEL !BK_LIGHT_ON_LEVEL
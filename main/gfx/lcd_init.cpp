@@ -82,7 +82,8 @@ esp_err_t lcd_init(esp_lcd_panel_handle_t *panel_handle)
 #else
     panel_config.dma_burst_size = 64;
 #endif
-    panel_config.num_fbs = 2;
+    // Partial modes copy into one framebuffer; direct mode renders into one while the other scans out
+    panel_config.num_fbs = LCD_RGB_NUM_FBS;
 #if LCD_RGB_BOUNCE_BUFFER_HEIGHT > 0
     panel_config.bounce_buffer_size_px = H_RES * LCD_RGB_BOUNCE_BUFFER_HEIGHT;
 #else
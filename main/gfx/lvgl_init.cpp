@@ -18,6 +18,10 @@
 #include "lcd_config.h"
 #include "sdkconfig.h"
 #include "radio/radio_subjects.h"  // For radio_subjects_init()
+#include "render_profiler.h"
+#include "refresh_policy.h"
+#include "display_mirror.h"
+#include <string.h>
 
 #if CONFIG_IDF_TARGET_ESP32S3
 #include "esp_lcd_panel_rgb.h"
@@ -28,6 +32,23 @@ static const char *TAG = "LVGL_INIT";
 static lv_display_t *s_disp = NULL;
 static lv_indev_t *s_touch_indev = NULL;
 
+// Cores for LVGL's software draw threads, in creation order. The first shares
+// core 1 with the LVGL task, which only waits while the draw threads render.
+// The second runs on core 0 with the CAT tasks; LVGL creates draw threads at
+// LV_THREAD_PRIO_HIGH (FreeRTOS priority 3), below the CAT parser (4) and the
+// UART reader (5), so CAT handling preempts it.
+static const BaseType_t s_draw_thread_cores[] = {1, 0};
+static uint32_t s_draw_threads = 0;
+
+// Called by LVGL (lv_conf.h LV_FREERTOS_TASK_CREATE) for each thread it creates
+extern "C" int lvgl_thread_core(const char *name)
+{
+    if (strcmp(name, "swdraw") != 0) return tskNO_AFFINITY;
+    uint32_t i = s_draw_threads++;
+    if (i >= sizeof(s_draw_thread_cores) / sizeof(s_draw_thread_cores[0])) return tskNO_AFFINITY;
+    return s_draw_thread_cores[i];
+}
+
 esp_err_t lvgl_init(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t tp)
 {
     ESP_LOGI(TAG, "Initializing LVGL with esp_lvgl_port");
@@ -42,17 +63,22 @@ esp_err_t lvgl_init(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t
         .timer_period_ms = LVGL_TICK_PERIOD_MS,
     };
     ESP_ERROR_CHECK(lvgl_port_init(&lvgl_cfg));
+    if (s_draw_threads == LV_DRAW_SW_DRAW_UNIT_CNT) {
+        ESP_LOGI(TAG, "%d software draw unit(s), pinned", LV_DRAW_SW_DRAW_UNIT_CNT);
+    } else {
+        ESP_LOGW(TAG, "%d software draw unit(s), not pinned (run patch_lvgl.sh)", LV_DRAW_SW_DRAW_UNIT_CNT);
+    }
 
 #if CONFIG_IDF_TARGET_ESP32S3
     // ============================================================
-    // S3: RGB display with direct framebuffer in PSRAM
+    // S3: RGB display, buffer strategy from menuconfig (lcd_config.h)
     // ============================================================
     const lvgl_port_display_cfg_t disp_cfg = {
         .io_handle = NULL,  // Not needed for RGB panels
         .panel_handle = panel_handle,
         .control_handle = NULL,
-        .buffer_size = H_RES * 20,  // 20 lines in internal SRAM (~32KB)
-        .double_buffer = false,
+        .buffer_size = H_RES * LVGL_DRAW_BUF_LINES,  // Partial: internal SRAM lines; direct: full frame
+        .double_buffer = LVGL_DRAW_DOUBLE_BUFFER,
         .trans_size = 0,
         .hres = H_RES,
         .vres = V_RES,
@@ -66,10 +92,14 @@ esp_err_t lvgl_init(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t
         .flags = {
             .buff_dma = false,
             .buff_spiram = false,
+#if CONFIG_S3_DISP_ROTATE_SW
             .sw_rotate = true,    // SW rotation: internal SRAM -> PSRAM framebuffer
+#else
+            .sw_rotate = false,   // Panel driver mirrors on copy, or no rotation
+#endif
             .swap_bytes = false,
             .full_refresh = false,
-            .direct_mode = false,
+            .direct_mode = LCD_RGB_DIRECT_MODE,
         },
     };
 
@@ -85,8 +115,11 @@ esp_err_t lvgl_init(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t
         ESP_LOGE(TAG, "Failed to add RGB display");
         return ESP_FAIL;
     }
-    ESP_LOGI(TAG, "RGB display added: %dx%d", H_RES, V_RES);
+    ESP_LOGI(TAG, "RGB display added: %dx%d, strategy %s (%d lines%s, bounce %d lines)", H_RES, V_RES,
+             LCD_DISPLAY_STRATEGY_NAME, LVGL_DRAW_BUF_LINES, LVGL_DRAW_DOUBLE_BUFFER ? " x2" : "",
+             LCD_RGB_BOUNCE_BUFFER_HEIGHT);
 
+#if CONFIG_S3_DISP_ROTATE_SW
     // Apply 180 degree rotation using LVGL 9 native API
     if (lvgl_port_lock(1000)) {
         lv_display_set_rotation(s_disp, LV_DISPLAY_ROTATION_180);
@@ -95,6 +128,9 @@ esp_err_t lvgl_init(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t
     } else {
         ESP_LOGE(TAG, "Failed to acquire LVGL lock for rotation");
     }
+#elif CONFIG_S3_DISP_ROTATE_HW
+    ESP_LOGI(TAG, "Display rotation 180 degrees by panel mirror");
+#endif
 
 #elif CONFIG_IDF_TARGET_ESP32P4
     // ============================================================
@@ -169,6 +205,27 @@ esp_err_t lvgl_init(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t
     // Initialize LVGL 9 observer subjects for radio state
     radio_subjects_init();
 
+#if CONFIG_RENDER_PROFILER_ENABLE
+    if (lvgl_port_lock(1000)) {
+        render_profiler_init(s_disp);
+        lvgl_port_unlock();
+    }
+#endif
+
+#if CONFIG_UI_ADAPTIVE_REFRESH
+    if (lvgl_port_lock(1000)) {
+        refresh_policy_init(s_disp, s_touch_indev);
+        lvgl_port_unlock();
+    }
+#endif
+
+#if CONFIG_DISPLAY_MIRROR
+    if (lvgl_port_lock(1000)) {
+        display_mirror_init(s_disp);
+        lvgl_port_unlock();
+    }
+#endif
+
     ESP_LOGI(TAG, "LVGL initialization complete");
     return ESP_OK;
 }
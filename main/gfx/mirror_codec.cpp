@@ -0,0 +1,166 @@
+/**
+ * @file mirror_codec.cpp
+ * @brief Run-length/delta coding of RGB565 rectangles for the display mirror
+ */
+
+#include "mirror_codec.h"
+#include <string.h>
+
+#define OP_NONE 3u
+
+typedef struct {
+    uint8_t *out;
+    size_t cap;
+    size_t len;
+    size_t tok_pos;     // Offset of the open token
+    uint32_t op;        // Op of the open token, OP_NONE if there is none
+    uint32_t count;
+    uint16_t run_px;
+    uint16_t lit_prev[2];   // Last two literals, most recent last
+    bool full;
+} mirror_enc_t;
+
+static inline void put16(mirror_enc_t *e, uint16_t v) {
+    if (e->len + 2 > e->cap) {
+        e->full = true;
+        return;
+    }
+    e->out[e->len] = (uint8_t)v;
+    e->out[e->len + 1] = (uint8_t)(v >> 8);
+    e->len += 2;
+}
+
+// Tokens are written with a placeholder and completed when they are closed
+static inline void close_token(mirror_enc_t *e) {
+    if (e->op == OP_NONE || e->full) return;
+    uint16_t tok = (uint16_t)((e->op << MIRROR_OP_SHIFT) | e->count);
+    e->out[e->tok_pos] = (uint8_t)tok;
+    e->out[e->tok_pos + 1] = (uint8_t)(tok >> 8);
+}
+
+static inline void open_token(mirror_enc_t *e, uint32_t op, uint16_t px) {
+    close_token(e);
+    e->tok_pos = e->len;
+    e->op = op;
+    e->count = 1;
+    put16(e, 0);
+    if (op == MIRROR_OP_RUN) {
+        e->run_px = px;
+        put16(e, px);
+    } else if (op == MIRROR_OP_LIT) {
+        e->lit_prev[1] = px;
+        put16(e, px);
+    }
+}
+
+static inline void encode_px(mirror_enc_t *e, uint16_t px, bool unchanged) {
+    if (e->full) return;
+    if (unchanged) {
+        if (e->op == MIRROR_OP_SKIP && e->count < MIRROR_COUNT_MAX) {
+            e->count++;
+        } else {
+            open_token(e, MIRROR_OP_SKIP, 0);
+        }
+        return;
+    }
+    if (e->op == MIRROR_OP_RUN && px == e->run_px && e->count < MIRROR_COUNT_MAX) {
+        e->count++;
+        return;
+    }
+    if (e->op == MIRROR_OP_LIT) {
+        if (e->count >= 2 && px == e->lit_prev[0] && px == e->lit_prev[1]) {
+            // Third equal pixel in a row: take the last two literals back into a run
+            e->count -= 2;
+            e->len -= 4;
+            if (e->count == 0) {
+                e->len = e->tok_pos;
+                e->op = OP_NONE;
+            }
+            open_token(e, MIRROR_OP_RUN, px);
+            e->count = 3;
+            return;
+        }
+        if (e->count < MIRROR_COUNT_MAX) {
+            put16(e, px);
+            e->count++;
+            e->lit_prev[0] = e->lit_prev[1];
+            e->lit_prev[1] = px;
+            return;
+        }
+    }
+    open_token(e, MIRROR_OP_LIT, px);
+}
+
+size_t mirror_encode_rect(const uint16_t *src, size_t src_stride, uint16_t *shadow, size_t shadow_stride,
+                          uint16_t w, uint16_t h, uint8_t *out, size_t cap) {
+    mirror_enc_t e;
+    memset(&e, 0, sizeof(e));
+    e.out = out;
+    e.cap = cap;
+    e.op = OP_NONE;
+
+    for (uint16_t y = 0; y < h && !e.full; y++) {
+        const uint16_t *s = src + y * src_stride;
+        if (shadow != NULL) {
+            uint16_t *d = shadow + y * shadow_stride;
+            for (uint16_t x = 0; x < w; x++) {
+                uint16_t px = s[x];
+                encode_px(&e, px, px == d[x]);
+                d[x] = px;
+            }
+        } else {
+            for (uint16_t x = 0; x < w; x++) encode_px(&e, s[x], false);
+        }
+    }
+    close_token(&e);
+    return e.full ? 0 : e.len;
+}
+
+// Writes n literal or run pixels from position *pos onwards, or skips them if neither is given
+static void write_span(uint16_t *dst, size_t dst_stride, uint16_t w, uint32_t *pos, uint32_t n,
+                       const uint8_t *lit, const uint16_t *run) {
+    while (n > 0) {
+        uint32_t x = *pos % w;
+        uint32_t chunk = w - x;
+        if (chunk > n) chunk = n;
+        uint16_t *d = dst + (*pos / w) * dst_stride + x;
+        if (lit != NULL) {
+            for (uint32_t i = 0; i < chunk; i++) d[i] = (uint16_t)(lit[i * 2] | (lit[i * 2 + 1] << 8));
+            lit += chunk * 2;
+        } else if (run != NULL) {
+            for (uint32_t i = 0; i < chunk; i++) d[i] = *run;
+        }
+        *pos += chunk;
+        n -= chunk;
+    }
+}
+
+bool mirror_decode_rect(const uint8_t *data, size_t size, uint16_t *dst, size_t dst_stride, uint16_t w,
+                        uint16_t h) {
+    const uint8_t *end = data + size;
+    const uint32_t total = (uint32_t)w * h;
+    uint32_t pos = 0;
+    while (data + 2 <= end) {
+        uint16_t tok = (uint16_t)(data[0] | (data[1] << 8));
+        data += 2;
+        uint32_t op = tok >> MIRROR_OP_SHIFT;
+        uint32_t n = tok & MIRROR_COUNT_MAX;
+        if (n == 0 || n > total - pos) return false;
+
+        if (op == MIRROR_OP_SKIP) {
+            write_span(dst, dst_stride, w, &pos, n, NULL, NULL);
+        } else if (op == MIRROR_OP_RUN) {
+            if (data + 2 > end) return false;
+            uint16_t px = (uint16_t)(data[0] | (data[1] << 8));
+            data += 2;
+            write_span(dst, dst_stride, w, &pos, n, NULL, &px);
+        } else if (op == MIRROR_OP_LIT) {
+            if ((size_t)(end - data) < n * 2) return false;
+            write_span(dst, dst_stride, w, &pos, n, data, NULL);
+            data += n * 2;
+        } else {
+            return false;
+        }
+    }
+    return pos == total && data == end;
+}
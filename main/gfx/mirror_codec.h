@@ -0,0 +1,74 @@
+/**
+ * @file mirror_codec.h
+ * @brief Run-length/delta coding of RGB565 rectangles for the display mirror
+ *
+ * Shared by the firmware (display_mirror.cpp), the host UI benchmark and the
+ * Linux mirror client. A rectangle's pixels are coded row-major as 16-bit
+ * little-endian tokens; a token's count may cross row ends:
+ *
+ *   MIRROR_OP_SKIP  count pixels unchanged from what the receiver already has
+ *   MIRROR_OP_RUN   count copies of the pixel that follows
+ *   MIRROR_OP_LIT   count literal pixels follow
+ *
+ * The encoder compares against a shadow of the screen to produce skips and
+ * updates the shadow as it goes; without a shadow it only emits runs and
+ * literals, for areas the receiver may not have.
+ *
+ * Plain C with no ESP-IDF or LVGL dependency.
+ */
+
+#ifndef MIRROR_CODEC_H
+#define MIRROR_CODEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MIRROR_OP_SHIFT 14
+#define MIRROR_OP_SKIP 0u
+#define MIRROR_OP_RUN 1u
+#define MIRROR_OP_LIT 2u
+#define MIRROR_COUNT_MAX 0x3FFFu
+
+/**
+ * @brief Encode a rectangle of pixels
+ *
+ * On failure the shadow holds the rectangle only partly updated; callers that
+ * keep the shadow in step with the screen copy the rectangle into it.
+ *
+ * @param src           First pixel of the rectangle
+ * @param src_stride    Source row pitch in pixels
+ * @param shadow        First pixel of the rectangle in the shadow, or NULL
+ * @param shadow_stride Shadow row pitch in pixels
+ * @param w             Rectangle width
+ * @param h             Rectangle height
+ * @param out           Destination for the tokens
+ * @param cap           Size of out in bytes
+ * @return Bytes written, or 0 if the tokens do not fit in cap
+ */
+size_t mirror_encode_rect(const uint16_t *src, size_t src_stride, uint16_t *shadow, size_t shadow_stride,
+                          uint16_t w, uint16_t h, uint8_t *out, size_t cap);
+
+/**
+ * @brief Apply a coded rectangle to a framebuffer
+ *
+ * @param data       Tokens from mirror_encode_rect()
+ * @param size       Size of data in bytes
+ * @param dst        First pixel of the rectangle in the destination
+ * @param dst_stride Destination row pitch in pixels
+ * @param w          Rectangle width
+ * @param h          Rectangle height
+ * @return true if the tokens cover the rectangle exactly
+ */
+bool mirror_decode_rect(const uint8_t *data, size_t size, uint16_t *dst, size_t dst_stride, uint16_t w,
+                        uint16_t h);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MIRROR_CODEC_H
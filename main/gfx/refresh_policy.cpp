@@ -0,0 +1,286 @@
+/**
+ * @file refresh_policy.cpp
+ * @brief Activity-driven display refresh rate
+ */
+
+#include "refresh_policy.h"
+#include "sdkconfig.h"
+
+#if CONFIG_UI_ADAPTIVE_REFRESH
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+
+static const char *TAG = "REFRESH";
+
+#define REFRESH_TIMER_SLOTS 6
+// Touch keeps its usual rate while active (reads are blocking I2C transfers)
+#define REFRESH_INDEV_IDLE_MS LV_MAX(CONFIG_UI_REFRESH_INPUT_IDLE_MS, LV_DEF_REFR_PERIOD)
+// An invalidation covering this fraction of the screen (a screen or panel change) wakes at once
+#define REFRESH_WAKE_AREA_DIV 4
+
+typedef struct {
+    lv_timer_t *timer;
+    uint32_t active_ms;
+    uint32_t idle_ms;
+} paced_timer_t;
+
+// Per-state accumulators (public stats are derived from these)
+typedef struct {
+    uint32_t time_ms;
+    uint32_t refr_runs;
+    uint32_t frames;
+    uint64_t busy_us;
+    uint64_t latency_sum_us;
+    uint32_t latency_count;
+    uint32_t latency_max_us;
+} state_acc_t;
+
+enum { STATE_ACTIVE = 0, STATE_IDLE = 1 };
+
+// ============================================================================
+// State
+// ============================================================================
+
+static lv_display_t *s_disp = NULL;
+static lv_indev_t *s_indev = NULL;
+static lv_timer_t *s_refr_timer = NULL;
+static paced_timer_t s_timers[REFRESH_TIMER_SLOTS];
+static uint32_t s_timer_count = 0;
+
+static bool s_active = true;
+static uint32_t s_state_since_ms = 0;       // lv_tick when the current state began
+static uint32_t s_last_activity_ms = 0;     // lv_tick of the last invalidation or touch
+static uint32_t s_idle_window_ms = 0;       // lv_tick of the first update counted while idle
+static uint32_t s_idle_update_ms = 0;       // lv_tick of the last update counted while idle
+static uint32_t s_idle_updates = 0;         // Updates since s_idle_window_ms
+
+static state_acc_t s_acc[2];
+static uint32_t s_wakes = 0;
+static int64_t s_refr_start_us = 0;
+static int64_t s_first_inv_us = 0;          // First invalidation not yet refreshed, 0 if none
+static int s_first_inv_state = STATE_ACTIVE;
+
+// ============================================================================
+// Policy
+// ============================================================================
+
+static void set_active(bool active) {
+    uint32_t now = lv_tick_get();
+    s_acc[s_active ? STATE_ACTIVE : STATE_IDLE].time_ms += lv_tick_diff(now, s_state_since_ms);
+    s_state_since_ms = now;
+    s_active = active;
+
+    for (uint32_t i = 0; i < s_timer_count; i++) {
+        lv_timer_set_period(s_timers[i].timer, active ? s_timers[i].active_ms : s_timers[i].idle_ms);
+    }
+    if (active) {
+        s_wakes++;
+        s_last_activity_ms = now;
+        // Render what woke us now rather than at the end of the idle period
+        lv_timer_ready(s_refr_timer);
+    }
+}
+
+static void end_refresh(void) {
+    int64_t now_us = esp_timer_get_time();
+    state_acc_t *acc = &s_acc[s_active ? STATE_ACTIVE : STATE_IDLE];
+    acc->refr_runs++;
+    acc->busy_us += (uint64_t)(now_us - s_refr_start_us);
+
+    if (s_first_inv_us != 0) {
+        acc->frames++;
+        state_acc_t *lat = &s_acc[s_first_inv_state];
+        uint32_t latency_us = (uint32_t)(now_us - s_first_inv_us);
+        lat->latency_sum_us += latency_us;
+        lat->latency_count++;
+        if (latency_us > lat->latency_max_us) lat->latency_max_us = latency_us;
+        s_first_inv_us = 0;
+    }
+
+    bool pressed = s_indev != NULL && lv_indev_get_state(s_indev) == LV_INDEV_STATE_PRESSED;
+    if (pressed) {
+        s_last_activity_ms = lv_tick_get();
+        if (!s_active) set_active(true);
+    } else if (s_active && lv_tick_elaps(s_last_activity_ms) >= CONFIG_UI_REFRESH_IDLE_AFTER_MS) {
+        set_active(false);
+    }
+}
+
+// Whether an invalidation while idle is part of enough activity to switch to active.
+// Areas invalidated in the same tick belong to one update (all digit cells of a
+// frequency change), so updates rather than areas are counted.
+static bool idle_update_wakes(const lv_area_t *area) {
+    if (area != NULL) {
+        uint32_t screen = (uint32_t)lv_display_get_horizontal_resolution(s_disp) *
+                          (uint32_t)lv_display_get_vertical_resolution(s_disp);
+        if (lv_area_get_size(area) >= screen / REFRESH_WAKE_AREA_DIV) return true;
+    }
+
+    uint32_t now = lv_tick_get();
+    if (s_idle_updates > 0 && now == s_idle_update_ms) return false;
+    if (s_idle_updates == 0 || lv_tick_diff(now, s_idle_window_ms) >= CONFIG_UI_REFRESH_IDLE_MS) {
+        s_idle_window_ms = now;
+        s_idle_updates = 0;
+    }
+    s_idle_update_ms = now;
+    return ++s_idle_updates >= CONFIG_UI_REFRESH_WAKE_UPDATES;
+}
+
+static void display_event_cb(lv_event_t *e) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_INVALIDATE_AREA:
+            if (s_first_inv_us == 0) {
+                s_first_inv_us = esp_timer_get_time();
+                s_first_inv_state = s_active ? STATE_ACTIVE : STATE_IDLE;
+            }
+            if (s_active) {
+                s_last_activity_ms = lv_tick_get();
+            } else if (idle_update_wakes((const lv_area_t *)lv_event_get_param(e))) {
+                s_idle_updates = 0;
+                set_active(true);
+            }
+            break;
+        case LV_EVENT_REFR_START:
+            s_refr_start_us = esp_timer_get_time();
+            break;
+        case LV_EVENT_REFR_READY:
+            end_refresh();
+            break;
+        default:
+            break;
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+esp_err_t refresh_policy_add_timer(lv_timer_t *timer, uint32_t active_ms, uint32_t idle_ms) {
+    if (s_disp == NULL) return ESP_ERR_INVALID_STATE;
+    if (timer == NULL || active_ms == 0 || idle_ms == 0) return ESP_ERR_INVALID_ARG;
+    if (s_timer_count >= REFRESH_TIMER_SLOTS) return ESP_ERR_NO_MEM;
+    s_timers[s_timer_count++] = (paced_timer_t){timer, active_ms, idle_ms};
+    lv_timer_set_period(timer, s_active ? active_ms : idle_ms);
+    return ESP_OK;
+}
+
+bool refresh_policy_is_active(void) {
+    return s_active;
+}
+
+static void fill_state_stats(refresh_policy_state_stats_t *out, const state_acc_t *acc) {
+    out->time_ms = acc->time_ms;
+    out->refr_runs = acc->refr_runs;
+    out->frames = acc->frames;
+    out->busy_us = acc->busy_us;
+    out->latency_avg_us = acc->latency_count ? (uint32_t)(acc->latency_sum_us / acc->latency_count) : 0;
+    out->latency_max_us = acc->latency_max_us;
+}
+
+void refresh_policy_get_stats(refresh_policy_stats_t *out) {
+    if (out == NULL) return;
+    fill_state_stats(&out->active, &s_acc[STATE_ACTIVE]);
+    fill_state_stats(&out->idle, &s_acc[STATE_IDLE]);
+    // Include the time spent so far in the current state
+    uint32_t current_ms = lv_tick_elaps(s_state_since_ms);
+    if (s_active) {
+        out->active.time_ms += current_ms;
+    } else {
+        out->idle.time_ms += current_ms;
+    }
+    out->wakes = s_wakes;
+}
+
+static void log_state(const char *name, uint32_t period_ms, const refresh_policy_state_stats_t *st) {
+    uint32_t t = st->time_ms ? st->time_ms : 1;
+    uint32_t busy_us_per_s = (uint32_t)((st->busy_us * 1000) / t);
+    ESP_LOGI(TAG, "%s (%lu ms): %lu.%lu s, %lu refr/s, %lu frames/s, busy %lu.%lu ms/s, latency avg %lu.%lu ms max %lu.%lu ms",
+             name, (unsigned long)period_ms, (unsigned long)(st->time_ms / 1000),
+             (unsigned long)((st->time_ms % 1000) / 100), (unsigned long)((uint64_t)st->refr_runs * 1000 / t),
+             (unsigned long)((uint64_t)st->frames * 1000 / t), (unsigned long)(busy_us_per_s / 1000),
+             (unsigned long)((busy_us_per_s % 1000) / 100), (unsigned long)(st->latency_avg_us / 1000),
+             (unsigned long)((st->latency_avg_us % 1000) / 100), (unsigned long)(st->latency_max_us / 1000),
+             (unsigned long)((st->latency_max_us % 1000) / 100));
+}
+
+void refresh_policy_log_stats(void) {
+    refresh_policy_stats_t st;
+    refresh_policy_get_stats(&st);
+    log_state("active", CONFIG_UI_REFRESH_ACTIVE_MS, &st.active);
+    log_state("idle", CONFIG_UI_REFRESH_IDLE_MS, &st.idle);
+    ESP_LOGI(TAG, "%lu wakes (idle latency = wake-up latency)", (unsigned long)st.wakes);
+
+    memset(s_acc, 0, sizeof(s_acc));
+    s_wakes = 0;
+    s_state_since_ms = lv_tick_get();
+}
+
+#if CONFIG_UI_REFRESH_STATS_INTERVAL_MS > 0
+static void stats_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+    refresh_policy_log_stats();
+}
+#endif
+
+esp_err_t refresh_policy_init(lv_display_t *disp, lv_indev_t *indev) {
+    if (disp == NULL) return ESP_ERR_INVALID_ARG;
+    if (s_disp != NULL) return ESP_OK;
+
+    s_refr_timer = lv_display_get_refr_timer(disp);
+    if (s_refr_timer == NULL) {
+        ESP_LOGW(TAG, "Display has no refresh timer, policy not started");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    s_disp = disp;
+    s_indev = indev;
+    s_active = true;
+    s_state_since_ms = lv_tick_get();
+    s_last_activity_ms = s_state_since_ms;
+
+    refresh_policy_add_timer(s_refr_timer, CONFIG_UI_REFRESH_ACTIVE_MS, CONFIG_UI_REFRESH_IDLE_MS);
+    // Bar and meter animations step with the refresh; paused by LVGL when none run
+    refresh_policy_add_timer(lv_anim_get_timer(), CONFIG_UI_REFRESH_ACTIVE_MS, LV_DEF_REFR_PERIOD);
+    if (indev != NULL) {
+        refresh_policy_add_timer(lv_indev_get_read_timer(indev), LV_DEF_REFR_PERIOD, REFRESH_INDEV_IDLE_MS);
+    }
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_ALL, NULL);
+
+#if CONFIG_UI_REFRESH_STATS_INTERVAL_MS > 0
+    lv_timer_create(stats_timer_cb, CONFIG_UI_REFRESH_STATS_INTERVAL_MS, NULL);
+#endif
+
+    ESP_LOGI(TAG, "Adaptive refresh: %d ms active, %d ms idle after %d ms, input %d ms idle, wake after %d updates",
+             CONFIG_UI_REFRESH_ACTIVE_MS, CONFIG_UI_REFRESH_IDLE_MS, CONFIG_UI_REFRESH_IDLE_AFTER_MS,
+             CONFIG_UI_REFRESH_INPUT_IDLE_MS, CONFIG_UI_REFRESH_WAKE_UPDATES);
+    return ESP_OK;
+}
+
+#else // !CONFIG_UI_ADAPTIVE_REFRESH
+
+esp_err_t refresh_policy_init(lv_display_t *disp, lv_indev_t *indev) {
+    LV_UNUSED(disp);
+    LV_UNUSED(indev);
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t refresh_policy_add_timer(lv_timer_t *timer, uint32_t active_ms, uint32_t idle_ms) {
+    LV_UNUSED(timer);
+    LV_UNUSED(active_ms);
+    LV_UNUSED(idle_ms);
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+bool refresh_policy_is_active(void) {
+    return true;
+}
+
+void refresh_policy_get_stats(refresh_policy_stats_t *out) {
+    if (out != NULL) memset(out, 0, sizeof(*out));
+}
+
+void refresh_policy_log_stats(void) {
+}
+
+#endif // CONFIG_UI_ADAPTIVE_REFRESH
@@ -0,0 +1,93 @@
+/**
+ * @file refresh_policy.h
+ * @brief Activity-driven display refresh rate
+ *
+ * Optional (CONFIG_UI_ADAPTIVE_REFRESH). Runs the display refresh timer, the
+ * touch read timer and any registered timers at their active periods while
+ * the screen is being invalidated or touched, and at their idle periods once
+ * nothing has happened for CONFIG_UI_REFRESH_IDLE_AFTER_MS. While idle, an
+ * isolated small change (a clock tick) is drawn by the next idle refresh;
+ * touch, a large invalidation or CONFIG_UI_REFRESH_WAKE_UPDATES separate
+ * updates within one idle period switch back and refresh immediately.
+ *
+ * All functions must be called with the LVGL lock held (or from the LVGL task).
+ */
+#ifndef REFRESH_POLICY_H
+#define REFRESH_POLICY_H
+
+#include "esp_err.h"
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Measurements for one state since the last reset
+ */
+typedef struct {
+    uint32_t time_ms;           ///< Time spent in the state
+    uint32_t refr_runs;         ///< Refresh timer runs (LVGL task wakeups for the display)
+    uint32_t frames;            ///< Runs that rendered something
+    uint64_t busy_us;           ///< Time spent in refresh runs, including flush
+    uint32_t latency_avg_us;    ///< First invalidation of a frame until that frame is flushed
+    uint32_t latency_max_us;
+} refresh_policy_state_stats_t;
+
+/**
+ * @brief Measurements since the last reset
+ *
+ * Latency is attributed to the state in which the invalidation happened, so
+ * idle.latency_* is the wake-up latency and active.latency_* the steady one.
+ */
+typedef struct {
+    refresh_policy_state_stats_t active;
+    refresh_policy_state_stats_t idle;
+    uint32_t wakes;             ///< Idle to active transitions
+} refresh_policy_stats_t;
+
+/**
+ * @brief Start the policy on a display
+ *
+ * Paces the display refresh timer and, if given, the touch read timer.
+ *
+ * @param disp  Display to pace
+ * @param indev Touch input device, or NULL
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if disp is NULL
+ */
+esp_err_t refresh_policy_init(lv_display_t *disp, lv_indev_t *indev);
+
+/**
+ * @brief Pace another LVGL timer with the policy
+ *
+ * @param timer     Timer to pace
+ * @param active_ms Period while active
+ * @param idle_ms   Period while idle
+ * @return ESP_OK, ESP_ERR_INVALID_STATE before init, ESP_ERR_NO_MEM if the table is full
+ */
+esp_err_t refresh_policy_add_timer(lv_timer_t *timer, uint32_t active_ms, uint32_t idle_ms);
+
+/**
+ * @brief Whether the policy is currently in the active (fast) state
+ */
+bool refresh_policy_is_active(void);
+
+/**
+ * @brief Get the measurements since the last reset
+ *
+ * @param out Filled with the measurements
+ */
+void refresh_policy_get_stats(refresh_policy_stats_t *out);
+
+/**
+ * @brief Log the measurements and reset them
+ */
+void refresh_policy_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REFRESH_POLICY_H
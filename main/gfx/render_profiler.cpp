@@ -0,0 +1,306 @@
+/**
+ * @file render_profiler.cpp
+ * @brief Per-frame render cost and invalidated-area accounting
+ */
+
+#include "render_profiler.h"
+#include "sdkconfig.h"
+
+#if CONFIG_RENDER_PROFILER_ENABLE
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "RENDER_PROF";
+
+#define RENDER_PROF_OBJ_SLOTS 32    // Distinct objects tracked between reports
+
+// ============================================================================
+// State
+// ============================================================================
+
+static lv_display_t *s_disp = NULL;
+static render_profile_frame_t *s_frames = NULL;    // Ring of CONFIG_RENDER_PROFILER_FRAMES
+static uint32_t s_frame_head = 0;                  // Next slot to write
+static uint32_t s_frame_count = 0;
+
+static render_profile_obj_t s_objs[RENDER_PROF_OBJ_SLOTS];
+static uint32_t s_unattributed_px = 0;
+
+// Frame being built; invalidations since the previous refresh count toward it
+static render_profile_frame_t s_cur;
+static int64_t s_refr_start_us = 0;
+static int64_t s_flush_start_us = 0;
+static int64_t s_wait_start_us = 0;
+
+#if CONFIG_RENDER_PROFILER_OVERLAY
+static lv_obj_t *s_overlay = NULL;
+#endif
+
+// ============================================================================
+// Attribution
+// ============================================================================
+
+// Deepest visible object whose (extended) coordinates contain the area
+static lv_obj_t *find_owner(lv_obj_t *parent, const lv_area_t *area) {
+    uint32_t count = lv_obj_get_child_count(parent);
+    // Last child is on top, so search from the end
+    for (int32_t i = (int32_t)count - 1; i >= 0; i--) {
+        lv_obj_t *child = lv_obj_get_child(parent, i);
+        if (lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        lv_area_t coords;
+        lv_obj_get_coords(child, &coords);
+        int32_t ext = lv_obj_get_ext_draw_size(child);
+        lv_area_increase(&coords, ext, ext);
+        if (lv_area_is_in(area, &coords, 0)) {
+            return find_owner(child, area);
+        }
+    }
+    return parent;
+}
+
+static void account_object(lv_obj_t *obj, uint32_t px) {
+#if CONFIG_RENDER_PROFILER_OVERLAY
+    if (obj == s_overlay) return; // Don't rank our own report
+#endif
+    int free_slot = -1;
+    int smallest = 0;
+    for (int i = 0; i < RENDER_PROF_OBJ_SLOTS; i++) {
+        if (s_objs[i].obj == obj) {
+            s_objs[i].inv_px += px;
+            s_objs[i].inv_count++;
+            lv_obj_get_coords(obj, &s_objs[i].coords);
+            return;
+        }
+        if (s_objs[i].obj == NULL && free_slot < 0) free_slot = i;
+        if (s_objs[i].inv_px < s_objs[smallest].inv_px) smallest = i;
+    }
+    if (free_slot < 0) {
+        // Table full: the object with the least area so far makes room
+        s_unattributed_px += s_objs[smallest].inv_px;
+        free_slot = smallest;
+    }
+    render_profile_obj_t *slot = &s_objs[free_slot];
+    slot->obj = obj;
+    slot->class_name = lv_obj_get_class(obj)->name;
+    lv_obj_get_coords(obj, &slot->coords);
+    slot->inv_px = px;
+    slot->inv_count = 1;
+}
+
+// ============================================================================
+// Display event hooks
+// ============================================================================
+
+static void end_frame(void) {
+    if (s_cur.flushes == 0 && s_cur.inv_areas == 0) return; // Nothing was redrawn
+    uint32_t total_us = (uint32_t)(esp_timer_get_time() - s_refr_start_us);
+    s_cur.render_us = (total_us > s_cur.flush_us) ? total_us - s_cur.flush_us : 0;
+
+    s_frames[s_frame_head] = s_cur;
+    s_frame_head = (s_frame_head + 1) % CONFIG_RENDER_PROFILER_FRAMES;
+    if (s_frame_count < CONFIG_RENDER_PROFILER_FRAMES) s_frame_count++;
+}
+
+static void display_event_cb(lv_event_t *e) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_INVALIDATE_AREA: {
+            const lv_area_t *area = (const lv_area_t *)lv_event_get_param(e);
+            if (area == NULL) break;
+            uint32_t px = lv_area_get_size(area);
+            s_cur.inv_px += px;
+            s_cur.inv_areas++;
+            lv_obj_t *scr = lv_display_get_screen_active(s_disp);
+            lv_obj_t *top = lv_display_get_layer_top(s_disp);
+            lv_obj_t *owner = NULL;
+            if (top != NULL && lv_obj_get_child_count(top) > 0) {
+                owner = find_owner(top, area);
+                if (owner == top) owner = NULL;
+            }
+            if (owner == NULL && scr != NULL) owner = find_owner(scr, area);
+            if (owner != NULL) {
+                account_object(owner, px);
+            } else {
+                s_unattributed_px += px;
+            }
+            break;
+        }
+        case LV_EVENT_REFR_START:
+            s_cur.timestamp_ms = lv_tick_get();
+            s_refr_start_us = esp_timer_get_time();
+            break;
+        case LV_EVENT_FLUSH_START:
+            s_flush_start_us = esp_timer_get_time();
+            break;
+        case LV_EVENT_FLUSH_FINISH:
+            s_cur.flush_us += (uint32_t)(esp_timer_get_time() - s_flush_start_us);
+            s_cur.flushes++;
+            break;
+        case LV_EVENT_FLUSH_WAIT_START:
+            s_wait_start_us = esp_timer_get_time();
+            break;
+        case LV_EVENT_FLUSH_WAIT_FINISH:
+            s_cur.flush_us += (uint32_t)(esp_timer_get_time() - s_wait_start_us);
+            break;
+        case LV_EVENT_REFR_READY:
+            end_frame();
+            memset(&s_cur, 0, sizeof(s_cur));
+            break;
+        default:
+            break;
+    }
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+size_t render_profiler_get_frames(render_profile_frame_t *out, size_t max) {
+    if (s_frames == NULL || out == NULL) return 0;
+    size_t n = (s_frame_count < max) ? s_frame_count : max;
+    uint32_t start = (s_frame_head + CONFIG_RENDER_PROFILER_FRAMES - n) % CONFIG_RENDER_PROFILER_FRAMES;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = s_frames[(start + i) % CONFIG_RENDER_PROFILER_FRAMES];
+    }
+    return n;
+}
+
+size_t render_profiler_get_top(render_profile_obj_t *out, size_t max) {
+    if (out == NULL) return 0;
+    size_t n = 0;
+    bool taken[RENDER_PROF_OBJ_SLOTS] = {};
+    while (n < max) {
+        int best = -1;
+        for (int i = 0; i < RENDER_PROF_OBJ_SLOTS; i++) {
+            if (taken[i] || s_objs[i].obj == NULL) continue;
+            if (best < 0 || s_objs[i].inv_px > s_objs[best].inv_px) best = i;
+        }
+        if (best < 0) break;
+        taken[best] = true;
+        out[n++] = s_objs[best];
+    }
+    return n;
+}
+
+void render_profiler_format_summary(char *buf, size_t size) {
+    if (buf == NULL || size == 0) return;
+    buf[0] = '\0';
+    if (s_frames == NULL) return;
+
+    uint64_t render_sum = 0, flush_sum = 0, px_sum = 0;
+    uint32_t render_max = 0;
+    for (uint32_t i = 0; i < s_frame_count; i++) {
+        const render_profile_frame_t *f = &s_frames[i];
+        render_sum += f->render_us;
+        flush_sum += f->flush_us;
+        px_sum += f->inv_px;
+        if (f->render_us > render_max) render_max = f->render_us;
+    }
+    uint32_t n = s_frame_count ? s_frame_count : 1;
+    int len = snprintf(buf, size, "%lu frames: render %lu us (max %lu), flush %lu us, %lu px/frame",
+                       (unsigned long)s_frame_count, (unsigned long)(render_sum / n),
+                       (unsigned long)render_max, (unsigned long)(flush_sum / n),
+                       (unsigned long)(px_sum / n));
+
+    render_profile_obj_t top[CONFIG_RENDER_PROFILER_TOP_N];
+    size_t top_n = render_profiler_get_top(top, CONFIG_RENDER_PROFILER_TOP_N);
+    for (size_t i = 0; i < top_n && len > 0 && (size_t)len < size; i++) {
+        len += snprintf(buf + len, size - len, "\n%u. %s @%ld,%ld %ldx%ld: %lu px in %lu",
+                        (unsigned)(i + 1), top[i].class_name ? top[i].class_name : "?",
+                        (long)top[i].coords.x1, (long)top[i].coords.y1,
+                        (long)lv_area_get_width(&top[i].coords), (long)lv_area_get_height(&top[i].coords),
+                        (unsigned long)top[i].inv_px, (unsigned long)top[i].inv_count);
+    }
+    if (s_unattributed_px > 0 && len > 0 && (size_t)len < size) {
+        snprintf(buf + len, size - len, "\n(other): %lu px", (unsigned long)s_unattributed_px);
+    }
+}
+
+void render_profiler_log_report(void) {
+    static char summary[512];
+    render_profiler_format_summary(summary, sizeof(summary));
+    // One log call per line so long reports are not truncated
+    char *line = summary;
+    while (line != NULL && *line != '\0') {
+        char *next = strchr(line, '\n');
+        if (next != NULL) *next++ = '\0';
+        ESP_LOGI(TAG, "%s", line);
+        line = next;
+    }
+    memset(s_objs, 0, sizeof(s_objs));
+    s_unattributed_px = 0;
+}
+
+static void report_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+#if CONFIG_RENDER_PROFILER_OVERLAY
+    if (s_overlay != NULL) {
+        static char overlay_text[512];
+        render_profiler_format_summary(overlay_text, sizeof(overlay_text));
+        lv_label_set_text_static(s_overlay, overlay_text);
+    }
+#endif
+    render_profiler_log_report();
+}
+
+esp_err_t render_profiler_init(lv_display_t *disp) {
+    if (disp == NULL) return ESP_ERR_INVALID_ARG;
+    if (s_frames != NULL) return ESP_OK;
+
+    s_frames = (render_profile_frame_t *)heap_caps_calloc(CONFIG_RENDER_PROFILER_FRAMES, sizeof(render_profile_frame_t),
+                                                          MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (s_frames == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate frame ring");
+        return ESP_ERR_NO_MEM;
+    }
+    s_disp = disp;
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_ALL, NULL);
+    lv_timer_create(report_timer_cb, CONFIG_RENDER_PROFILER_LOG_INTERVAL_MS, NULL);
+
+#if CONFIG_RENDER_PROFILER_OVERLAY
+    s_overlay = lv_label_create(lv_display_get_layer_top(disp));
+    lv_obj_set_style_bg_color(s_overlay, lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(s_overlay, LV_OPA_70, LV_PART_MAIN);
+    lv_obj_set_style_text_color(s_overlay, lv_color_white(), LV_PART_MAIN);
+    lv_obj_set_style_text_font(s_overlay, LV_FONT_DEFAULT, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(s_overlay, 4, LV_PART_MAIN);
+    lv_obj_align(s_overlay, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_obj_remove_flag(s_overlay, LV_OBJ_FLAG_CLICKABLE);
+    lv_label_set_text_static(s_overlay, "render profiler");
+#endif
+
+    ESP_LOGI(TAG, "Profiling display: %d frame ring, top %d objects, report every %d ms",
+             CONFIG_RENDER_PROFILER_FRAMES, CONFIG_RENDER_PROFILER_TOP_N, CONFIG_RENDER_PROFILER_LOG_INTERVAL_MS);
+    return ESP_OK;
+}
+
+#else // !CONFIG_RENDER_PROFILER_ENABLE
+
+esp_err_t render_profiler_init(lv_display_t *disp) {
+    LV_UNUSED(disp);
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+size_t render_profiler_get_frames(render_profile_frame_t *out, size_t max) {
+    LV_UNUSED(out);
+    LV_UNUSED(max);
+    return 0;
+}
+
+size_t render_profiler_get_top(render_profile_obj_t *out, size_t max) {
+    LV_UNUSED(out);
+    LV_UNUSED(max);
+    return 0;
+}
+
+void render_profiler_format_summary(char *buf, size_t size) {
+    if (buf != NULL && size > 0) buf[0] = '\0';
+}
+
+void render_profiler_log_report(void) {
+}
+
+#endif // CONFIG_RENDER_PROFILER_ENABLE
@@ -0,0 +1,93 @@
+/**
+ * @file render_profiler.h
+ * @brief Per-frame render cost and invalidated-area accounting
+ *
+ * Optional (CONFIG_RENDER_PROFILER_ENABLE). Hooks the display's refresh, render,
+ * flush and invalidate events and records one entry per refreshed frame in a
+ * ring buffer. Invalidated areas are attributed to the deepest visible object
+ * containing them, so the widgets driving redraw cost can be ranked.
+ *
+ * All functions must be called with the LVGL lock held (or from the LVGL task).
+ */
+#ifndef RENDER_PROFILER_H
+#define RENDER_PROFILER_H
+
+#include "esp_err.h"
+#include "lvgl.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One refreshed frame
+ */
+typedef struct {
+    uint32_t timestamp_ms;  ///< lv_tick at refresh start
+    uint32_t render_us;     ///< Refresh time excluding flush
+    uint32_t flush_us;      ///< Time in flush_cb plus waiting for flush ready
+    uint32_t inv_px;        ///< Sum of invalidated areas before merging
+    uint16_t inv_areas;     ///< Invalidation requests in the frame
+    uint16_t flushes;       ///< flush_cb calls in the frame
+} render_profile_frame_t;
+
+/**
+ * @brief Invalidated area attributed to one object since the last reset
+ */
+typedef struct {
+    const lv_obj_t *obj;    ///< Object (may have been deleted since)
+    const char *class_name; ///< LVGL class name, e.g. "lv_label"
+    lv_area_t coords;       ///< Object coordinates when last seen
+    uint32_t inv_px;        ///< Total invalidated pixels
+    uint32_t inv_count;     ///< Number of invalidations
+} render_profile_obj_t;
+
+/**
+ * @brief Start profiling a display
+ *
+ * Registers display event hooks, a periodic serial report and, if configured,
+ * an on-screen overlay on the top layer.
+ *
+ * @param disp Display to profile
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if the ring buffer cannot be allocated
+ */
+esp_err_t render_profiler_init(lv_display_t *disp);
+
+/**
+ * @brief Copy the most recent frames, oldest first
+ *
+ * @param out Destination array
+ * @param max Capacity of out
+ * @return Number of frames copied
+ */
+size_t render_profiler_get_frames(render_profile_frame_t *out, size_t max);
+
+/**
+ * @brief Get the objects with the largest invalidated area, largest first
+ *
+ * @param out Destination array
+ * @param max Capacity of out
+ * @return Number of entries copied
+ */
+size_t render_profiler_get_top(render_profile_obj_t *out, size_t max);
+
+/**
+ * @brief Format averages and the top objects as multi-line text
+ *
+ * @param buf  Destination buffer
+ * @param size Size of buf
+ */
+void render_profiler_format_summary(char *buf, size_t size);
+
+/**
+ * @brief Log the summary and clear the per-object totals
+ */
+void render_profiler_log_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RENDER_PROFILER_H
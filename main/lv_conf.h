@@ -111,6 +111,21 @@
 	 * RTOS task notifications can only be used when there is only one task that can be the recipient of the event.
 	 */
 	#define LV_USE_FREERTOS_TASK_NOTIFY 1
+
+	/*
+	 * Thread placement: patch_lvgl.sh makes lv_freertos.c create its threads through this
+	 * macro, and lvgl_thread_core() (gfx/lvgl_init.cpp) pins the draw threads around the
+	 * CAT tasks. Without the patch the threads are created unpinned.
+	 */
+	#ifndef __ASSEMBLY__
+	#ifdef __cplusplus
+	extern "C" int lvgl_thread_core(const char * name);
+	#else
+	int lvgl_thread_core(const char * name);
+	#endif
+	#endif
+	#define LV_FREERTOS_TASK_CREATE(fn, name, depth, arg, prio, handle) \
+		xTaskCreatePinnedToCore(fn, name, depth, arg, prio, handle, lvgl_thread_core(name))
 #endif
 
 /*========================
@@ -168,8 +183,13 @@
 
 	/* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
-     * > 1 means multiple threads will render the screen in parallel */
+     * > 1 means multiple threads will render the screen in parallel
+     * P4: menuconfig (User Interface > Software draw units); the S3 keeps one */
+    #if CONFIG_IDF_TARGET_ESP32P4 && defined(CONFIG_UI_DRAW_UNITS)
+    #define LV_DRAW_SW_DRAW_UNIT_CNT    CONFIG_UI_DRAW_UNITS
+    #else
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #endif
 
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -1,12 +1,17 @@
 #include "cat_parser.h"
 #include "cat_polling.h"
+#include "cat_transaction.h"
 #include "esp_log.h"
 #include "esp_system.h"
 #include "esp_task_wdt.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "gfx/lcd_init.h"
+#include "gfx/boot_splash.h"
 #include "gfx/lvgl_init.h"
+#include "gfx/display_bench.h"
+#include "gfx/font_store.h"
+#include "gfx/refresh_policy.h"
 #include "gfx/touch_init.h"
 #include "memory_monitor.h"
 #include "ntp_client.h"
@@ -46,8 +51,8 @@ static void lvgl_periodic_update_time_cb(lv_timer_t *timer) {
 
     // Update UI only if time is valid (e.g., year is past 2000, indicating it's been set)
     // GPS/NTP might take a moment to set the time initially.
-    if (ui_UtcTime && lv_obj_is_valid(ui_UtcTime)) {
-        // ui_UtcTime is declared in ui_Screen1.c and externed via ui.h
+    if (ui_UtcTime) {
+        // ui_UtcTime is declared in ui_Screen1.cpp (externed via ui.h) and cleared when deleted
         if (timeinfo.tm_year > (2000 - 1900)) {
             strftime(main_time_buffer_for_lvgl, sizeof(main_time_buffer_for_lvgl), "%H:%M:%S", &timeinfo);
             lv_label_set_text(ui_UtcTime, main_time_buffer_for_lvgl); // Changed to lv_label_set_text
@@ -118,8 +123,9 @@ extern "C" void app_main(void) {
     ESP_LOGI(TAG, "Config: LVGL_PORT_ENABLE_PPA=%d", CONFIG_LVGL_PORT_ENABLE_PPA);
 #endif
 #if CONFIG_IDF_TARGET_ESP32S3
-    ESP_LOGI(TAG, "LCD: pclk=%u, avoid_tearing=%d, direct_mode=%d, bb_height=%d",
+    ESP_LOGI(TAG, "LCD: pclk=%u, strategy=%s, avoid_tearing=%d, direct_mode=%d, bb_height=%d",
              (unsigned)PIXEL_CLOCK_HZ,
+             LCD_DISPLAY_STRATEGY_NAME,
              (int)LCD_RGB_AVOID_TEARING,
              (int)LCD_RGB_DIRECT_MODE,
              (int)LCD_RGB_BOUNCE_BUFFER_HEIGHT);
@@ -167,6 +173,14 @@ extern "C" void app_main(void) {
     }
     ESP_LOGI(TAG, "LCD initialized");
 
+#if CONFIG_BOOT_SPLASH
+    // Put the first frame on the panel now; LVGL replaces it once the UI is up
+    ret = boot_splash_show(panel_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Boot splash not shown: %s", esp_err_to_name(ret));
+    }
+#endif
+
     // Initialize touch
     esp_lcd_touch_handle_t tp = NULL;
     ret = touch_init(&tp);
@@ -194,6 +208,25 @@ extern "C" void app_main(void) {
     ESP_LOGI(TAG, "LVGL initialized");
     log_heap_status("After LVGL init");
 
+#if CONFIG_DISPLAY_BENCHMARK
+    // Measure the configured draw-buffer strategy before the UI adds its own load
+    display_bench_result_t bench_result;
+    display_bench_run(lvgl_get_display(), CONFIG_DISPLAY_BENCHMARK_SECONDS * 1000, &bench_result);
+#endif
+
+#if CONFIG_UI_FONTS_FROM_STORAGE
+    // Fonts must be loaded before the UI looks them up; without them it falls
+    // back to the default font rather than failing to start
+    ret = font_store_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to load fonts from storage: %s", esp_err_to_name(ret));
+    }
+    log_heap_status("After font load");
+#if CONFIG_UI_FONTS_BENCHMARK
+    font_store_bench_run();
+#endif
+#endif
+
     // Initialize antenna control system BEFORE UI so antenna names are available
     // when ui_Screen2 creates antenna selection buttons
     ret = antenna_control_init();
@@ -216,8 +249,16 @@ extern "C" void app_main(void) {
 
     // Create LVGL timer to drain subject updates from other tasks
     // Runs at 200Hz (5ms) for minimal latency on VFO updates from CAT parser, websocket, etc.
-    lv_timer_create(lvgl_subject_drain_cb, 5, NULL);
+    lv_timer_t *drain_timer = lv_timer_create(lvgl_subject_drain_cb, 5, NULL);
     ESP_LOGI(TAG, "LVGL subject drain timer created (200Hz)");
+#if CONFIG_UI_ADAPTIVE_REFRESH
+    // Slow the drain down with the display while nothing changes on screen;
+    // a run of updates it applies wakes the display again
+    if (lvgl_port_lock(1000)) {
+        refresh_policy_add_timer(drain_timer, 5, CONFIG_UI_REFRESH_INPUT_IDLE_MS);
+        lvgl_port_unlock();
+    }
+#endif
 
     // Time client (NTP/GPS) initialization will now be handled by time_sync_task
     // to allow concurrent startup with UART.
@@ -230,6 +271,12 @@ extern "C" void app_main(void) {
     }
     ESP_LOGI(TAG, "CAT parser initialized");
 
+    // Initialize CAT transactions (answer routing for tracked queries)
+    ret = cat_txn_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to initialize CAT transactions: %s", esp_err_to_name(ret));
+    }
+
     init_uart();
     
     // Initialize CAT polling manager
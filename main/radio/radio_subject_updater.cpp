@@ -7,6 +7,7 @@
  */
 
 #include "radio_subject_updater.h"
+#include "radio_subjects.h"  // For radio_if_data_publish()
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "esp_heap_caps.h"
@@ -37,6 +38,67 @@ typedef struct {
 static QueueHandle_t s_update_queue = NULL;
 static bool s_initialized = false;
 
+// Observer suspension (screensaver low-activity mode). While suspended each
+// subject keeps only its latest update, applied on resume; one slot per
+// subject in radio_subjects.cpp
+#define PARKED_MAX 64
+
+static volatile bool s_suspended = false;
+static volatile uint32_t s_dropped_count = 0;
+static subject_update_item_t *s_parked = NULL;
+static int s_parked_count = 0;
+static portMUX_TYPE s_parked_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static inline void free_item_payload(subject_update_item_t *item)
+{
+    if ((item->flags & 0x01) && item->payload.heap_ptr) {
+        heap_caps_free(item->payload.heap_ptr);
+    }
+}
+
+// Returns true if the update was kept in the subject's slot instead of queued
+static bool park_while_suspended(subject_update_item_t *item)
+{
+    if (!s_suspended) {
+        return false;
+    }
+    subject_update_item_t replaced = {0};
+    bool parked = false;
+    bool full = false;
+
+    portENTER_CRITICAL(&s_parked_lock);
+    if (s_suspended && s_parked != NULL) {
+        parked = true;
+        int i = 0;
+        while (i < s_parked_count && s_parked[i].subject != item->subject) {
+            i++;
+        }
+        if (i < s_parked_count) {
+            // A bare notify does not replace a pending value, which notifies too
+            if (item->type != SUBJECT_UPDATE_NOTIFY) {
+                replaced = s_parked[i];
+                s_parked[i] = *item;
+            } else {
+                replaced = *item;
+            }
+            s_dropped_count++;
+        } else if (s_parked_count < PARKED_MAX) {
+            s_parked[s_parked_count++] = *item;
+        } else {
+            replaced = *item;
+            full = true;
+        }
+    }
+    portEXIT_CRITICAL(&s_parked_lock);
+
+    // The heap cannot be used inside a critical section
+    free_item_payload(&replaced);
+    if (full) {
+        ESP_LOGW(TAG, "No slot to hold a suspended subject update");
+    }
+    return parked;
+}
+
 // Lazy initialization of queue
 static bool ensure_queue_initialized(void)
 {
@@ -72,6 +134,9 @@ bool radio_subject_set_int_async(lv_subject_t* subject, int32_t value)
     item.flags = 0;
     item.payload.int_value = value;
 
+    if (park_while_suspended(&item)) {
+        return true;
+    }
     if (xQueueSendToBack(s_update_queue, &item, 0) != pdPASS) {
         ESP_LOGD(TAG, "Subject update queue full (INT)");
         return false;
@@ -92,6 +157,9 @@ bool radio_subject_set_float_async(lv_subject_t* subject, float value)
     item.flags = 0;
     item.payload.float_value = value;
 
+    if (park_while_suspended(&item)) {
+        return true;
+    }
     if (xQueueSendToBack(s_update_queue, &item, 0) != pdPASS) {
         ESP_LOGD(TAG, "Subject update queue full (FLOAT)");
         return false;
@@ -141,6 +209,9 @@ bool radio_subject_set_pointer_async(lv_subject_t* subject, const void* data, si
         item.payload.heap_ptr = p;
     }
 
+    if (park_while_suspended(&item)) {
+        return true;
+    }
     if (xQueueSendToBack(s_update_queue, &item, 0) != pdPASS) {
         // Free heap payload if queue is full
         if (item.flags & 0x01) {
@@ -163,6 +234,9 @@ bool radio_subject_notify_async(lv_subject_t* subject)
     item.type = SUBJECT_UPDATE_NOTIFY;
     item.flags = 0;
 
+    if (park_while_suspended(&item)) {
+        return true;
+    }
     if (xQueueSendToBack(s_update_queue, &item, 0) != pdPASS) {
         ESP_LOGD(TAG, "Subject update queue full (NOTIFY)");
         return false;
@@ -211,6 +285,51 @@ void radio_subject_notify_direct(lv_subject_t* subject)
 // Queue Management
 // ============================================================================
 
+// Apply one update to its subject and release its payload (LVGL task only)
+static void apply_update(subject_update_item_t *item)
+{
+    switch (item->type) {
+        case SUBJECT_UPDATE_INT:
+            lv_subject_set_int(item->subject, item->payload.int_value);
+            break;
+
+        case SUBJECT_UPDATE_FLOAT:
+#if LV_USE_FLOAT
+            lv_subject_set_float(item->subject, item->payload.float_value);
+#endif
+            break;
+
+        case SUBJECT_UPDATE_POINTER: {
+            const void* src;
+            if (item->flags & 0x01) {
+                src = item->payload.heap_ptr;
+            } else {
+                src = item->payload.inline_bytes;
+            }
+            // IF data observers also get a mask of the fields that changed
+            if (item->subject == &radio_if_data_subject && item->payload_len == sizeof(kenwood_if_data_t)) {
+                radio_if_data_publish(src);
+                break;
+            }
+            // Get pointer to the static buffer from the subject
+            void* dest_buf = (void*)lv_subject_get_pointer(item->subject);
+            if (dest_buf != NULL && item->payload_len > 0) {
+                memcpy(dest_buf, src, item->payload_len);
+            }
+            // Notify observers that data changed
+            lv_subject_notify(item->subject);
+            break;
+        }
+
+        case SUBJECT_UPDATE_NOTIFY:
+            lv_subject_notify(item->subject);
+            break;
+    }
+
+    // Free heap payload if used
+    free_item_payload(item);
+}
+
 int radio_subject_drain_updates(void)
 {
     if (s_update_queue == NULL) {
@@ -226,50 +345,11 @@ int radio_subject_drain_updates(void)
 
         if (item.subject == NULL) {
             // Skip invalid items
-            if ((item.flags & 0x01) && item.payload.heap_ptr) {
-                heap_caps_free(item.payload.heap_ptr);
-            }
+            free_item_payload(&item);
             continue;
         }
 
-        switch (item.type) {
-            case SUBJECT_UPDATE_INT:
-                lv_subject_set_int(item.subject, item.payload.int_value);
-                break;
-
-            case SUBJECT_UPDATE_FLOAT:
-#if LV_USE_FLOAT
-                lv_subject_set_float(item.subject, item.payload.float_value);
-#endif
-                break;
-
-            case SUBJECT_UPDATE_POINTER: {
-                // Get pointer to the static buffer from the subject
-                void* dest_buf = (void*)lv_subject_get_pointer(item.subject);
-                if (dest_buf != NULL && item.payload_len > 0) {
-                    const void* src;
-                    if (item.flags & 0x01) {
-                        src = item.payload.heap_ptr;
-                    } else {
-                        src = item.payload.inline_bytes;
-                    }
-                    memcpy(dest_buf, src, item.payload_len);
-                }
-                // Notify observers that data changed
-                lv_subject_notify(item.subject);
-                break;
-            }
-
-            case SUBJECT_UPDATE_NOTIFY:
-                lv_subject_notify(item.subject);
-                break;
-        }
-
-        // Free heap payload if used
-        if ((item.flags & 0x01) && item.payload.heap_ptr) {
-            heap_caps_free(item.payload.heap_ptr);
-        }
-
+        apply_update(&item);
         processed++;
     }
 
@@ -289,3 +369,51 @@ int radio_subject_pending_count(void)
     }
     return (int)uxQueueMessagesWaiting(s_update_queue);
 }
+
+void radio_subject_set_suspended(bool suspended)
+{
+    if (s_suspended == suspended) {
+        return;
+    }
+
+    if (suspended) {
+        if (s_parked == NULL) {
+            s_parked = (subject_update_item_t*)heap_caps_calloc(PARKED_MAX, sizeof(subject_update_item_t),
+                                                                MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if (s_parked == NULL) {
+                ESP_LOGE(TAG, "Failed to allocate suspended update slots, not suspending");
+                return;
+            }
+        }
+        portENTER_CRITICAL(&s_parked_lock);
+        s_parked_count = 0;
+        s_suspended = true;
+        portEXIT_CRITICAL(&s_parked_lock);
+        ESP_LOGI(TAG, "Subject updates suspended (%" PRIu32 " superseded so far)", (uint32_t)s_dropped_count);
+        return;
+    }
+
+    // Nothing is queued while suspended, so updates still in the queue are
+    // older than the parked ones and must be applied first
+    while (radio_subject_drain_updates() > 0) {
+    }
+
+    // Publishers that see s_suspended cleared queue as normal; the slots are
+    // no longer written once it is cleared under the lock
+    portENTER_CRITICAL(&s_parked_lock);
+    s_suspended = false;
+    int count = s_parked_count;
+    s_parked_count = 0;
+    portEXIT_CRITICAL(&s_parked_lock);
+
+    for (int i = 0; i < count; i++) {
+        apply_update(&s_parked[i]);
+    }
+    ESP_LOGI(TAG, "Subject updates resumed (%d latest values applied, %" PRIu32 " superseded so far)",
+             count, (uint32_t)s_dropped_count);
+}
+
+uint32_t radio_subject_dropped_count(void)
+{
+    return s_dropped_count;
+}
@@ -141,6 +141,26 @@ int radio_subject_drain_updates(void);
  */
 int radio_subject_pending_count(void);
 
+/**
+ * @brief Suspend or resume observer dispatch
+ *
+ * While suspended (screensaver blanked), async updates are not queued: each
+ * subject keeps only its latest one, so no observers run and no widgets are
+ * invalidated. Resuming applies those latest values, so publishers that skip
+ * unchanged values still leave every display current. Must be called from
+ * the LVGL task.
+ *
+ * @param suspended true to hold updates, false to dispatch normally
+ */
+void radio_subject_set_suspended(bool suspended);
+
+/**
+ * @brief Get number of updates superseded by a newer one while suspended
+ *
+ * @return Running total since boot
+ */
+uint32_t radio_subject_dropped_count(void);
+
 #ifdef __cplusplus
 }
 #endif
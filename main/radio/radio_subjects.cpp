@@ -28,6 +28,10 @@ static antenna_system_state_t s_antenna_state_buffer = {0};
 static pep_data_t s_pep_buffer = {0};
 static memory_channel_data_t s_memory_channel_buffer = {0};
 
+// Change mask of the IF delivery in progress (ALL outside radio_if_data_publish)
+static uint32_t s_if_data_changed = RADIO_IF_CHANGED_ALL;
+static bool s_if_data_published = false;
+
 // ============================================================================
 // Subject Definitions - Metering
 // ============================================================================
@@ -320,3 +324,46 @@ memory_channel_data_t* radio_get_memory_channel_buffer(void)
 {
     return &s_memory_channel_buffer;
 }
+
+// ============================================================================
+// IF Data Change Mask
+// ============================================================================
+
+static uint32_t if_data_diff(const kenwood_if_data_t *prev, const kenwood_if_data_t *next)
+{
+    uint32_t changed = 0;
+    if (prev->vfo_frequency != next->vfo_frequency) changed |= RADIO_IF_CHANGED_VFO_FREQ;
+    if (prev->rit_xit_frequency != next->rit_xit_frequency) changed |= RADIO_IF_CHANGED_RIT_XIT_FREQ;
+    if (prev->rit_on != next->rit_on) changed |= RADIO_IF_CHANGED_RIT;
+    if (prev->xit_on != next->xit_on) changed |= RADIO_IF_CHANGED_XIT;
+    if (prev->memory_bank_channel != next->memory_bank_channel ||
+        prev->memory_channel != next->memory_channel) changed |= RADIO_IF_CHANGED_MEMORY;
+    if (prev->tx_rx != next->tx_rx) changed |= RADIO_IF_CHANGED_TX;
+    if (prev->mode != next->mode) changed |= RADIO_IF_CHANGED_MODE;
+    if (prev->function != next->function) changed |= RADIO_IF_CHANGED_FUNCTION;
+    if (prev->scan_on != next->scan_on) changed |= RADIO_IF_CHANGED_SCAN;
+    if (prev->split_on != next->split_on) changed |= RADIO_IF_CHANGED_SPLIT;
+    if (prev->tone_on != next->tone_on || prev->tone_number != next->tone_number) changed |= RADIO_IF_CHANGED_TONE;
+    if (prev->shift_status != next->shift_status) changed |= RADIO_IF_CHANGED_SHIFT;
+    if (prev->p15_value != next->p15_value) changed |= RADIO_IF_CHANGED_P15;
+    return changed;
+}
+
+uint32_t radio_if_data_changed(void)
+{
+    return s_if_data_changed;
+}
+
+void radio_if_data_publish(const void *data)
+{
+    kenwood_if_data_t next;
+    memcpy(&next, data, sizeof(next));
+
+    // Observers still show their initial state until the first delivery
+    s_if_data_changed = s_if_data_published ? if_data_diff(&s_if_data_buffer, &next) : RADIO_IF_CHANGED_ALL;
+    s_if_data_published = true;
+    s_if_data_buffer = next;
+
+    lv_subject_notify(&radio_if_data_subject);
+    s_if_data_changed = RADIO_IF_CHANGED_ALL;
+}
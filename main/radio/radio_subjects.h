@@ -318,6 +318,45 @@ pep_data_t* radio_get_pep_buffer(void);
 /** Get pointer to memory channel data buffer (for in-place modification) */
 memory_channel_data_t* radio_get_memory_channel_buffer(void);
 
+// ============================================================================
+// IF Data Change Mask
+// ============================================================================
+
+/** kenwood_if_data_t field groups reported by radio_if_data_changed() */
+#define RADIO_IF_CHANGED_VFO_FREQ       (1u << 0)   ///< vfo_frequency
+#define RADIO_IF_CHANGED_RIT_XIT_FREQ   (1u << 1)   ///< rit_xit_frequency
+#define RADIO_IF_CHANGED_RIT            (1u << 2)   ///< rit_on
+#define RADIO_IF_CHANGED_XIT            (1u << 3)   ///< xit_on
+#define RADIO_IF_CHANGED_MEMORY         (1u << 4)   ///< memory_bank_channel, memory_channel
+#define RADIO_IF_CHANGED_TX             (1u << 5)   ///< tx_rx
+#define RADIO_IF_CHANGED_MODE           (1u << 6)   ///< mode
+#define RADIO_IF_CHANGED_FUNCTION       (1u << 7)   ///< function
+#define RADIO_IF_CHANGED_SCAN           (1u << 8)   ///< scan_on
+#define RADIO_IF_CHANGED_SPLIT          (1u << 9)   ///< split_on
+#define RADIO_IF_CHANGED_TONE           (1u << 10)  ///< tone_on, tone_number
+#define RADIO_IF_CHANGED_SHIFT          (1u << 11)  ///< shift_status
+#define RADIO_IF_CHANGED_P15            (1u << 12)  ///< p15_value
+#define RADIO_IF_CHANGED_ALL            0xFFFFFFFFu
+
+/**
+ * @brief Fields of the IF data that changed since the previous delivery
+ *
+ * Valid inside radio_if_data_subject observer callbacks. Deliveries that do
+ * not come through radio_if_data_publish() (the first one, observer
+ * registration, radio_subject_notify_*) report RADIO_IF_CHANGED_ALL.
+ */
+uint32_t radio_if_data_changed(void);
+
+/**
+ * @brief Store new IF data and notify observers with its change mask
+ *
+ * Used by radio_subject_drain_updates() for radio_if_data_subject.
+ * Must be called from the LVGL task context.
+ *
+ * @param data New IF data (any alignment)
+ */
+void radio_if_data_publish(const void *data);
+
 #ifdef __cplusplus
 }
 #endif
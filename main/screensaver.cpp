@@ -11,6 +11,12 @@
 #include "esp_lvgl_port.h"
 #include "lvgl.h"
 #include "uart.h"  // For uart_write_raw to notify panel of state changes
+#include "cat_polling.h"
+#include "radio/radio_subject_updater.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
 
 static const char *TAG = "SCREENSAVER";
 
@@ -36,6 +42,129 @@ static void screensaver_check_cb(lv_timer_t *timer);
 static void screensaver_activate(void);
 static void screensaver_deactivate(void);
 
+// ============================================================================
+// Low-activity mode
+// ============================================================================
+// While blanked, CAT polling drops to a slow IF poll and subject updates are
+// held back (latest value per subject), so nothing hidden under the overlay
+// is redrawn. CPU load and CAT
+// traffic are sampled in fixed windows so the saving can be reported on wake.
+
+#define ACTIVITY_WINDOW_MS 10000
+
+typedef struct {
+    int64_t time_us;
+    uint32_t idle_runtime;   // Sum of IDLE task run time over all cores
+    uint32_t tx_messages;
+    uint32_t rx_bytes;
+} activity_sample_t;
+
+typedef struct {
+    uint32_t cpu_load_x10;   // Percent x10, averaged over all cores
+    uint32_t tx_msgs_per_s;
+    uint32_t rx_bytes_per_s;
+} activity_window_t;
+
+static activity_sample_t s_last_sample;
+static activity_window_t s_awake_window;     // Last complete window before blanking
+static activity_window_t s_blank_sum;        // Sum of windows while blanked
+static uint32_t s_blank_windows = 0;
+static int64_t s_blank_start_us = 0;
+static uint32_t s_blank_dropped_start = 0;
+
+static void activity_sample_take(activity_sample_t *sample) {
+    sample->time_us = esp_timer_get_time();
+    sample->idle_runtime = 0;
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        TaskStatus_t status;
+        vTaskGetInfo(xTaskGetIdleTaskHandleForCore(core), &status, pdFALSE, eInvalid);
+        sample->idle_runtime += status.ulRunTimeCounter;
+    }
+    uart_get_traffic_counters(&sample->tx_messages, NULL, &sample->rx_bytes);
+}
+
+// Run time counters are esp_timer microseconds; windows are short enough that
+// 32-bit deltas never wrap
+static void activity_window_compute(const activity_sample_t *from, const activity_sample_t *to,
+                                    activity_window_t *window) {
+    uint32_t elapsed_us = (uint32_t)(to->time_us - from->time_us);
+    if (elapsed_us == 0) {
+        memset(window, 0, sizeof(*window));
+        return;
+    }
+    uint64_t capacity_us = (uint64_t)elapsed_us * portNUM_PROCESSORS;
+    uint64_t idle_us = (uint32_t)(to->idle_runtime - from->idle_runtime);
+    if (idle_us > capacity_us) {
+        idle_us = capacity_us;
+    }
+    window->cpu_load_x10 = (uint32_t)(1000 - (idle_us * 1000) / capacity_us);
+    window->tx_msgs_per_s = (uint32_t)((uint64_t)(to->tx_messages - from->tx_messages) * 1000000ULL / elapsed_us);
+    window->rx_bytes_per_s = (uint32_t)((uint64_t)(to->rx_bytes - from->rx_bytes) * 1000000ULL / elapsed_us);
+}
+
+// Called from the 1 Hz check; closes a window every ACTIVITY_WINDOW_MS
+static void activity_window_tick(void) {
+    activity_sample_t now;
+    activity_sample_take(&now);
+    if (s_last_sample.time_us == 0) {
+        s_last_sample = now;
+        return;
+    }
+    if (now.time_us - s_last_sample.time_us < (int64_t)ACTIVITY_WINDOW_MS * 1000) {
+        return;
+    }
+
+    activity_window_t window;
+    activity_window_compute(&s_last_sample, &now, &window);
+    s_last_sample = now;
+
+    if (g_screensaver.active) {
+        s_blank_sum.cpu_load_x10 += window.cpu_load_x10;
+        s_blank_sum.tx_msgs_per_s += window.tx_msgs_per_s;
+        s_blank_sum.rx_bytes_per_s += window.rx_bytes_per_s;
+        s_blank_windows++;
+    } else {
+        s_awake_window = window;
+    }
+}
+
+static void low_activity_enter(void) {
+    memset(&s_blank_sum, 0, sizeof(s_blank_sum));
+    s_blank_windows = 0;
+    s_blank_start_us = esp_timer_get_time();
+    s_blank_dropped_start = radio_subject_dropped_count();
+    // Start the first blanked window now so it does not mix in awake traffic
+    activity_sample_take(&s_last_sample);
+
+    radio_subject_set_suspended(true);
+    cat_polling_set_low_activity(true);
+}
+
+static void low_activity_leave(void) {
+    radio_subject_set_suspended(false);
+    cat_polling_set_low_activity(false);
+
+    uint32_t blanked_s = (uint32_t)((esp_timer_get_time() - s_blank_start_us) / 1000000);
+    uint32_t dropped = radio_subject_dropped_count() - s_blank_dropped_start;
+    activity_sample_take(&s_last_sample);
+
+    if (s_blank_windows == 0) {
+        ESP_LOGI(TAG, "Blanked for %lu s (too short to measure), %lu subject updates superseded",
+                 (unsigned long)blanked_s, (unsigned long)dropped);
+        return;
+    }
+
+    uint32_t load_x10 = s_blank_sum.cpu_load_x10 / s_blank_windows;
+    ESP_LOGI(TAG, "Blanked for %lu s: CPU load %lu.%lu%% -> %lu.%lu%%, CAT TX %lu -> %lu msg/s, "
+             "RX %lu -> %lu B/s, %lu subject updates superseded",
+             (unsigned long)blanked_s,
+             (unsigned long)(s_awake_window.cpu_load_x10 / 10), (unsigned long)(s_awake_window.cpu_load_x10 % 10),
+             (unsigned long)(load_x10 / 10), (unsigned long)(load_x10 % 10),
+             (unsigned long)s_awake_window.tx_msgs_per_s, (unsigned long)(s_blank_sum.tx_msgs_per_s / s_blank_windows),
+             (unsigned long)s_awake_window.rx_bytes_per_s, (unsigned long)(s_blank_sum.rx_bytes_per_s / s_blank_windows),
+             (unsigned long)dropped);
+}
+
 /**
  * @brief Activate screensaver (blank screen + backlight off)
  */
@@ -81,6 +210,8 @@ static void screensaver_activate(void) {
     g_screensaver.active = true;
     ESP_LOGI(TAG, "Screensaver active - backlight off");
 
+    low_activity_enter();
+
     // Notify panel that display is now asleep
     (void) uart_write_raw("UIPS0;", 6);
 }
@@ -107,6 +238,8 @@ static void screensaver_deactivate(void) {
     g_screensaver.active = false;
     ESP_LOGI(TAG, "Screensaver deactivated - display restored");
 
+    low_activity_leave();
+
     // Notify panel that display is now awake
     (void) uart_write_raw("UIPS1;", 6);
 }
@@ -120,6 +253,8 @@ static void screensaver_deactivate(void) {
 static void screensaver_check_cb(lv_timer_t *timer) {
     (void)timer;
 
+    activity_window_tick();
+
     // Screensaver disabled - nothing to do
     if (g_screensaver.timeout == SCREENSAVER_DISABLED) {
         if (g_screensaver.active) {
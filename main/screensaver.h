@@ -4,6 +4,7 @@
  *
  * Activates screensaver (blank screen + backlight off) after configurable
  * period of inactivity. Tracks both touch input and radio data activity.
+ * While blanked, CAT polling and subject dispatch drop to a low-activity mode.
  */
 #ifndef SCREENSAVER_H
 #define SCREENSAVER_H
@@ -121,7 +121,18 @@ esp_err_t settings_load(user_settings_t *settings) {
         ESP_LOGD(TAG, "Antenna switch not found, using default: %s", settings->antenna_switch_enabled ? "ON" : "OFF");
     }
 
-    ESP_LOGI(TAG, "Settings loaded: XVTR=%s, CAT=%s, AI=%d, Peak=%s, Duration=%lums, PEP=%s, SMeter_Avg=%s, AntSwitch=%s",
+    // Load negotiated CAT baud rate
+    required_size = sizeof(value_u32);
+    err = nvs_get_blob(settings_nvs_handle, KEY_CAT_BAUD, &value_u32, &required_size);
+    if (err == ESP_OK && value_u32 >= 4800 && value_u32 <= 115200) {
+        settings->cat_baud_rate = value_u32;
+        ESP_LOGD(TAG, "Loaded CAT baud rate: %lu", settings->cat_baud_rate);
+    } else {
+        settings->cat_baud_rate = DEFAULT_CAT_BAUD;
+        ESP_LOGD(TAG, "CAT baud rate not found or invalid, negotiating at startup");
+    }
+
+    ESP_LOGI(TAG, "Settings loaded: XVTR=%s, CAT=%s, AI=%d, Peak=%s, Duration=%lums, PEP=%s, SMeter_Avg=%s, AntSwitch=%s, Baud=%lu",
              settings->xvtr_offset_mix_enabled ? "ON" : "OFF",
              settings->cat_polling_enabled ? "ON" : "OFF",
              settings->ai_mode,
@@ -129,7 +140,8 @@ esp_err_t settings_load(user_settings_t *settings) {
              settings->peak_hold_duration_ms,
              settings->pep_enabled ? "ON" : "OFF",
              settings->smeter_averaging_enabled ? "ON" : "OFF",
-             settings->antenna_switch_enabled ? "ON" : "OFF");
+             settings->antenna_switch_enabled ? "ON" : "OFF",
+             settings->cat_baud_rate);
     
     return ESP_OK;
 }
@@ -212,6 +224,13 @@ esp_err_t settings_save(const user_settings_t *settings) {
         return err;
     }
 
+    // Save negotiated CAT baud rate
+    err = nvs_set_blob(settings_nvs_handle, KEY_CAT_BAUD, &settings->cat_baud_rate, sizeof(settings->cat_baud_rate));
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save CAT baud rate: %s", esp_err_to_name(err));
+        return err;
+    }
+
     // Commit changes to flash
     err = nvs_commit(settings_nvs_handle);
     if (err != ESP_OK) {
@@ -219,7 +238,7 @@ esp_err_t settings_save(const user_settings_t *settings) {
         return err;
     }
 
-    ESP_LOGI(TAG, "Settings saved: XVTR=%s, CAT=%s, AI=%d, Peak=%s, Duration=%lums, PEP=%s, SMeter_Avg=%s, AntSwitch=%s",
+    ESP_LOGI(TAG, "Settings saved: XVTR=%s, CAT=%s, AI=%d, Peak=%s, Duration=%lums, PEP=%s, SMeter_Avg=%s, AntSwitch=%s, Baud=%lu",
              settings->xvtr_offset_mix_enabled ? "ON" : "OFF",
              settings->cat_polling_enabled ? "ON" : "OFF",
              settings->ai_mode,
@@ -227,7 +246,8 @@ esp_err_t settings_save(const user_settings_t *settings) {
              settings->peak_hold_duration_ms,
              settings->pep_enabled ? "ON" : "OFF",
              settings->smeter_averaging_enabled ? "ON" : "OFF",
-             settings->antenna_switch_enabled ? "ON" : "OFF");
+             settings->antenna_switch_enabled ? "ON" : "OFF",
+             settings->cat_baud_rate);
     
     return ESP_OK;
 }
@@ -333,6 +353,17 @@ esp_err_t settings_save_antenna_switch(bool enabled) {
     return err;
 }
 
+esp_err_t settings_save_cat_baud(uint32_t baud_rate) {
+    if (settings_nvs_handle == 0) return ESP_ERR_INVALID_STATE;
+
+    esp_err_t err = nvs_set_blob(settings_nvs_handle, KEY_CAT_BAUD, &baud_rate, sizeof(baud_rate));
+    if (err == ESP_OK) {
+        err = nvs_commit(settings_nvs_handle);
+        ESP_LOGD(TAG, "CAT baud rate saved: %lu", baud_rate);
+    }
+    return err;
+}
+
 esp_err_t settings_get_current(user_settings_t *settings) {
     if (!settings) {
         return ESP_ERR_INVALID_ARG;
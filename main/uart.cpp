@@ -5,12 +5,19 @@
 #include "esp_task_wdt.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "cat_parser.h"
 #include "gps_client.h"
 #include "lvgl.h"
 #include "task_handles.h" // For task handle getter declarations
 #include "memory_monitor.h" // For hardware health monitoring
 #include "esp_timer.h" // For timestamp monitoring
+#include "uart_tx_arena.h"
+#include "cat_rx_framer.h"
+#include "settings_storage.h" // For the persisted CAT baud rate
+#include "cat_transaction.h" // Routes answers to pending transactions
+#include <ctype.h>
+#include <string.h>
 
 #define BUF_SIZE (4096)  // Increased from 1024 to prevent interrupt watchdog timeouts
 static const char *TAG = "UART";
@@ -36,6 +43,21 @@ static const uart_port_t s_uart_port = UART_NUM_1; // Fallback
 #ifndef CONFIG_CAT_UART_BAUD
 #define CONFIG_CAT_UART_BAUD 57600
 #endif
+#ifndef CONFIG_CAT_TX_INFLIGHT_TIMEOUT_MS
+#define CONFIG_CAT_TX_INFLIGHT_TIMEOUT_MS 300
+#endif
+#ifndef CONFIG_CAT_TX_ARENA_SIZE
+#define CONFIG_CAT_TX_ARENA_SIZE 1024
+#endif
+#ifndef CONFIG_CAT_UART_BAUD_MAX
+#define CONFIG_CAT_UART_BAUD_MAX 115200
+#endif
+#ifndef CONFIG_CAT_BAUD_MENU
+#define CONFIG_CAT_BAUD_MENU 67
+#endif
+#ifndef CONFIG_CAT_BAUD_FALLBACK_ERRORS
+#define CONFIG_CAT_BAUD_FALLBACK_ERRORS 10
+#endif
 
 #define CAT_UART_TX_PIN CONFIG_CAT_UART_TX_PIN
 #define CAT_UART_RX_PIN CONFIG_CAT_UART_RX_PIN
@@ -54,12 +76,515 @@ static TaskHandle_t uart_tx_task_handle = NULL; // Handle for the UART TX task
 typedef struct {
     char data[UART_TX_MESSAGE_BUFFER_SIZE];
     size_t len;
+    int16_t arena_first;  // First arena block of a long message, -1 when data is inline
+    uint8_t arena_blocks; // Blocks to release once the long message has been written
 } uart_tx_item_t;
 
+// ============================================================================
+// Long message arena
+// ============================================================================
+// Commands longer than a queue slot (MXW macro writes carry a name and a full
+// command list) are staged in a small block arena. Their queue item only refers
+// to the arena run, so the 20-slot queue stays sized for short polling commands.
+
+static_assert(UART_TX_ARENA_BLOCKS(CONFIG_CAT_TX_LONG_MAX_LEN) <= CONFIG_CAT_TX_ARENA_SIZE / UART_TX_ARENA_BLOCK_SIZE,
+              "CAT_TX_ARENA_SIZE must hold one command of CAT_TX_LONG_MAX_LEN");
+
+static uint8_t s_tx_arena_mem[CONFIG_CAT_TX_ARENA_SIZE];
+static uart_tx_arena_t s_tx_arena;
+static portMUX_TYPE s_tx_arena_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool s_tx_arena_ready = false;
+static uint32_t s_tx_long_messages = 0;
+static uint32_t s_tx_long_bytes = 0;
+static uint32_t s_tx_long_dropped = 0;
+
+// Link traffic totals for activity reporting (single writer each)
+static volatile uint32_t s_tx_total_messages = 0;
+static volatile uint32_t s_tx_total_bytes = 0;
+static volatile uint32_t s_rx_total_bytes = 0;
+
+// ============================================================================
+// CAT baud negotiation
+// ============================================================================
+// The IF answer is 38 bytes, ~6.6ms of wire time at 57600. At startup the link
+// is located (ID; probe at the stored rate, the configured rate, then every
+// rate), then the radio's COM speed menu is stepped up to CAT_UART_BAUD_MAX and
+// the new rate verified with another probe. A burst of garbled frames drops the
+// link back to the configured rate. The working rate is persisted so the next
+// boot finds the radio on the first probe.
+//
+// Negotiation runs once, at boot. A UART recovery reopens the port at the last
+// working rate and only probes for the radio again after several reopens in a
+// row without a valid frame; the rescan never sends the COM speed menu
+// command. Queued commands are held back while probing.
+
+#define UART_BAUD_PROBE_TIMEOUT_MS 150
+#define UART_BAUD_SETTLE_MS 50
+#define UART_BAUD_ERROR_WINDOW_MS 2000
+#define UART_IF_ANSWER_BYTES 38
+#define UART_BAUD_RESCAN_REOPENS 3
+
+// Index matches the radio's COM speed menu values
+static const uint32_t s_baud_rates[] = {4800, 9600, 19200, 38400, 57600, 115200};
+#define UART_BAUD_RATE_COUNT (sizeof(s_baud_rates) / sizeof(s_baud_rates[0]))
+
+typedef struct {
+    uint64_t bytes;
+    uint64_t ms;
+} uart_baud_usage_t;
+
+static uint32_t s_link_baud = CONFIG_CAT_UART_BAUD;
+static uart_baud_usage_t s_baud_usage[UART_BAUD_RATE_COUNT];
+static uint32_t s_baud_fallbacks = 0;
+static bool s_baud_negotiated = false;
+static uint32_t s_reopens_without_frame = 0;
+
+// Held by uart_tx_task around each write and by the baud probes, so no queued
+// command goes out between a probe and its answer or at a rate being switched
+static SemaphoreHandle_t s_tx_write_lock = NULL;
+
+static void uart_tx_pause(void) {
+    if (s_tx_write_lock != NULL) {
+        xSemaphoreTake(s_tx_write_lock, portMAX_DELAY);
+    }
+}
+
+static void uart_tx_resume(void) {
+    if (s_tx_write_lock != NULL) {
+        xSemaphoreGive(s_tx_write_lock);
+    }
+}
+
+static int uart_baud_index(uint32_t baud) {
+    for (size_t i = 0; i < UART_BAUD_RATE_COUNT; i++) {
+        if (s_baud_rates[i] == baud) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+// Sends ID; at the given rate and waits for an ID answer. Only used while
+// nothing else reads the port (init_uart, or from within read_uart) and with
+// the TX task paused.
+static bool uart_probe_link(uint32_t baud) {
+    char rx[64];
+    size_t rx_len = 0;
+
+    uart_wait_tx_done(s_uart_port, pdMS_TO_TICKS(UART_BAUD_PROBE_TIMEOUT_MS));
+    uart_set_baudrate(s_uart_port, baud);
+    for (int attempt = 0; attempt < 2; attempt++) {
+        uart_flush_input(s_uart_port);
+        uart_write_bytes(s_uart_port, "ID;", 3);
+        const int64_t deadline_us = esp_timer_get_time() + UART_BAUD_PROBE_TIMEOUT_MS * 1000;
+        rx_len = 0;
+        while (esp_timer_get_time() < deadline_us && rx_len < sizeof(rx) - 1) {
+            int len = uart_read_bytes(s_uart_port, (uint8_t *)rx + rx_len, sizeof(rx) - 1 - rx_len, pdMS_TO_TICKS(10));
+            if (len > 0) {
+                rx_len += len;
+                rx[rx_len] = '\0';
+                // Answers to earlier polls may arrive first; any ID<nnn>; is proof enough
+                const char *id = strstr(rx, "ID");
+                if (id != NULL && strlen(id) >= 6 && isdigit((unsigned char)id[2]) && id[5] == ';') {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// Asks the radio to change its COM speed, follows it locally and verifies the link
+static bool uart_switch_link_baud(uint32_t from, uint32_t to) {
+    char cmd[16];
+    int index = uart_baud_index(to);
+    if (index < 0) {
+        return false;
+    }
+    uart_set_baudrate(s_uart_port, from);
+    snprintf(cmd, sizeof(cmd), "EX%03d0000%d;", CONFIG_CAT_BAUD_MENU, index);
+    uart_write_bytes(s_uart_port, cmd, strlen(cmd));
+    uart_wait_tx_done(s_uart_port, pdMS_TO_TICKS(UART_BAUD_PROBE_TIMEOUT_MS));
+    vTaskDelay(pdMS_TO_TICKS(UART_BAUD_SETTLE_MS));
+    return uart_probe_link(to);
+}
+
+static uint32_t uart_scan_link_baud(uint32_t first_choice) {
+    if (first_choice != 0 && uart_probe_link(first_choice)) {
+        return first_choice;
+    }
+    if (first_choice != CONFIG_CAT_UART_BAUD && uart_probe_link(CONFIG_CAT_UART_BAUD)) {
+        return CONFIG_CAT_UART_BAUD;
+    }
+    for (int i = UART_BAUD_RATE_COUNT - 1; i >= 0; i--) {
+        if (s_baud_rates[i] == first_choice || s_baud_rates[i] == CONFIG_CAT_UART_BAUD) {
+            continue;
+        }
+        esp_task_wdt_reset();
+        if (uart_probe_link(s_baud_rates[i])) {
+            return s_baud_rates[i];
+        }
+    }
+    return 0;
+}
+
+static void uart_set_link_baud(uint32_t baud, uint32_t stored) {
+    s_link_baud = baud;
+    uart_set_baudrate(s_uart_port, baud);
+    uart_flush_input(s_uart_port);
+    if (baud != stored) {
+        settings_save_cat_baud(baud);
+    }
+}
+
+static void uart_negotiate_baud(void) {
+    user_settings_t settings;
+    uint32_t stored = (settings_load(&settings) == ESP_OK) ? settings.cat_baud_rate : DEFAULT_CAT_BAUD;
+
+    s_baud_negotiated = true;
+    uint32_t current = uart_scan_link_baud(stored != 0 ? stored : s_link_baud);
+    if (current == 0) {
+        // Radio off or not connected - it most likely still runs at the stored
+        // rate; recovery rescans if it does not
+        s_link_baud = (uart_baud_index(stored) >= 0) ? stored : CONFIG_CAT_UART_BAUD;
+        ESP_LOGW(TAG, "CAT baud negotiation: no answer from radio, staying at %lu", (unsigned long)s_link_baud);
+        uart_set_baudrate(s_uart_port, s_link_baud);
+        return;
+    }
+
+    // A stored rate below the maximum means an earlier fallback; don't retry the faster rate
+    const uint32_t target = CONFIG_CAT_UART_BAUD_MAX;
+    if (current < target && (stored == 0 || stored >= target)) {
+        if (uart_switch_link_baud(current, target)) {
+            ESP_LOGI(TAG, "CAT baud negotiation: %lu -> %lu", (unsigned long)current, (unsigned long)target);
+            current = target;
+        } else if (!uart_probe_link(current)) {
+            // Radio switched but the link is unusable at the new rate - switch it back
+            uart_switch_link_baud(target, current);
+            ESP_LOGW(TAG, "CAT baud negotiation: %lu unreliable, staying at %lu",
+                     (unsigned long)target, (unsigned long)current);
+        }
+    }
+
+    uart_set_link_baud(current, stored);
+    ESP_LOGI(TAG, "CAT link running at %lu baud", (unsigned long)s_link_baud);
+}
+
+// Called from init_uart when reopening the port has not brought the link back
+static void uart_rescan_baud(void) {
+    uint32_t from = s_link_baud;
+    uint32_t current = uart_scan_link_baud(from);
+    s_reopens_without_frame = 0;
+    if (current == 0) {
+        ESP_LOGW(TAG, "CAT baud rescan: no answer from radio, staying at %lu", (unsigned long)from);
+        uart_set_baudrate(s_uart_port, from);
+        return;
+    }
+    if (current != from) {
+        ESP_LOGW(TAG, "CAT baud rescan: radio found at %lu (was %lu)", (unsigned long)current, (unsigned long)from);
+    }
+    uart_set_link_baud(current, from);
+}
+
+// Called from read_uart after a burst of garbled frames
+static void uart_baud_fallback(void) {
+    uint32_t from = s_link_baud;
+    if (from <= CONFIG_CAT_UART_BAUD) {
+        return; // Already at the configured rate; normal UART recovery handles the rest
+    }
+    ESP_LOGW(TAG, "CAT link errors at %lu baud, falling back to %d", (unsigned long)from, CONFIG_CAT_UART_BAUD);
+    s_baud_fallbacks++;
+
+    uart_tx_pause();
+    uint32_t current = CONFIG_CAT_UART_BAUD;
+    if (!uart_switch_link_baud(from, current)) {
+        current = uart_scan_link_baud(current);
+        if (current == 0) {
+            current = CONFIG_CAT_UART_BAUD;
+        }
+    }
+    uart_set_link_baud(current, from);
+    uart_tx_resume();
+}
+
+// Kenwood answers are printable ASCII starting with an uppercase command or '?'.
+// Anything else is what a mismatched or marginal baud rate produces.
+static bool uart_frame_looks_valid(const char *frame, int len) {
+    if (!isupper((unsigned char)frame[0]) && frame[0] != '?') {
+        return false;
+    }
+    for (int i = 1; i < len; i++) {
+        if (frame[i] < 0x20 || frame[i] > 0x7E) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void uart_baud_account(uint32_t bytes, uint32_t elapsed_ms) {
+    int index = uart_baud_index(s_link_baud);
+    if (index >= 0) {
+        s_baud_usage[index].bytes += bytes;
+        s_baud_usage[index].ms += elapsed_ms;
+    }
+}
+
+static void uart_log_baud_stats(void) {
+    ESP_LOGI(TAG, "CAT link: %lu baud (configured %d, max %d), %lu fallbacks",
+             (unsigned long)s_link_baud, CONFIG_CAT_UART_BAUD, CONFIG_CAT_UART_BAUD_MAX,
+             (unsigned long)s_baud_fallbacks);
+    for (size_t i = 0; i < UART_BAUD_RATE_COUNT; i++) {
+        const uint32_t baud = s_baud_rates[i];
+        // 10 bits per byte on the wire (8N1)
+        const uint32_t if_wire_us = (uint32_t)((UART_IF_ANSWER_BYTES * 10ULL * 1000000ULL) / baud);
+        if (s_baud_usage[i].ms == 0 && baud != CONFIG_CAT_UART_BAUD && baud != s_link_baud) {
+            continue;
+        }
+        const uint64_t bytes_per_sec = s_baud_usage[i].ms > 0 ? (s_baud_usage[i].bytes * 1000ULL) / s_baud_usage[i].ms : 0;
+        ESP_LOGI(TAG, "  %6lu baud: %llu B/s received over %llu s, capacity %lu B/s, IF answer %lu.%lu ms on wire",
+                 (unsigned long)baud, (unsigned long long)bytes_per_sec,
+                 (unsigned long long)(s_baud_usage[i].ms / 1000ULL), (unsigned long)(baud / 10),
+                 (unsigned long)(if_wire_us / 1000), (unsigned long)((if_wire_us % 1000) / 100));
+    }
+}
+
+// ============================================================================
+// In-flight query deduplication
+// ============================================================================
+// Polling timers, the periodic refresh, UI events and the AI monitor all queue
+// the same read queries independently. While a query is outstanding (queued but
+// its answer not yet parsed) further copies are dropped here, so a slow radio
+// does not accumulate a backlog of identical requests and redundant answers.
+
+#define UART_INFLIGHT_MAX_ENTRIES 48
+#define UART_INFLIGHT_KEY_SIZE 12
+
+typedef struct {
+    char key[UART_INFLIGHT_KEY_SIZE]; // Query without terminator, e.g. "IF", "EX0060000"
+    uint8_t key_len;
+    bool pending;                     // Sent and not yet answered
+    int64_t sent_us;                  // Time the outstanding copy was queued
+    uint32_t sent;                    // Copies actually queued for transmit
+    uint32_t suppressed;              // Duplicates dropped while pending
+} uart_inflight_entry_t;
+
+static uart_inflight_entry_t s_inflight[UART_INFLIGHT_MAX_ENTRIES];
+static size_t s_inflight_count = 0;
+static portMUX_TYPE s_inflight_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Bare two-letter reads. Only these are deduplicated: other bare commands
+// (TX, RX, UP, DN, BU, BD, ...) are actions and must always be sent.
+static const char s_bare_queries[][3] = {
+    "AC", "AI", "BC", "DA", "FA", "FB", "FL", "FR", "FS", "FT", "FW", "GC", "ID",
+    "IF", "LK", "MC", "MD", "ML", "NB", "NR", "NT", "PA", "PC", "PR", "PS", "QR",
+    "RA", "RT", "SH", "SL", "SM", "SP", "TO", "TP", "TS", "VX", "XI", "XO", "XT",
+};
+
+// Parameterised read forms: fixed total length, digits after the prefix.
+static const struct {
+    const char *prefix;
+    uint8_t len;
+} s_query_forms[] = {
+    {"EX", 9},  // EX<menu:3>0000 - menu read
+    {"MR", 6},  // MR<p1><ch:3>   - memory channel read
+    {"MXR", 5}, // MXR<id:2>      - macro read
+    {"MXA", 3}, // MXA            - F-key assignment read
+    {"RM", 3},  // RM<type>       - meter read
+    {"SM", 3},  // SM0            - S-meter read
+    {"SQ", 3},  // SQ0            - squelch read
+};
+
+static bool uart_is_query(const char *cmd, size_t len) {
+    if (len == 2) {
+        for (size_t i = 0; i < sizeof(s_bare_queries) / sizeof(s_bare_queries[0]); i++) {
+            if (cmd[0] == s_bare_queries[i][0] && cmd[1] == s_bare_queries[i][1]) {
+                return true;
+            }
+        }
+        return false;
+    }
+    for (size_t i = 0; i < sizeof(s_query_forms) / sizeof(s_query_forms[0]); i++) {
+        size_t prefix_len = strlen(s_query_forms[i].prefix);
+        if (len != s_query_forms[i].len || strncmp(cmd, s_query_forms[i].prefix, prefix_len) != 0) {
+            continue;
+        }
+        for (size_t j = prefix_len; j < len; j++) {
+            if (!isdigit((unsigned char)cmd[j])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+// Must be called with s_inflight_lock held
+static uart_inflight_entry_t *uart_inflight_lookup(const char *cmd, size_t len, int64_t now_us) {
+    uart_inflight_entry_t *reuse = NULL;
+    for (size_t i = 0; i < s_inflight_count; i++) {
+        uart_inflight_entry_t *e = &s_inflight[i];
+        if (e->key_len == len && memcmp(e->key, cmd, len) == 0) {
+            return e;
+        }
+        // Remember the least recently sent idle entry in case the table is full
+        if (!e->pending && (reuse == NULL || e->sent_us < reuse->sent_us)) {
+            reuse = e;
+        }
+    }
+    if (s_inflight_count < UART_INFLIGHT_MAX_ENTRIES) {
+        reuse = &s_inflight[s_inflight_count++];
+    }
+    if (reuse == NULL) {
+        return NULL; // Every slot has an outstanding query; don't track this one
+    }
+    memset(reuse, 0, sizeof(*reuse));
+    memcpy(reuse->key, cmd, len);
+    reuse->key_len = (uint8_t)len;
+    reuse->sent_us = now_us;
+    return reuse;
+}
+
+// Copies message to out, leaving out any query that is already in flight.
+// Returns the length written; 0 means every command in the message was a duplicate.
+static size_t uart_inflight_filter(const char *message, size_t len, char *out) {
+#if CONFIG_CAT_TX_DEDUP_ENABLE
+    const int64_t now_us = esp_timer_get_time();
+    const int64_t timeout_us = (int64_t)CONFIG_CAT_TX_INFLIGHT_TIMEOUT_MS * 1000;
+    size_t out_len = 0;
+    size_t start = 0;
+
+    taskENTER_CRITICAL(&s_inflight_lock);
+    while (start < len) {
+        const char *sep = (const char *)memchr(message + start, ';', len - start);
+        size_t cmd_len = sep ? (size_t)(sep - (message + start)) : (len - start);
+        size_t seg_len = sep ? cmd_len + 1 : cmd_len;
+        const char *cmd = message + start;
+        bool keep = true;
+
+        if (sep && cmd_len < UART_INFLIGHT_KEY_SIZE && uart_is_query(cmd, cmd_len)) {
+            uart_inflight_entry_t *e = uart_inflight_lookup(cmd, cmd_len, now_us);
+            if (e != NULL) {
+                if (e->pending && (now_us - e->sent_us) < timeout_us) {
+                    e->suppressed++;
+                    keep = false;
+                } else {
+                    e->pending = true;
+                    e->sent_us = now_us;
+                    e->sent++;
+                }
+            }
+        } else if (sep && cmd_len > 2) {
+            // A set command makes the outstanding answer to its bare read stale,
+            // so the next read must go out (e.g. NR1; NR; NR2; NR;)
+            for (size_t i = 0; i < s_inflight_count; i++) {
+                uart_inflight_entry_t *e = &s_inflight[i];
+                if (e->key_len == 2 && e->key[0] == cmd[0] && e->key[1] == cmd[1]) {
+                    e->pending = false;
+                    break;
+                }
+            }
+        }
+
+        if (keep) {
+            memcpy(out + out_len, cmd, seg_len);
+            out_len += seg_len;
+        }
+        start += seg_len;
+    }
+    taskEXIT_CRITICAL(&s_inflight_lock);
+    return out_len;
+#else
+    memcpy(out, message, len);
+    return len;
+#endif
+}
+
+// Undoes uart_inflight_filter() for a filtered message that could not be queued,
+// so the queries it marked are not suppressed until the in-flight timeout
+static void uart_inflight_cancel(const char *sent, size_t len) {
+#if CONFIG_CAT_TX_DEDUP_ENABLE
+    size_t start = 0;
+
+    taskENTER_CRITICAL(&s_inflight_lock);
+    while (start < len) {
+        const char *sep = (const char *)memchr(sent + start, ';', len - start);
+        size_t cmd_len = sep ? (size_t)(sep - (sent + start)) : (len - start);
+        const char *cmd = sent + start;
+
+        if (sep && cmd_len < UART_INFLIGHT_KEY_SIZE) {
+            for (size_t i = 0; i < s_inflight_count; i++) {
+                uart_inflight_entry_t *e = &s_inflight[i];
+                if (e->pending && e->key_len == cmd_len && memcmp(e->key, cmd, cmd_len) == 0) {
+                    e->pending = false;
+                    if (e->sent > 0) {
+                        e->sent--;
+                    }
+                    break;
+                }
+            }
+        }
+        start += sep ? cmd_len + 1 : cmd_len;
+    }
+    taskEXIT_CRITICAL(&s_inflight_lock);
+#else
+    (void)sent;
+    (void)len;
+#endif
+}
+
+// Called by the parser task for every received frame; clears matching queries
+static void uart_inflight_complete(const char *answer) {
+#if CONFIG_CAT_TX_DEDUP_ENABLE
+    taskENTER_CRITICAL(&s_inflight_lock);
+    for (size_t i = 0; i < s_inflight_count; i++) {
+        uart_inflight_entry_t *e = &s_inflight[i];
+        if (e->pending && e->key[0] == answer[0] && strncmp(answer, e->key, e->key_len) == 0) {
+            e->pending = false;
+        }
+    }
+    taskEXIT_CRITICAL(&s_inflight_lock);
+#else
+    (void)answer;
+#endif
+}
+
+static void uart_inflight_reset(void) {
+    taskENTER_CRITICAL(&s_inflight_lock);
+    for (size_t i = 0; i < s_inflight_count; i++) {
+        s_inflight[i].pending = false;
+    }
+    taskEXIT_CRITICAL(&s_inflight_lock);
+}
+
+void uart_log_tx_dedup_stats(void) {
+    uart_inflight_entry_t snapshot[UART_INFLIGHT_MAX_ENTRIES];
+    size_t count;
+
+    taskENTER_CRITICAL(&s_inflight_lock);
+    count = s_inflight_count;
+    memcpy(snapshot, s_inflight, count * sizeof(snapshot[0]));
+    taskEXIT_CRITICAL(&s_inflight_lock);
+
+    uint32_t total_sent = 0;
+    uint32_t total_suppressed = 0;
+    for (size_t i = 0; i < count; i++) {
+        total_sent += snapshot[i].sent;
+        total_suppressed += snapshot[i].suppressed;
+    }
+    ESP_LOGI(TAG, "TX query dedup: %lu sent, %lu suppressed (%u tracked)",
+             (unsigned long)total_sent, (unsigned long)total_suppressed, (unsigned)count);
+    for (size_t i = 0; i < count; i++) {
+        if (snapshot[i].suppressed > 0) {
+            ESP_LOGI(TAG, "  %.*s: sent=%lu suppressed=%lu", snapshot[i].key_len, snapshot[i].key,
+                     (unsigned long)snapshot[i].sent, (unsigned long)snapshot[i].suppressed);
+        }
+    }
+}
+
 esp_err_t init_uart() {
-    ESP_LOGI(TAG, "Initializing UART: port=%d tx=%d rx=%d baud=%d", s_uart_port, CAT_UART_TX_PIN, CAT_UART_RX_PIN, CONFIG_CAT_UART_BAUD);
+    ESP_LOGI(TAG, "Initializing UART: port=%d tx=%d rx=%d baud=%lu", s_uart_port, CAT_UART_TX_PIN, CAT_UART_RX_PIN, (unsigned long)s_link_baud);
     const uart_config_t uart_config = {
-        .baud_rate = CONFIG_CAT_UART_BAUD,
+        .baud_rate = (int)s_link_baud, // Last working rate when re-initialising after a fault
         .data_bits = UART_DATA_8_BITS,
         .parity = UART_PARITY_DISABLE,
         .stop_bits = UART_STOP_BITS_1,
@@ -87,6 +612,37 @@ esp_err_t init_uart() {
         return ret;
     }
 
+    if (s_tx_write_lock == NULL) {
+        s_tx_write_lock = xSemaphoreCreateMutex();
+        if (s_tx_write_lock == NULL) {
+            ESP_LOGE(TAG, "Failed to create UART TX write lock");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+#if CONFIG_CAT_BAUD_NEGOTIATE
+    // Full negotiation at boot only; a reopen keeps s_link_baud (set above)
+    uart_tx_pause();
+    if (!s_baud_negotiated) {
+        uart_negotiate_baud();
+    } else if (++s_reopens_without_frame >= UART_BAUD_RESCAN_REOPENS) {
+        uart_rescan_baud();
+    }
+    uart_tx_resume();
+#endif
+
+    // Answers to anything sent before a (re)init will never arrive
+    uart_inflight_reset();
+
+    // Once only: after a recovery the previous TX task may still be writing
+    // an arena run, and releases it into the same arena afterwards
+    if (!s_tx_arena_ready) {
+        taskENTER_CRITICAL(&s_tx_arena_lock);
+        uart_tx_arena_init(&s_tx_arena, s_tx_arena_mem, sizeof(s_tx_arena_mem));
+        taskEXIT_CRITICAL(&s_tx_arena_lock);
+        s_tx_arena_ready = true;
+    }
+
     uart_tx_queue = xQueueCreate(UART_TX_QUEUE_SIZE, sizeof(uart_tx_item_t));
     if (uart_tx_queue == NULL) {
         ESP_LOGE(TAG, "Failed to create UART TX queue");
@@ -138,8 +694,22 @@ void uart_tx_task(void *pvParameters) {
             // Feed watchdog before potentially blocking UART write
             feed_watchdog();
             
-            uart_write_bytes(s_uart_port, tx_item.data, tx_item.len);
-            // No free needed as data is part of tx_item structure
+            // Baud probes hold the lock for up to a couple of seconds
+            while (xSemaphoreTake(s_tx_write_lock, pdMS_TO_TICKS(100)) != pdTRUE) {
+                feed_watchdog();
+            }
+            if (tx_item.arena_first >= 0) {
+                uart_write_bytes(s_uart_port, uart_tx_arena_ptr(&s_tx_arena, tx_item.arena_first), tx_item.len);
+                taskENTER_CRITICAL(&s_tx_arena_lock);
+                uart_tx_arena_free(&s_tx_arena, tx_item.arena_first, tx_item.arena_blocks);
+                taskEXIT_CRITICAL(&s_tx_arena_lock);
+            } else {
+                uart_write_bytes(s_uart_port, tx_item.data, tx_item.len);
+                // No free needed as data is part of tx_item structure
+            }
+            xSemaphoreGive(s_tx_write_lock);
+            s_tx_total_messages++;
+            s_tx_total_bytes += tx_item.len;
         } else {
             // No message received within 500ms
             consecutive_empty_cycles++;
@@ -170,6 +740,71 @@ void uart_tx_task(void *pvParameters) {
     }
 }
 
+// Stages a message too long for a queue slot in the arena and queues a reference to it
+static esp_err_t uart_write_long_message(const char *message, size_t len) {
+    const size_t needed = len + 3; // \r\n and \0
+    int first = -1;
+
+    // Give the TX task up to the same 100ms the queue send allows to drain earlier long writes
+    for (int attempt = 0; attempt < 20; attempt++) {
+        taskENTER_CRITICAL(&s_tx_arena_lock);
+        first = uart_tx_arena_alloc(&s_tx_arena, needed);
+        taskEXIT_CRITICAL(&s_tx_arena_lock);
+        if (first >= 0) {
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    if (first < 0) {
+        s_tx_long_dropped++;
+        ESP_LOGE(TAG, "TX arena full, dropping %u byte message", (unsigned)len);
+        return ESP_ERR_NO_MEM;
+    }
+
+    uart_tx_item_t tx_item;
+    tx_item.arena_first = (int16_t)first;
+    tx_item.arena_blocks = uart_tx_arena_blocks_for(needed);
+    tx_item.data[0] = '\0';
+
+    char *buf = uart_tx_arena_ptr(&s_tx_arena, first);
+    size_t filtered_len = uart_inflight_filter(message, len, buf);
+    if (filtered_len == 0) {
+        taskENTER_CRITICAL(&s_tx_arena_lock);
+        uart_tx_arena_free(&s_tx_arena, tx_item.arena_first, tx_item.arena_blocks);
+        taskEXIT_CRITICAL(&s_tx_arena_lock);
+        return ESP_OK;
+    }
+    buf[filtered_len] = '\r';
+    buf[filtered_len + 1] = '\n';
+    buf[filtered_len + 2] = '\0';
+    tx_item.len = filtered_len + 2;
+
+    if (xQueueSend(uart_tx_queue, &tx_item, pdMS_TO_TICKS(100)) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to queue long UART message (%u bytes)", (unsigned)len);
+        uart_inflight_cancel(buf, filtered_len);
+        taskENTER_CRITICAL(&s_tx_arena_lock);
+        uart_tx_arena_free(&s_tx_arena, tx_item.arena_first, tx_item.arena_blocks);
+        taskEXIT_CRITICAL(&s_tx_arena_lock);
+        return ESP_FAIL;
+    }
+
+    s_tx_long_messages++;
+    s_tx_long_bytes += tx_item.len;
+    return ESP_OK;
+}
+
+static void uart_log_tx_long_stats(void) {
+    taskENTER_CRITICAL(&s_tx_arena_lock);
+    uint8_t used = s_tx_arena.used_blocks;
+    uint8_t peak = s_tx_arena.peak_blocks;
+    uint8_t total = s_tx_arena.block_count;
+    taskEXIT_CRITICAL(&s_tx_arena_lock);
+
+    ESP_LOGI(TAG, "TX long messages: %lu sent (%lu bytes), %lu dropped, arena %u/%u blocks (peak %u)",
+             (unsigned long)s_tx_long_messages, (unsigned long)s_tx_long_bytes,
+             (unsigned long)s_tx_long_dropped, used, total, peak);
+}
+
 esp_err_t uart_write_message(const char *message) {
     if (uart_tx_queue == NULL) {
         ESP_LOGE(TAG, "UART TX queue not initialized");
@@ -180,25 +815,35 @@ esp_err_t uart_write_message(const char *message) {
     // vTaskDelay(pdMS_TO_TICKS(10)); 
     size_t original_len = strlen(message);
 
-    // Check if the message + \r\n + \0 will fit in the buffer
+    // Check if the message + \r\n + \0 will fit in a queue slot; longer ones go through the arena
     if (original_len + 2 >= UART_TX_MESSAGE_BUFFER_SIZE) { // +2 for \r\n, buffer must also hold \0
-        ESP_LOGE(TAG, "UART message too long to fit in buffer: %s", message);
-        return ESP_ERR_INVALID_ARG;
+        if (original_len + 2 >= CONFIG_CAT_TX_LONG_MAX_LEN) {
+            ESP_LOGE(TAG, "UART message too long (%u bytes, max %d): %.32s...",
+                     (unsigned)original_len, CONFIG_CAT_TX_LONG_MAX_LEN - 3, message);
+            return ESP_ERR_INVALID_ARG;
+        }
+        return uart_write_long_message(message, original_len);
     }
 
     uart_tx_item_t tx_item;
+    tx_item.arena_first = -1;
+    tx_item.arena_blocks = 0;
     
-    // Copy the original message
-    strcpy(tx_item.data, message);
+    // Copy the message, dropping queries that are still awaiting an answer
+    size_t filtered_len = uart_inflight_filter(message, original_len, tx_item.data);
+    if (filtered_len == 0) {
+        return ESP_OK; // Everything requested is already on its way
+    }
     // Append \r\n
-    tx_item.data[original_len] = '\r';
-    tx_item.data[original_len+1] = '\n';
-    tx_item.data[original_len+2] = '\0'; // Null terminate for safety, though len is used for sending
+    tx_item.data[filtered_len] = '\r';
+    tx_item.data[filtered_len+1] = '\n';
+    tx_item.data[filtered_len+2] = '\0'; // Null terminate for safety, though len is used for sending
 
-    tx_item.len = original_len + 2; // The actual length of the string to send
+    tx_item.len = filtered_len + 2; // The actual length of the string to send
 
     if (xQueueSend(uart_tx_queue, &tx_item, pdMS_TO_TICKS(100)) != pdPASS) {
         ESP_LOGE(TAG, "Failed to queue UART message: %s", message);
+        uart_inflight_cancel(tx_item.data, filtered_len);
         // No free(data) needed here as it's stack-allocated within tx_item
         return ESP_FAIL;
     }
@@ -214,6 +859,12 @@ esp_err_t uart_write_raw(const char *data, size_t len) {
     return (written >= 0) ? ESP_OK : ESP_FAIL;
 }
 
+void uart_get_traffic_counters(uint32_t *tx_messages, uint32_t *tx_bytes, uint32_t *rx_bytes) {
+    if (tx_messages) *tx_messages = s_tx_total_messages;
+    if (tx_bytes) *tx_bytes = s_tx_total_bytes;
+    if (rx_bytes) *rx_bytes = s_rx_total_bytes;
+}
+
 void uart_write_message_handler(void *arg, void *data) {
     const char *message = (const char *)data;
     esp_err_t ret = uart_write_message(message);
@@ -224,18 +875,89 @@ void uart_write_message_handler(void *arg, void *data) {
 #define READ_BUFFER_SIZE 256
 #define COMMAND_BUFFER_SIZE 64
 #define CAT_CMD_TIMEOUT_MS 50   // Optimized from 100ms to 50ms for better responsiveness
+#define UART_RX_ARENA_SIZE 1024 // Long answers in flight: a macro reload keeps 4 MXR reads outstanding
+
+typedef struct {
+    char data[COMMAND_BUFFER_SIZE];
+    int16_t arena_first;  // First RX arena block of a long frame, -1 when data is inline
+    uint8_t arena_blocks; // Blocks to release once the long frame has been parsed
+} cat_rx_item_t;
 
 // Create a command processing queue to offload parsing from the UART task
 static QueueHandle_t cat_cmd_queue = NULL;
 static TaskHandle_t cat_parser_task_handle = NULL; // Handle for CAT parser task
 static TaskHandle_t read_uart_task_current_handle = NULL; // Handle for the current read_uart task instance
 
+// Frames longer than a queue slot (MXR answers for long macros) wait for the
+// parser in their own arena, the same way long commands wait for the TX task
+static_assert(UART_TX_ARENA_BLOCKS(CAT_FRAME_MAX_LEN) <= UART_RX_ARENA_SIZE / UART_TX_ARENA_BLOCK_SIZE,
+              "The RX arena must hold one frame of CAT_FRAME_MAX_LEN");
+
+static uint8_t s_rx_arena_mem[UART_RX_ARENA_SIZE];
+static uart_tx_arena_t s_rx_arena;
+static portMUX_TYPE s_rx_arena_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t s_rx_long_frames = 0;
+static uint32_t s_rx_long_dropped = 0;
+static uint32_t s_rx_overlong_frames = 0;
+
+static void cat_rx_item_release(cat_rx_item_t *item) {
+    if (item->arena_first >= 0) {
+        taskENTER_CRITICAL(&s_rx_arena_lock);
+        uart_tx_arena_free(&s_rx_arena, item->arena_first, item->arena_blocks);
+        taskEXIT_CRITICAL(&s_rx_arena_lock);
+        item->arena_first = -1;
+    }
+}
+
+// Builds a queue item for a received frame; false if a long frame found no arena space
+static bool cat_rx_item_fill(cat_rx_item_t *item, const char *frame, size_t len) {
+    if (len < COMMAND_BUFFER_SIZE) {
+        memcpy(item->data, frame, len + 1);
+        item->arena_first = -1;
+        item->arena_blocks = 0;
+        return true;
+    }
+    taskENTER_CRITICAL(&s_rx_arena_lock);
+    int first = uart_tx_arena_alloc(&s_rx_arena, len + 1);
+    taskEXIT_CRITICAL(&s_rx_arena_lock);
+    if (first < 0) {
+        s_rx_long_dropped++;
+        return false;
+    }
+    item->data[0] = '\0';
+    item->arena_first = (int16_t)first;
+    item->arena_blocks = uart_tx_arena_blocks_for(len + 1);
+    memcpy(uart_tx_arena_ptr(&s_rx_arena, first), frame, len + 1);
+    s_rx_long_frames++;
+    return true;
+}
+
+static void cat_rx_item_process(cat_rx_item_t *item) {
+    const char *frame = item->arena_first >= 0 ? uart_tx_arena_ptr(&s_rx_arena, item->arena_first) : item->data;
+    uart_inflight_complete(frame);
+    cat_txn_complete(frame);
+    parse_cat_command(frame);
+    cat_rx_item_release(item);
+}
+
+static void uart_log_rx_long_stats(void) {
+    taskENTER_CRITICAL(&s_rx_arena_lock);
+    uint8_t used = s_rx_arena.used_blocks;
+    uint8_t peak = s_rx_arena.peak_blocks;
+    uint8_t total = s_rx_arena.block_count;
+    taskEXIT_CRITICAL(&s_rx_arena_lock);
+
+    ESP_LOGI(TAG, "RX long frames: %lu received, %lu dropped (arena full), %lu over %d bytes, arena %u/%u blocks (peak %u)",
+             (unsigned long)s_rx_long_frames, (unsigned long)s_rx_long_dropped,
+             (unsigned long)s_rx_overlong_frames, CAT_FRAME_MAX_LEN - 1, used, total, peak);
+}
+
 // Task to process CAT commands asynchronously
 void cat_parser_task(void *pvParameters) {
     // Add this task to watchdog
     ESP_ERROR_CHECK(esp_task_wdt_add(NULL));
     
-    char cmd_buffer[COMMAND_BUFFER_SIZE];
+    cat_rx_item_t rx_item;
     
     while (1) {
         // Feed watchdog before blocking operations
@@ -245,18 +967,20 @@ void cat_parser_task(void *pvParameters) {
         
         // Stack monitoring removed for performance
         // OPTIMIZED: Reduced timeout and batch processing for better responsiveness
-        if (xQueueReceive(cat_cmd_queue, cmd_buffer, pdMS_TO_TICKS(25))) {  // Further reduced to 25ms for batch processing
+        if (xQueueReceive(cat_cmd_queue, &rx_item, pdMS_TO_TICKS(25))) {  // Further reduced to 25ms for batch processing
             // Process the command with minimal overhead
-            parse_cat_command(cmd_buffer);
+            cat_rx_item_process(&rx_item);
             
             // OPTIMIZATION: Process up to 5 additional commands in batch if available
             // This reduces context switching during high-frequency CAT operations
             int batch_count = 0;
-            while (batch_count < 5 && xQueueReceive(cat_cmd_queue, cmd_buffer, 0) == pdTRUE) {
-                parse_cat_command(cmd_buffer);
+            while (batch_count < 5 && xQueueReceive(cat_cmd_queue, &rx_item, 0) == pdTRUE) {
+                cat_rx_item_process(&rx_item);
                 batch_count++;
             }
         }
+        // Transaction timeouts and batch follow-ups run here rather than in a timer
+        cat_txn_sweep();
         // If no command received within 100ms, loop continues and feeds watchdog
     }
 }
@@ -287,7 +1011,10 @@ void read_uart(void *pvParameters) {
     if (cat_cmd_queue == NULL) {
         // Increased queue size from 10 to 50 to handle high-frequency CAT command bursts
         // This prevents dropping commands during rapid frequency updates and S-meter readings
-        cat_cmd_queue = xQueueCreate(50, COMMAND_BUFFER_SIZE);
+        cat_cmd_queue = xQueueCreate(50, sizeof(cat_rx_item_t));
+        taskENTER_CRITICAL(&s_rx_arena_lock);
+        uart_tx_arena_init(&s_rx_arena, s_rx_arena_mem, sizeof(s_rx_arena_mem));
+        taskEXIT_CRITICAL(&s_rx_arena_lock);
         if (cat_cmd_queue == NULL) {
             ESP_LOGE(TAG, "Failed to create CAT command queue - Free heap: %lu bytes", esp_get_free_heap_size());
             esp_task_wdt_delete(NULL); // Remove from watchdog before exiting
@@ -341,8 +1068,17 @@ void read_uart(void *pvParameters) {
 
     int retry_count = 0;
     const int max_retries = 5;
-    char cmd_buffer[COMMAND_BUFFER_SIZE] = {0};
-    int cmd_index = 0;
+    // Sized for the longest frame, so long MXR answers are not split
+    char cmd_buffer[CAT_FRAME_MAX_LEN];
+    cat_rx_framer_t framer;
+    cat_rx_framer_init(&framer, cmd_buffer, sizeof(cmd_buffer));
+    cat_rx_item_t rx_item;
+
+    // Link speed accounting and garbled frame burst detection for baud fallback
+    uint32_t garbled_frames = 0;
+    uint32_t garbled_window_start_ms = esp_timer_get_time() / 1000;
+    uint32_t last_baud_account_bytes = 0;
+    TickType_t last_baud_account_tick = xTaskGetTickCount();
 
     while (1) {
         // Feed watchdog at start of read loop and track feeds
@@ -369,6 +1105,15 @@ void read_uart(void *pvParameters) {
                      (unsigned long long)((uptime_ms / 1000ULL) % 60ULL),
                      (unsigned long long)(task_uptime_ms / 60000ULL),
                      (unsigned long long)((task_uptime_ms / 1000ULL) % 60ULL));
+            uart_baud_account(total_bytes_processed - last_baud_account_bytes,
+                              static_cast<uint32_t>((now_tick - last_baud_account_tick) * portTICK_PERIOD_MS));
+            last_baud_account_bytes = total_bytes_processed;
+            last_baud_account_tick = now_tick;
+            uart_log_baud_stats();
+            uart_log_tx_dedup_stats();
+            uart_log_tx_long_stats();
+            uart_log_rx_long_stats();
+            cat_txn_log_stats();
             last_health_report_tick = now_tick;
             last_watchdog_feed_count = watchdog_feed_count;
             last_bytes_processed = total_bytes_processed;
@@ -435,6 +1180,7 @@ void read_uart(void *pvParameters) {
             consecutive_errors = 0; // Reset consecutive error count
             last_successful_read = esp_timer_get_time() / 1000; // Update last successful read time
             total_bytes_processed += len; // Track total data processed
+            s_rx_total_bytes = total_bytes_processed;
             data[len] = '\0'; // Ensure null termination
             
             if (DEBUG) {
@@ -449,40 +1195,71 @@ void read_uart(void *pvParameters) {
             
             // OPTIMIZED: Batch process characters with minimal overhead
             for (int i = 0; i < len; i++) {
-                char c = data[i];
-                
-                // Fast path for normal characters - just add to buffer
-                if (c != ';' && c != '\r' && c != '\n' && cmd_index < COMMAND_BUFFER_SIZE - 1) {
-                    cmd_buffer[cmd_index++] = c;
-                    continue;  // Skip the expensive terminator handling
+                size_t cmd_len = 0;
+                cat_rx_result_t framed = cat_rx_framer_push(&framer, (char)data[i], &cmd_len);
+                if (framed == CAT_RX_NONE) {
+                    continue;  // Fast path: byte stored, no terminator yet
+                }
+                if (framed == CAT_RX_OVERFLOW) {
+                    // Longer than any CAT answer: one bad frame, dropped whole
+                    s_rx_overlong_frames++;
+                    garbled_frames++;
+                    continue;
+                }
+
+                if (!uart_frame_looks_valid(cmd_buffer, (int)cmd_len)) {
+                    garbled_frames++;
+                } else {
+                    s_reopens_without_frame = 0;
+                }
+
+                if (!cat_rx_item_fill(&rx_item, cmd_buffer, cmd_len)) {
+                    continue;  // Long frame with the RX arena full, counted in the stats
                 }
                 
-                // Terminator found or buffer full - process command
-                if (cmd_index > 0) {
-                    cmd_buffer[cmd_index] = '\0';
-                    
-                    // OPTIMIZED: Simplified queue logic with fast path for common case
-                    if (xQueueSend(cat_cmd_queue, cmd_buffer, 0) != pdPASS) {
-                        // OPTIMIZED: Fast queue overflow handling - simple drop strategy
-                        // Check only first 2 chars for priority (much faster than full strncmp)
-                        if (cmd_buffer[0] == 'I' && cmd_buffer[1] == 'F') {
-                            // IF commands are critical - try once to make room
-                            char dropped_cmd[COMMAND_BUFFER_SIZE];
-                            if (xQueueReceive(cat_cmd_queue, dropped_cmd, 0) == pdPASS) {
-                                xQueueSend(cat_cmd_queue, cmd_buffer, 0);  // Try to queue IF command
-                            }
-                            // Don't log - too expensive during high-frequency operations
-                        }
-                        // For all other commands when queue full: just drop silently for performance
-                        // This prevents expensive priority checking and multiple queue operations
+                // OPTIMIZED: Simplified queue logic with fast path for common case
+                if (xQueueSend(cat_cmd_queue, &rx_item, 0) != pdPASS) {
+                    // OPTIMIZED: Fast queue overflow handling - simple drop strategy
+                    // Check only first 2 chars for priority (much faster than full strncmp)
+                    bool queued = false;
+                    if (cmd_buffer[0] == 'I' && cmd_buffer[1] == 'F') {
+                        // IF commands are critical - try once to make room
+                        cat_rx_item_t dropped_item;
+                        if (xQueueReceive(cat_cmd_queue, &dropped_item, 0) == pdPASS) {
+                            cat_rx_item_release(&dropped_item);
+                            queued = xQueueSend(cat_cmd_queue, &rx_item, 0) == pdPASS;  // Try to queue IF command
                         }
-                        
-                    // OPTIMIZED: Fast buffer reset - only reset index, no expensive memset
-                    cmd_index = 0;
-                    // memset removed - cmd_buffer[cmd_index] = '\0' above handles termination
+                        // Don't log - too expensive during high-frequency operations
+                    }
+                    // For all other commands when queue full: just drop silently for performance
+                    // This prevents expensive priority checking and multiple queue operations
+                    if (!queued) {
+                        cat_rx_item_release(&rx_item);
+                    }
                 }
-                // Character addition is now handled in the fast path above
             }
+
+            const uint32_t now_ms = esp_timer_get_time() / 1000;
+            if ((now_ms - garbled_window_start_ms) >= UART_BAUD_ERROR_WINDOW_MS) {
+                garbled_frames = 0;
+                garbled_window_start_ms = now_ms;
+            }
+#if CONFIG_CAT_BAUD_NEGOTIATE
+            if (garbled_frames >= CONFIG_CAT_BAUD_FALLBACK_ERRORS) {
+                const TickType_t fallback_tick = xTaskGetTickCount();
+                uart_baud_account(total_bytes_processed - last_baud_account_bytes,
+                                  static_cast<uint32_t>((fallback_tick - last_baud_account_tick) * portTICK_PERIOD_MS));
+                last_baud_account_bytes = total_bytes_processed;
+                last_baud_account_tick = fallback_tick;
+
+                feed_watchdog();
+                uart_baud_fallback();
+                feed_watchdog();
+                garbled_frames = 0;
+                garbled_window_start_ms = esp_timer_get_time() / 1000;
+                cat_rx_framer_reset(&framer); // Partial frame was received at the old rate
+            }
+#endif
         } else if (len == 0) {
             // No data, just yield to other tasks
             taskYIELD();
@@ -591,6 +1368,10 @@ int uart_get_port(void) {
     return s_uart_port;
 }
 
+uint32_t uart_get_baud_rate(void) {
+    return s_link_baud;
+}
+
 bool uart_is_ready(void) {
     return uart_tx_queue != NULL;
 }
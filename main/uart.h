@@ -2,9 +2,18 @@
 #define UART_H 
 
 #include "esp_err.h"
+#include "sdkconfig.h"
 #include <stdint.h>
 #include <stddef.h>
 
+#ifndef CONFIG_CAT_TX_LONG_MAX_LEN
+#define CONFIG_CAT_TX_LONG_MAX_LEN 256
+#endif
+
+// Longest CAT frame in either direction, terminator included: an MXW macro
+// write and the MXR answer that reads it back are the same length
+#define CAT_FRAME_MAX_LEN CONFIG_CAT_TX_LONG_MAX_LEN
+
 esp_err_t init_uart(void);
 void read_uart(void *pvParameters);
 void cat_parser_task(void *pvParameters);
@@ -18,6 +27,15 @@ esp_err_t uart_write_raw(const char *data, size_t len);
 // Expose selected UART port for diagnostics/tests
 int uart_get_port(void);
 
+// Current CAT link speed (negotiated rate, or CONFIG_CAT_UART_BAUD)
+uint32_t uart_get_baud_rate(void);
+
+// Running totals of queued messages written and bytes sent/received on the CAT link
+void uart_get_traffic_counters(uint32_t *tx_messages, uint32_t *tx_bytes, uint32_t *rx_bytes);
+
 // Check if UART TX queue is initialized and ready for messages
 bool uart_is_ready(void);
+
+// Log per-query sent/suppressed counters from the in-flight deduplication table
+void uart_log_tx_dedup_stats(void);
 #endif // UART_H
@@ -0,0 +1,86 @@
+#ifndef UART_TX_ARENA_H
+#define UART_TX_ARENA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fixed-size block arena for CAT commands that do not fit in a TX queue slot.
+// Long messages (e.g. MXW macro writes) occupy a contiguous run of blocks; the
+// queue item only carries the run's first block and length, so queue slots stay
+// small for the common short polling commands.
+//
+// No locking is done here - callers serialise access (uart.cpp uses a spinlock).
+
+#define UART_TX_ARENA_BLOCK_SIZE 64
+#define UART_TX_ARENA_MAX_BLOCKS 32 // Bounded by the 32-bit occupancy map
+
+// Blocks a run of len bytes occupies, usable in constant expressions
+#define UART_TX_ARENA_BLOCKS(len) (((len) + UART_TX_ARENA_BLOCK_SIZE - 1) / UART_TX_ARENA_BLOCK_SIZE)
+
+typedef struct {
+    uint8_t *mem;          // block_count * UART_TX_ARENA_BLOCK_SIZE bytes
+    uint8_t block_count;
+    uint32_t used_map;     // Bit n set when block n is allocated
+    uint8_t used_blocks;
+    uint8_t peak_blocks;
+    uint32_t alloc_count;
+} uart_tx_arena_t;
+
+static inline void uart_tx_arena_init(uart_tx_arena_t *arena, uint8_t *mem, size_t mem_size) {
+    size_t blocks = mem_size / UART_TX_ARENA_BLOCK_SIZE;
+    memset(arena, 0, sizeof(*arena));
+    arena->mem = mem;
+    arena->block_count = (uint8_t)(blocks > UART_TX_ARENA_MAX_BLOCKS ? UART_TX_ARENA_MAX_BLOCKS : blocks);
+}
+
+static inline uint8_t uart_tx_arena_blocks_for(size_t len) {
+    return (uint8_t)((len + UART_TX_ARENA_BLOCK_SIZE - 1) / UART_TX_ARENA_BLOCK_SIZE);
+}
+
+// Reserves a contiguous run able to hold len bytes.
+// Returns the first block index, or -1 if no run is free.
+static inline int uart_tx_arena_alloc(uart_tx_arena_t *arena, size_t len) {
+    uint8_t need = uart_tx_arena_blocks_for(len);
+    if (need == 0 || need > arena->block_count) {
+        return -1;
+    }
+    uint32_t run_mask = (need >= 32) ? 0xFFFFFFFFu : ((1u << need) - 1u);
+    for (uint8_t first = 0; first + need <= arena->block_count; first++) {
+        uint32_t mask = run_mask << first;
+        if ((arena->used_map & mask) == 0) {
+            arena->used_map |= mask;
+            arena->used_blocks += need;
+            if (arena->used_blocks > arena->peak_blocks) {
+                arena->peak_blocks = arena->used_blocks;
+            }
+            arena->alloc_count++;
+            return first;
+        }
+    }
+    return -1;
+}
+
+static inline void uart_tx_arena_free(uart_tx_arena_t *arena, int first, uint8_t blocks) {
+    if (first < 0 || blocks == 0) {
+        return;
+    }
+    uint32_t run_mask = (blocks >= 32) ? 0xFFFFFFFFu : ((1u << blocks) - 1u);
+    arena->used_map &= ~(run_mask << first);
+    arena->used_blocks -= blocks;
+}
+
+static inline char *uart_tx_arena_ptr(uart_tx_arena_t *arena, int first) {
+    return (char *)(arena->mem + (size_t)first * UART_TX_ARENA_BLOCK_SIZE);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UART_TX_ARENA_H
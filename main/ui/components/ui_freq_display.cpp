@@ -0,0 +1,236 @@
+/**
+ * @file ui_freq_display.cpp
+ * @brief Large frequency readout blitted from a pre-rasterized digit atlas
+ */
+
+#include "ui_freq_display.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+
+static const char *TAG = "UI_FREQ_DISPLAY";
+
+// Atlas rows: digits 0-9, then the separator
+#define FREQ_GLYPH_COUNT 11
+#define FREQ_GLYPH_DOT   10
+#define FREQ_CELL_BLANK  -1
+
+static const char *const s_glyph_text[FREQ_GLYPH_COUNT] = {
+    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "."
+};
+
+typedef struct {
+    lv_draw_buf_t *atlas;                           // A8, one cell per row band
+    lv_image_dsc_t glyphs[FREQ_GLYPH_COUNT];        // Views into atlas
+    int32_t cell_x[UI_FREQ_DISPLAY_CELLS];          // Cell offsets inside the object
+    int32_t cell_w[UI_FREQ_DISPLAY_CELLS];
+    int32_t cell_h;
+    int8_t cells[UI_FREQ_DISPLAY_CELLS];            // Glyph per cell, FREQ_CELL_BLANK if empty
+    uint32_t freq;
+} freq_display_t;
+
+static freq_display_t *freq_display_get(lv_obj_t *display) {
+    if (display == NULL) return NULL;
+    return (freq_display_t *)lv_obj_get_user_data(display);
+}
+
+// Cell index layout: 0-2 MHz, 3 dot, 4-6 kHz, 7 dot, 8-10 Hz
+static bool freq_cell_is_dot(int cell) {
+    return cell == 3 || cell == 7;
+}
+
+// Render every glyph once into an ARGB8888 scratch cell with a canvas and keep
+// only its coverage in the A8 atlas; color is applied at blit time
+static bool freq_atlas_build(lv_obj_t *display, freq_display_t *d, const lv_font_t *font,
+                             int32_t digit_w, int32_t dot_w) {
+    d->atlas = lv_draw_buf_create(digit_w, d->cell_h * FREQ_GLYPH_COUNT, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if (d->atlas == NULL) return false;
+    lv_draw_buf_clear(d->atlas, NULL);
+
+    lv_draw_buf_t *scratch = lv_draw_buf_create(digit_w, d->cell_h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    if (scratch == NULL) {
+        lv_draw_buf_destroy(d->atlas);
+        d->atlas = NULL;
+        return false;
+    }
+
+    lv_obj_t *canvas = lv_canvas_create(display);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_draw_buf(canvas, scratch);
+
+    uint32_t atlas_stride = d->atlas->header.stride;
+    for (int g = 0; g < FREQ_GLYPH_COUNT; g++) {
+        int32_t w = (g == FREQ_GLYPH_DOT) ? dot_w : digit_w;
+        lv_draw_buf_clear(scratch, NULL);
+
+        lv_layer_t layer;
+        lv_canvas_init_layer(canvas, &layer);
+        lv_draw_label_dsc_t label_dsc;
+        lv_draw_label_dsc_init(&label_dsc);
+        label_dsc.font = font;
+        label_dsc.color = lv_color_white();
+        label_dsc.align = LV_TEXT_ALIGN_CENTER;
+        label_dsc.text = s_glyph_text[g];
+        lv_area_t area = {0, 0, w - 1, d->cell_h - 1};
+        lv_draw_label(&layer, &label_dsc, &area);
+        lv_canvas_finish_layer(canvas, &layer);
+
+        uint8_t *dst_row = d->atlas->data + (uint32_t)g * d->cell_h * atlas_stride;
+        for (int32_t y = 0; y < d->cell_h; y++) {
+            const uint8_t *src = (const uint8_t *)lv_draw_buf_goto_xy(scratch, 0, y);
+            for (int32_t x = 0; x < w; x++) {
+                dst_row[x] = src[x * 4 + 3]; // Alpha of ARGB8888 (B, G, R, A)
+            }
+            dst_row += atlas_stride;
+        }
+
+        lv_image_dsc_t *img = &d->glyphs[g];
+        memset(img, 0, sizeof(*img));
+        img->header.magic = LV_IMAGE_HEADER_MAGIC;
+        img->header.cf = LV_COLOR_FORMAT_A8;
+        img->header.w = w;
+        img->header.h = d->cell_h;
+        img->header.stride = atlas_stride;
+        img->data = d->atlas->data + (uint32_t)g * d->cell_h * atlas_stride;
+        img->data_size = d->cell_h * atlas_stride;
+    }
+
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(scratch);
+    return true;
+}
+
+static void freq_display_cell_area(lv_obj_t *display, const freq_display_t *d, int cell, lv_area_t *area) {
+    lv_obj_get_coords(display, area);
+    area->x1 += d->cell_x[cell];
+    area->x2 = area->x1 + d->cell_w[cell] - 1;
+    area->y2 = area->y1 + d->cell_h - 1;
+}
+
+static void freq_display_draw_cb(lv_event_t *e) {
+    lv_obj_t *display = (lv_obj_t *)lv_event_get_target(e);
+    freq_display_t *d = freq_display_get(display);
+    if (d == NULL || d->atlas == NULL) return;
+
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.recolor = lv_obj_get_style_text_color(display, LV_PART_MAIN);
+    img_dsc.recolor_opa = LV_OPA_COVER;
+    img_dsc.opa = lv_obj_get_style_text_opa(display, LV_PART_MAIN);
+
+    for (int cell = 0; cell < UI_FREQ_DISPLAY_CELLS; cell++) {
+        if (d->cells[cell] == FREQ_CELL_BLANK) continue;
+        lv_area_t area;
+        freq_display_cell_area(display, d, cell, &area);
+        img_dsc.src = &d->glyphs[d->cells[cell]];
+        lv_draw_image(layer, &img_dsc, &area);
+    }
+}
+
+static void freq_display_delete_cb(lv_event_t *e) {
+    lv_obj_t *display = (lv_obj_t *)lv_event_get_target(e);
+    freq_display_t *d = freq_display_get(display);
+    if (d != NULL) {
+        lv_obj_set_user_data(display, NULL);
+        if (d->atlas != NULL) {
+            // Drop cached decoder entries that point into the atlas
+            for (int g = 0; g < FREQ_GLYPH_COUNT; g++) {
+                lv_image_cache_drop(&d->glyphs[g]);
+            }
+            lv_draw_buf_destroy(d->atlas);
+        }
+        lv_free(d);
+    }
+}
+
+lv_obj_t *ui_freq_display_create(lv_obj_t *parent, const lv_font_t *font) {
+    if (font == NULL) return NULL;
+
+    freq_display_t *d = (freq_display_t *)lv_malloc(sizeof(freq_display_t));
+    if (d == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate display state");
+        return NULL;
+    }
+    memset(d, 0, sizeof(*d));
+
+    // Fixed-width digit cells so a changing digit never moves its neighbours
+    int32_t digit_w = 0;
+    for (uint32_t c = '0'; c <= '9'; c++) {
+        int32_t w = lv_font_get_glyph_width(font, c, 0);
+        if (w > digit_w) digit_w = w;
+    }
+    int32_t dot_w = lv_font_get_glyph_width(font, '.', 0);
+    d->cell_h = lv_font_get_line_height(font);
+
+    int32_t x = 0;
+    for (int cell = 0; cell < UI_FREQ_DISPLAY_CELLS; cell++) {
+        d->cell_x[cell] = x;
+        d->cell_w[cell] = freq_cell_is_dot(cell) ? dot_w : digit_w;
+        d->cells[cell] = freq_cell_is_dot(cell) ? FREQ_GLYPH_DOT : FREQ_CELL_BLANK;
+        x += d->cell_w[cell];
+    }
+
+    lv_obj_t *display = lv_obj_create(parent);
+    lv_obj_remove_style_all(display);
+    lv_obj_remove_flag(display, (lv_obj_flag_t)(LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE));
+    lv_obj_set_size(display, x, d->cell_h);
+
+    int64_t start_us = esp_timer_get_time();
+    if (!freq_atlas_build(display, d, font, digit_w, dot_w)) {
+        ESP_LOGE(TAG, "Failed to allocate %ldx%ld digit atlas", digit_w, d->cell_h * FREQ_GLYPH_COUNT);
+        lv_obj_delete(display);
+        lv_free(d);
+        return NULL;
+    }
+    ESP_LOGI(TAG, "Digit atlas %ldx%ld (%lu bytes) built in %lld us", digit_w,
+             d->cell_h * FREQ_GLYPH_COUNT, d->atlas->data_size, esp_timer_get_time() - start_us);
+
+    lv_obj_set_user_data(display, d);
+    lv_obj_add_event_cb(display, freq_display_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(display, freq_display_delete_cb, LV_EVENT_DELETE, NULL);
+    return display;
+}
+
+bool ui_freq_display_set_freq(lv_obj_t *display, uint32_t freq_hz) {
+    freq_display_t *d = freq_display_get(display);
+    if (d == NULL || freq_hz > 999999999) return false;
+
+    uint32_t mhz = freq_hz / 1000000;
+    uint32_t khz = (freq_hz / 1000) % 1000;
+    uint32_t hz = freq_hz % 1000;
+    int8_t next[UI_FREQ_DISPLAY_CELLS];
+    next[0] = (mhz >= 100) ? (int8_t)(mhz / 100) : FREQ_CELL_BLANK;
+    next[1] = (mhz >= 10) ? (int8_t)((mhz / 10) % 10) : FREQ_CELL_BLANK;
+    next[2] = (int8_t)(mhz % 10);
+    next[3] = FREQ_GLYPH_DOT;
+    next[4] = (int8_t)(khz / 100);
+    next[5] = (int8_t)((khz / 10) % 10);
+    next[6] = (int8_t)(khz % 10);
+    next[7] = FREQ_GLYPH_DOT;
+    next[8] = (int8_t)(hz / 100);
+    next[9] = (int8_t)((hz / 10) % 10);
+    next[10] = (int8_t)(hz % 10);
+
+    bool changed = false;
+    for (int cell = 0; cell < UI_FREQ_DISPLAY_CELLS; cell++) {
+        if (next[cell] == d->cells[cell]) continue;
+        d->cells[cell] = next[cell];
+        lv_area_t area;
+        freq_display_cell_area(display, d, cell, &area);
+        lv_obj_invalidate_area(display, &area);
+        changed = true;
+    }
+    d->freq = freq_hz;
+    return changed;
+}
+
+uint32_t ui_freq_display_get_freq(lv_obj_t *display) {
+    freq_display_t *d = freq_display_get(display);
+    return d ? d->freq : 0;
+}
+
+uint32_t ui_freq_display_atlas_size(lv_obj_t *display) {
+    freq_display_t *d = freq_display_get(display);
+    return (d && d->atlas) ? d->atlas->data_size : 0;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file ui_freq_display.h
+ * @brief Large frequency readout blitted from a pre-rasterized digit atlas
+ *
+ * The ten digits and the separator are rendered once with the given font into
+ * an A8 atlas. Each frame draws the digit cells as images recolored with the
+ * object's text color, and a frequency change invalidates only the cells whose
+ * digit changed, so a 10 Hz tune step redraws one or two cells instead of three
+ * labels re-shaping text from the font.
+ *
+ * Layout matches the former MHz/kHz/Hz labels: "MMM.kkk.hhh" with leading MHz
+ * zeros blank.
+ */
+
+#ifndef UI_FREQ_DISPLAY_H
+#define UI_FREQ_DISPLAY_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_FREQ_DISPLAY_CELLS 11    ///< 9 digits + 2 separators
+
+/**
+ * @brief Create a frequency display and build its digit atlas
+ * @param parent Parent object (text color is inherited from it)
+ * @param font Font to rasterize the digits and separator from
+ * @return The display object, or NULL if the atlas could not be allocated
+ */
+lv_obj_t *ui_freq_display_create(lv_obj_t *parent, const lv_font_t *font);
+
+/**
+ * @brief Show a frequency
+ * @param display Display object
+ * @param freq_hz Frequency in Hz (0 .. 999999999)
+ * @return true if any digit changed and was invalidated
+ */
+bool ui_freq_display_set_freq(lv_obj_t *display, uint32_t freq_hz);
+
+/**
+ * @brief Get the displayed frequency
+ * @param display Display object
+ * @return Frequency in Hz, 0 if nothing has been set
+ */
+uint32_t ui_freq_display_get_freq(lv_obj_t *display);
+
+/**
+ * @brief Get the atlas size in bytes (for memory reporting)
+ * @param display Display object
+ */
+uint32_t ui_freq_display_atlas_size(lv_obj_t *display);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_FREQ_DISPLAY_H
@@ -0,0 +1,139 @@
+/**
+ * @file ui_local_echo.cpp
+ * @brief Optimistic display of touch-initiated radio settings
+ */
+
+#include "ui_local_echo.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "LOCAL_ECHO";
+
+#define LOCAL_ECHO_MEASURE_SLOTS 4
+
+// wait_frame bits: the next refresh shows the local echo / the confirmed value
+#define WAIT_LOCAL_FRAME   0x01
+#define WAIT_CONFIRM_FRAME 0x02
+
+// Settings with a latency measurement in progress
+static ui_local_echo_t *s_measuring[LOCAL_ECHO_MEASURE_SLOTS];
+static bool s_display_hooked = false;
+
+static void measure_stop(ui_local_echo_t *echo) {
+    echo->wait_frame = 0;
+    for (int i = 0; i < LOCAL_ECHO_MEASURE_SLOTS; i++) {
+        if (s_measuring[i] == echo) s_measuring[i] = NULL;
+    }
+}
+
+static void display_refr_ready_cb(lv_event_t *e) {
+    LV_UNUSED(e);
+    int64_t now_us = esp_timer_get_time();
+    for (int i = 0; i < LOCAL_ECHO_MEASURE_SLOTS; i++) {
+        ui_local_echo_t *echo = s_measuring[i];
+        if (echo == NULL) continue;
+        uint32_t elapsed_us = (uint32_t)(now_us - echo->request_us);
+        if (echo->wait_frame & WAIT_LOCAL_FRAME) {
+            echo->local_us = elapsed_us;
+            echo->wait_frame &= ~WAIT_LOCAL_FRAME;
+        }
+        if (echo->wait_frame & WAIT_CONFIRM_FRAME) {
+            ESP_LOGI(TAG, "%s: on screen %lu.%lu ms after tap, radio-confirmed frame %lu.%lu ms after tap",
+                     echo->name, (unsigned long)(echo->local_us / 1000), (unsigned long)((echo->local_us % 1000) / 100),
+                     (unsigned long)(elapsed_us / 1000), (unsigned long)((elapsed_us % 1000) / 100));
+            measure_stop(echo);
+        }
+    }
+}
+
+static void measure_start(ui_local_echo_t *echo) {
+    if (!s_display_hooked) {
+        lv_display_t *disp = lv_display_get_default();
+        if (disp == NULL) return;
+        lv_display_add_event_cb(disp, display_refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+        s_display_hooked = true;
+    }
+    measure_stop(echo);
+    for (int i = 0; i < LOCAL_ECHO_MEASURE_SLOTS; i++) {
+        if (s_measuring[i] == NULL) {
+            s_measuring[i] = echo;
+            echo->wait_frame = WAIT_LOCAL_FRAME;
+            echo->local_us = 0;
+            return;
+        }
+    }
+}
+
+static void set_pending(ui_local_echo_t *echo, bool pending) {
+    echo->pending = pending;
+    if (echo->indicator != NULL && *echo->indicator != NULL) {
+        if (pending) {
+            lv_obj_add_state(*echo->indicator, LV_STATE_USER_1);
+        } else {
+            lv_obj_remove_state(*echo->indicator, LV_STATE_USER_1);
+        }
+    }
+    if (!pending && echo->timer != NULL) {
+        lv_timer_pause(echo->timer);
+    }
+}
+
+static void timeout_cb(lv_timer_t *timer) {
+    ui_local_echo_t *echo = (ui_local_echo_t *)lv_timer_get_user_data(timer);
+    if (!echo->pending) return;
+
+    measure_stop(echo);
+    set_pending(echo, false);
+    if (echo->confirmed_valid) {
+        ESP_LOGW(TAG, "%s: no confirmation of %ld within %lu ms, reverting to %ld", echo->name,
+                 (long)echo->requested, (unsigned long)echo->timeout_ms, (long)echo->confirmed);
+        echo->apply(echo->confirmed);
+    } else {
+        ESP_LOGW(TAG, "%s: no confirmation of %ld within %lu ms", echo->name, (long)echo->requested,
+                 (unsigned long)echo->timeout_ms);
+    }
+}
+
+void ui_local_echo_request(ui_local_echo_t *echo, int32_t value) {
+    if (echo == NULL) return;
+
+    echo->request_us = esp_timer_get_time();
+    echo->requested = value;
+    measure_start(echo);
+
+    if (echo->timer == NULL) {
+        echo->timer = lv_timer_create(timeout_cb, echo->timeout_ms, echo);
+    } else {
+        lv_timer_reset(echo->timer);
+        lv_timer_resume(echo->timer);
+    }
+    set_pending(echo, true);
+    echo->apply(value);
+}
+
+void ui_local_echo_report(ui_local_echo_t *echo, int32_t value) {
+    if (echo == NULL) return;
+
+    echo->confirmed = value;
+    echo->confirmed_valid = true;
+    if (echo->pending) {
+        if (value != echo->requested) {
+            // Sent before the radio processed the request
+            return;
+        }
+        set_pending(echo, false);
+        if (echo->wait_frame != 0) {
+            echo->wait_frame |= WAIT_CONFIRM_FRAME;
+        }
+    }
+    echo->apply(value);
+}
+
+void ui_local_echo_reapply(ui_local_echo_t *echo) {
+    if (echo == NULL || echo->pending || !echo->confirmed_valid) return;
+    echo->apply(echo->confirmed);
+}
+
+bool ui_local_echo_is_pending(const ui_local_echo_t *echo) {
+    return echo != NULL && echo->pending;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file ui_local_echo.h
+ * @brief Optimistic display of touch-initiated radio settings
+ *
+ * A touch control that sends a CAT command shows the requested value at once
+ * instead of waiting for the radio to echo it back. Values reported by the
+ * radio while the request is outstanding are treated as stale and ignored,
+ * except the requested value itself, which confirms it. If no confirmation
+ * arrives within the timeout the display reverts to the last value the radio
+ * reported.
+ *
+ * While a request is unconfirmed the indicator widget carries LV_STATE_USER_1
+ * (styled by UI_STYLE_PENDING). Each request logs two latencies: tap to the
+ * frame showing the local echo, and tap to the first frame after the radio
+ * confirmed it, which is when the value appeared before local echo.
+ *
+ * All functions must be called with the LVGL lock held (or from the LVGL task).
+ */
+
+#ifndef UI_LOCAL_ECHO_H
+#define UI_LOCAL_ECHO_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Show a value of the setting on screen
+ */
+typedef void (*ui_local_echo_apply_cb_t)(int32_t value);
+
+/**
+ * @brief One echoed setting; define statically with UI_LOCAL_ECHO_INIT
+ */
+typedef struct {
+    const char *name;                   ///< Name used in log messages
+    ui_local_echo_apply_cb_t apply;     ///< Display callback
+    lv_obj_t **indicator;               ///< Widget marked while unconfirmed, or NULL
+    uint32_t timeout_ms;                ///< Time to wait for the radio before reverting
+
+    // Internal state
+    int32_t requested;
+    int32_t confirmed;                  ///< Last value reported by the radio
+    bool pending;
+    bool confirmed_valid;
+    uint8_t wait_frame;
+    lv_timer_t *timer;
+    int64_t request_us;
+    uint32_t local_us;
+} ui_local_echo_t;
+
+#define UI_LOCAL_ECHO_INIT(name, apply, indicator, timeout_ms) \
+    { (name), (apply), (indicator), (timeout_ms), 0, 0, false, false, 0, NULL, 0, 0 }
+
+/**
+ * @brief Show a value the user just requested from the radio
+ *
+ * Call after sending the command. Applies the value immediately and starts
+ * the confirmation timeout; a new request replaces an outstanding one.
+ *
+ * @param echo  Setting
+ * @param value Requested value
+ */
+void ui_local_echo_request(ui_local_echo_t *echo, int32_t value);
+
+/**
+ * @brief Pass a value reported by the radio
+ *
+ * Call from the setting's observers in place of the display update. Applies
+ * the value unless a different value is still waiting for confirmation.
+ *
+ * @param echo  Setting
+ * @param value Value reported by the radio
+ */
+void ui_local_echo_report(ui_local_echo_t *echo, int32_t value);
+
+/**
+ * @brief Show the last value reported by the radio again
+ *
+ * For a display callback that skipped reports (for example while the user was
+ * still adjusting the value). Does nothing while a request is outstanding,
+ * since its confirmation or timeout applies the right value.
+ *
+ * @param echo Setting
+ */
+void ui_local_echo_reapply(ui_local_echo_t *echo);
+
+/**
+ * @brief Whether a requested value is still waiting for confirmation
+ */
+bool ui_local_echo_is_pending(const ui_local_echo_t *echo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_LOCAL_ECHO_H
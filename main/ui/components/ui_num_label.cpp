@@ -0,0 +1,91 @@
+/**
+ * @file ui_num_label.cpp
+ * @brief Allocation-free text updates for numeric readouts
+ */
+
+#include "ui_num_label.h"
+#include <string.h>
+
+// Bounded writer into a UI_NUM_LABEL_TEXT_LEN scratch buffer
+typedef struct {
+    char text[UI_NUM_LABEL_TEXT_LEN];
+    size_t len;
+} text_builder_t;
+
+static void put_char(text_builder_t *b, char c) {
+    if (b->len < UI_NUM_LABEL_TEXT_LEN - 1) {
+        b->text[b->len++] = c;
+    }
+}
+
+static void put_str(text_builder_t *b, const char *s) {
+    if (s == NULL) return;
+    while (*s) put_char(b, *s++);
+}
+
+// Unsigned magnitude, at least min_digits long; a decimal point is inserted
+// `decimals` digits from the right
+static void put_digits(text_builder_t *b, uint32_t magnitude, uint8_t min_digits, uint8_t decimals) {
+    char digits[12];
+    int n = 0;
+    do {
+        digits[n++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0 && n < (int)sizeof(digits));
+
+    int width = LV_MAX(min_digits, decimals + 1);
+    width = LV_MIN(width, (int)sizeof(digits));
+    while (n < width) digits[n++] = '0';
+
+    while (n > 0) {
+        if (decimals > 0 && n == decimals) put_char(b, '.');
+        put_char(b, digits[--n]);
+    }
+}
+
+static uint32_t magnitude_of(int32_t value) {
+    return value < 0 ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+}
+
+// Apply the built text if it differs from what the label shows
+static bool commit(lv_obj_t *label, ui_num_label_t *buf, text_builder_t *b) {
+    if (label == NULL || buf == NULL) return false;
+    b->text[b->len] = '\0';
+    // The label shows our buffer only if it was last set through it; after the
+    // label is recreated it points elsewhere and has to be set again
+    if (lv_label_get_text(label) == buf->text && strcmp(buf->text, b->text) == 0) {
+        return false;
+    }
+    memcpy(buf->text, b->text, b->len + 1);
+    lv_label_set_text_static(label, buf->text);
+    return true;
+}
+
+bool ui_num_label_set_str(lv_obj_t *label, ui_num_label_t *buf, const char *text) {
+    text_builder_t b = {};
+    put_str(&b, text);
+    return commit(label, buf, &b);
+}
+
+bool ui_num_label_set_int(lv_obj_t *label, ui_num_label_t *buf, const char *prefix, int32_t value,
+                          uint8_t min_digits, const char *suffix) {
+    text_builder_t b = {};
+    put_str(&b, prefix);
+    if (value < 0) put_char(&b, '-');
+    put_digits(&b, magnitude_of(value), min_digits, 0);
+    put_str(&b, suffix);
+    return commit(label, buf, &b);
+}
+
+bool ui_num_label_set_fixed(lv_obj_t *label, ui_num_label_t *buf, int32_t value, uint8_t decimals,
+                            bool plus_sign, const char *suffix) {
+    text_builder_t b = {};
+    if (value < 0) {
+        put_char(&b, '-');
+    } else if (plus_sign) {
+        put_char(&b, '+');
+    }
+    put_digits(&b, magnitude_of(value), 1, decimals);
+    put_str(&b, suffix);
+    return commit(label, buf, &b);
+}
@@ -0,0 +1,69 @@
+/**
+ * @file ui_num_label.h
+ * @brief Allocation-free text updates for numeric readouts
+ *
+ * lv_label_set_text() copies the string into the LVGL heap and invalidates the
+ * label on every call, even when the text is unchanged. A ui_num_label_t is a
+ * fixed text buffer owned by one label: values are formatted into it with
+ * integer arithmetic, the label shows it in static text mode, and an update
+ * that produces the same text returns without touching the label.
+ */
+
+#ifndef UI_NUM_LABEL_H
+#define UI_NUM_LABEL_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_NUM_LABEL_TEXT_LEN 16
+
+/**
+ * @brief Text buffer for one label
+ *
+ * Must outlive the label (use static storage) and must not be shared between
+ * labels. Zero-initialised is the empty state.
+ */
+typedef struct {
+    char text[UI_NUM_LABEL_TEXT_LEN];
+} ui_num_label_t;
+
+/**
+ * @brief Show a string, truncated to UI_NUM_LABEL_TEXT_LEN - 1 characters
+ * @return true if the label changed
+ */
+bool ui_num_label_set_str(lv_obj_t *label, ui_num_label_t *buf, const char *text);
+
+/**
+ * @brief Show prefix, value zero-padded to min_digits, suffix
+ *
+ * @param prefix     Text before the number, or NULL
+ * @param value      Value to show
+ * @param min_digits Minimum number of digits (0 or 1 for no padding)
+ * @param suffix     Text after the number, or NULL
+ * @return true if the label changed
+ */
+bool ui_num_label_set_int(lv_obj_t *label, ui_num_label_t *buf, const char *prefix, int32_t value,
+                          uint8_t min_digits, const char *suffix);
+
+/**
+ * @brief Show a fixed-point value, e.g. 125 with 2 decimals as "1.25"
+ *
+ * @param value      Value in units of 10^-decimals
+ * @param decimals   Digits after the decimal point (0 for an integer)
+ * @param plus_sign  Prefix non-negative values with '+' (like printf "%+")
+ * @param suffix     Text after the number, or NULL
+ * @return true if the label changed
+ */
+bool ui_num_label_set_fixed(lv_obj_t *label, ui_num_label_t *buf, int32_t value, uint8_t decimals,
+                            bool plus_sign, const char *suffix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_NUM_LABEL_H
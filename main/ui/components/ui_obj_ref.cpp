@@ -0,0 +1,24 @@
+/**
+ * @file ui_obj_ref.cpp
+ * @brief Widget references that clear themselves when the widget is deleted
+ */
+
+#include "ui_obj_ref.h"
+
+static void obj_ref_delete_cb(lv_event_t *e) {
+    lv_obj_t **ref = (lv_obj_t **)lv_event_get_user_data(e);
+    if (*ref == lv_event_get_target_obj(e)) {
+        *ref = NULL;
+    }
+}
+
+void ui_obj_ref_track(lv_obj_t **ref) {
+    if (ref == NULL || *ref == NULL) return;
+    lv_obj_add_event_cb(*ref, obj_ref_delete_cb, LV_EVENT_DELETE, ref);
+}
+
+void ui_obj_ref_track_all(lv_obj_t **const refs[], size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        ui_obj_ref_track(refs[i]);
+    }
+}
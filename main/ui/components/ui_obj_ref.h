@@ -0,0 +1,45 @@
+/**
+ * @file ui_obj_ref.h
+ * @brief Widget references that clear themselves when the widget is deleted
+ *
+ * lv_obj_is_valid() searches the object tree of every screen, so guarding each
+ * widget update with it costs O(objects) per call. A tracked reference is a
+ * plain lv_obj_t * variable that an LV_EVENT_DELETE callback sets to NULL, so
+ * its validity check is a NULL test and the variable can never dangle.
+ */
+
+#ifndef UI_OBJ_REF_H
+#define UI_OBJ_REF_H
+
+#include "lvgl.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Clear *ref when the object it currently points to is deleted
+ *
+ * Deleting a parent deletes its children, which clears their references too.
+ * Reassigning *ref is safe: the callback only clears it if it still points to
+ * the deleted object. Does nothing if *ref is NULL.
+ *
+ * @param ref Address of the variable holding the object (must outlive it)
+ * @note Call with the LVGL lock held, after the object is created.
+ */
+void ui_obj_ref_track(lv_obj_t **ref);
+
+/**
+ * @brief ui_obj_ref_track() for each entry of a table
+ *
+ * @param refs  Addresses of the variables to track
+ * @param count Number of entries
+ */
+void ui_obj_ref_track_all(lv_obj_t **const refs[], size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_OBJ_REF_H
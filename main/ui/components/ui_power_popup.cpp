@@ -6,6 +6,7 @@
 #include "ui_power_popup.h"
 #include "../ui.h"
 #include "../ui_scale.h"
+#include "ui_num_label.h"
 #include "esp_log.h"
 #include "esp_lvgl_port.h"  // For lvgl_port_lock/unlock
 #include "uart.h"           // For uart_write_message to send commands
@@ -347,20 +348,19 @@ void ui_power_popup_cleanup(void)
 
 static void update_value_label(void)
 {
+    static ui_num_label_t s_value_text;
     if (value_label == NULL) return;
 
-    char buf[16];
     // Special handling for different control types
     if (active_control == UI_CONTROL_DATA_MODE) {
         // Data mode: show OFF/ON instead of 0/1
-        snprintf(buf, sizeof(buf), "%s", current_value ? "ON" : "OFF");
-    } else if (active_control == UI_CONTROL_RIT_XIT_OFFSET) {
-        // RIT/XIT: use signed format to show + or - prefix
-        snprintf(buf, sizeof(buf), "%+d%s", current_value, get_unit_for_control(active_control));
+        ui_num_label_set_str(value_label, &s_value_text, current_value ? "ON" : "OFF");
     } else {
-        snprintf(buf, sizeof(buf), "%d%s", current_value, get_unit_for_control(active_control));
+        // RIT/XIT: use signed format to show + or - prefix
+        bool plus_sign = (active_control == UI_CONTROL_RIT_XIT_OFFSET);
+        ui_num_label_set_fixed(value_label, &s_value_text, current_value, 0, plus_sign,
+                               get_unit_for_control(active_control));
     }
-    lv_label_set_text(value_label, buf);
 }
 
 static const char *get_title_for_control(ui_control_type_t type)
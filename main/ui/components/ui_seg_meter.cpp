@@ -0,0 +1,172 @@
+/**
+ * @file ui_seg_meter.cpp
+ * @brief Segmented bar meter drawn by a single object
+ */
+
+#include "ui_seg_meter.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "UI_SEG_METER";
+
+// Off-state look of the original lv_bar segments (COLOR_BG_MEDIUM at opa 200)
+#define SEG_METER_OFF_COLOR 0x363636
+#define SEG_METER_OFF_OPA   200
+
+typedef struct {
+    uint8_t segments;
+    int32_t seg_width;
+    int32_t gap;
+    int32_t level;      // Lit segments
+    int32_t peak_index; // Segment showing the peak marker, -1 if none
+    lv_color_t on_colors[UI_SEG_METER_MAX_SEGMENTS];
+} seg_meter_t;
+
+static seg_meter_t *seg_meter_get(lv_obj_t *meter) {
+    if (meter == NULL) return NULL;
+    return (seg_meter_t *)lv_obj_get_user_data(meter);
+}
+
+static int32_t seg_meter_width(const seg_meter_t *m) {
+    return m->segments * m->seg_width + (m->segments - 1) * m->gap;
+}
+
+// Invalidate segments [first, last] only
+static void seg_meter_invalidate_span(lv_obj_t *meter, const seg_meter_t *m, int32_t first, int32_t last) {
+    if (first > last) return;
+    lv_area_t area;
+    lv_obj_get_coords(meter, &area);
+    int32_t x0 = area.x1;
+    area.x1 = x0 + first * (m->seg_width + m->gap);
+    area.x2 = x0 + last * (m->seg_width + m->gap) + m->seg_width - 1;
+    lv_obj_invalidate_area(meter, &area);
+}
+
+static void seg_meter_draw_cb(lv_event_t *e) {
+    lv_obj_t *meter = (lv_obj_t *)lv_event_get_target(e);
+    seg_meter_t *m = seg_meter_get(meter);
+    if (m == NULL) return;
+
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_area_t coords;
+    lv_obj_get_coords(meter, &coords);
+
+    lv_draw_rect_dsc_t off_dsc;
+    lv_draw_rect_dsc_init(&off_dsc);
+    off_dsc.radius = 0;
+    off_dsc.bg_color = lv_color_hex(SEG_METER_OFF_COLOR);
+    off_dsc.bg_opa = SEG_METER_OFF_OPA;
+
+    lv_draw_rect_dsc_t on_dsc;
+    lv_draw_rect_dsc_init(&on_dsc);
+    on_dsc.radius = 0;
+    on_dsc.bg_opa = LV_OPA_COVER;
+
+    lv_area_t seg;
+    seg.y1 = coords.y1;
+    seg.y2 = coords.y2;
+    for (int32_t i = 0; i < m->segments; i++) {
+        seg.x1 = coords.x1 + i * (m->seg_width + m->gap);
+        seg.x2 = seg.x1 + m->seg_width - 1;
+        if (i < m->level || i == m->peak_index) {
+            on_dsc.bg_color = m->on_colors[i];
+            lv_draw_rect(layer, &on_dsc, &seg);
+        } else {
+            lv_draw_rect(layer, &off_dsc, &seg);
+        }
+    }
+}
+
+static void seg_meter_delete_cb(lv_event_t *e) {
+    lv_obj_t *meter = (lv_obj_t *)lv_event_get_target(e);
+    seg_meter_t *m = seg_meter_get(meter);
+    if (m != NULL) {
+        lv_obj_set_user_data(meter, NULL);
+        lv_free(m);
+    }
+}
+
+lv_obj_t *ui_seg_meter_create(lv_obj_t *parent, uint8_t segments, int32_t seg_width,
+                              int32_t seg_height, int32_t gap) {
+    if (segments == 0 || segments > UI_SEG_METER_MAX_SEGMENTS) {
+        ESP_LOGE(TAG, "Invalid segment count: %u", segments);
+        return NULL;
+    }
+
+    seg_meter_t *m = (seg_meter_t *)lv_malloc(sizeof(seg_meter_t));
+    if (m == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate meter state");
+        return NULL;
+    }
+    memset(m, 0, sizeof(*m));
+    m->segments = segments;
+    m->seg_width = seg_width;
+    m->gap = gap;
+    m->peak_index = -1;
+    for (int i = 0; i < UI_SEG_METER_MAX_SEGMENTS; i++) {
+        m->on_colors[i] = lv_color_hex(SEG_METER_OFF_COLOR);
+    }
+
+    lv_obj_t *meter = lv_obj_create(parent);
+    lv_obj_remove_style_all(meter);
+    lv_obj_remove_flag(meter, (lv_obj_flag_t)(LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE));
+    lv_obj_set_user_data(meter, m);
+    lv_obj_set_size(meter, seg_meter_width(m), seg_height);
+    lv_obj_add_event_cb(meter, seg_meter_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(meter, seg_meter_delete_cb, LV_EVENT_DELETE, NULL);
+    return meter;
+}
+
+void ui_seg_meter_set_colors(lv_obj_t *meter, const lv_color_t colors[], uint8_t count) {
+    seg_meter_t *m = seg_meter_get(meter);
+    if (m == NULL || colors == NULL) return;
+    if (count > UI_SEG_METER_MAX_SEGMENTS) count = UI_SEG_METER_MAX_SEGMENTS;
+    memcpy(m->on_colors, colors, count * sizeof(lv_color_t));
+    lv_obj_invalidate(meter);
+}
+
+void ui_seg_meter_set_layout(lv_obj_t *meter, uint8_t segments, int32_t seg_width) {
+    seg_meter_t *m = seg_meter_get(meter);
+    if (m == NULL || segments == 0 || segments > UI_SEG_METER_MAX_SEGMENTS) return;
+    m->segments = segments;
+    m->seg_width = seg_width;
+    m->level = 0;
+    m->peak_index = -1;
+    lv_obj_set_width(meter, seg_meter_width(m));
+    lv_obj_invalidate(meter);
+}
+
+bool ui_seg_meter_set_value(lv_obj_t *meter, int32_t level, int32_t peak) {
+    seg_meter_t *m = seg_meter_get(meter);
+    if (m == NULL) return false;
+
+    if (level < 0) level = 0;
+    if (level > m->segments) level = m->segments;
+    if (peak > m->segments) peak = m->segments;
+    // Peak marker only shows above the live level
+    int32_t peak_index = (peak > level) ? peak - 1 : -1;
+
+    if (level == m->level && peak_index == m->peak_index) {
+        return false;
+    }
+
+    // Segments whose lit state flips: [min(old,new), max(old,new)-1]
+    if (level != m->level) {
+        int32_t lo = (level < m->level) ? level : m->level;
+        int32_t hi = (level < m->level) ? m->level : level;
+        seg_meter_invalidate_span(meter, m, lo, hi - 1);
+    }
+    if (peak_index != m->peak_index) {
+        if (m->peak_index >= 0) seg_meter_invalidate_span(meter, m, m->peak_index, m->peak_index);
+        if (peak_index >= 0) seg_meter_invalidate_span(meter, m, peak_index, peak_index);
+    }
+
+    m->level = level;
+    m->peak_index = peak_index;
+    return true;
+}
+
+int32_t ui_seg_meter_get_level(lv_obj_t *meter) {
+    seg_meter_t *m = seg_meter_get(meter);
+    return m ? m->level : 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file ui_seg_meter.h
+ * @brief Segmented bar meter drawn by a single object
+ *
+ * Replaces a row of one-segment lv_bar objects with one object whose draw
+ * callback paints every segment and the peak marker. Level changes invalidate
+ * only the segments between the old and new level, so a 20 Hz meter redraws a
+ * few small rectangles instead of re-laying out and restyling dozens of bars.
+ */
+
+#ifndef UI_SEG_METER_H
+#define UI_SEG_METER_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_SEG_METER_MAX_SEGMENTS 30
+
+/**
+ * @brief Create a segmented meter
+ * @param parent Parent object
+ * @param segments Number of segments (1..UI_SEG_METER_MAX_SEGMENTS)
+ * @param seg_width Width of one segment in pixels
+ * @param seg_height Height of the meter in pixels
+ * @param gap Gap between segments in pixels
+ * @return The meter object, or NULL on allocation failure
+ * @note All segments start unlit in the off-state gray used by the other meters
+ */
+lv_obj_t *ui_seg_meter_create(lv_obj_t *parent, uint8_t segments, int32_t seg_width,
+                              int32_t seg_height, int32_t gap);
+
+/**
+ * @brief Set the lit color of each segment
+ * @param meter Meter object
+ * @param colors One color per segment
+ * @param count Number of entries in colors (extra segments keep their color)
+ */
+void ui_seg_meter_set_colors(lv_obj_t *meter, const lv_color_t colors[], uint8_t count);
+
+/**
+ * @brief Change segment count and width (e.g. ALC single/dual layout)
+ * @param meter Meter object
+ * @param segments New number of segments
+ * @param seg_width New segment width in pixels
+ * @note Resets the level and peak to 0 and redraws the whole meter
+ */
+void ui_seg_meter_set_layout(lv_obj_t *meter, uint8_t segments, int32_t seg_width);
+
+/**
+ * @brief Set the lit level and peak marker
+ * @param meter Meter object
+ * @param level Number of lit segments (clamped to 0..segments)
+ * @param peak Peak in segments; the marker lights segment peak-1 when above level. 0 hides it
+ * @return true if anything changed and part of the meter was invalidated
+ */
+bool ui_seg_meter_set_value(lv_obj_t *meter, int32_t level, int32_t peak);
+
+/**
+ * @brief Get the current lit level
+ * @param meter Meter object
+ * @return Number of lit segments
+ */
+int32_t ui_seg_meter_get_level(lv_obj_t *meter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_SEG_METER_H
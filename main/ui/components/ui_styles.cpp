@@ -0,0 +1,92 @@
+/**
+ * @file ui_styles.cpp
+ * @brief Shared style objects for frequently restyled widgets
+ */
+
+#include "ui_styles.h"
+#include "../ui_scale.h"
+
+// Same values as the per-screen palettes
+#define COLOR_BG_DARK            0x292831  // Panel background
+#define COLOR_BLUE_PRIMARY       0x2095F6  // Main theme blue
+#define COLOR_BLUE_VFO_A_CHECKED 0x1A92F7  // Active VFO indicator
+#define COLOR_GREEN_RX_ACTIVE    0x2B9B25  // RX label
+#define COLOR_RED_TX_ACTIVE      0xD90202  // TX label
+#define COLOR_ORANGE             0xFF8C00  // XIT
+#define COLOR_ORANGE_VIBRANT     0xF26419  // RIT
+#define COLOR_TEXT               0xFFFFFF
+#define COLOR_BORDER             0x000000
+
+static lv_style_t s_styles[UI_STYLE_COUNT];
+static bool s_styles_ready = false;
+
+void ui_styles_init(void) {
+    if (s_styles_ready) return;
+
+    for (int i = 0; i < UI_STYLE_COUNT; i++) {
+        lv_style_init(&s_styles[i]);
+    }
+
+    lv_style_t *s = &s_styles[UI_STYLE_TOGGLE_BTN];
+    lv_style_set_radius(s, 5);
+    lv_style_set_bg_color(s, lv_color_hex(COLOR_BG_DARK));
+    lv_style_set_bg_opa(s, LV_OPA_COVER);
+
+    s = &s_styles[UI_STYLE_TOGGLE_BTN_CHECKED];
+    lv_style_set_bg_color(s, lv_color_hex(COLOR_BLUE_PRIMARY));
+    lv_style_set_bg_opa(s, LV_OPA_COVER);
+
+    s = &s_styles[UI_STYLE_BTN_LABEL];
+    lv_style_set_text_align(s, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_text_font(s, ui_btn_font());
+
+    s = &s_styles[UI_STYLE_RXTX];
+    lv_style_set_text_color(s, lv_color_hex(COLOR_TEXT));
+    lv_style_set_text_font(s, ui_btn_font());
+    lv_style_set_text_align(s, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_radius(s, 5);
+    lv_style_set_bg_color(s, lv_color_hex(COLOR_GREEN_RX_ACTIVE));
+    lv_style_set_bg_opa(s, LV_OPA_COVER);
+    lv_style_set_pad_left(s, 3);
+    lv_style_set_pad_right(s, 3);
+    lv_style_set_pad_top(s, 5);
+    lv_style_set_pad_bottom(s, 1);
+
+    s = &s_styles[UI_STYLE_RXTX_TX];
+    lv_style_set_bg_color(s, lv_color_hex(COLOR_RED_TX_ACTIVE));
+
+    s = &s_styles[UI_STYLE_VFO_ACTIVE];
+    lv_style_set_radius(s, 5);
+    lv_style_set_bg_color(s, lv_color_hex(COLOR_BLUE_VFO_A_CHECKED));
+    lv_style_set_bg_opa(s, LV_OPA_COVER);
+    lv_style_set_border_color(s, lv_color_hex(COLOR_BORDER));
+    lv_style_set_border_opa(s, LV_OPA_COVER);
+
+    s = &s_styles[UI_STYLE_RIT];
+    lv_style_set_text_color(s, lv_color_hex(COLOR_ORANGE_VIBRANT));
+    lv_style_set_text_font(s, ui_btn_small_reg_font());
+
+    s = &s_styles[UI_STYLE_XIT];
+    lv_style_set_text_color(s, lv_color_hex(COLOR_ORANGE));
+    lv_style_set_text_font(s, ui_btn_small_reg_font());
+
+    s = &s_styles[UI_STYLE_PENDING];
+    lv_style_set_outline_width(s, 2);
+    lv_style_set_outline_pad(s, 1);
+    lv_style_set_outline_color(s, lv_color_hex(COLOR_TEXT));
+    lv_style_set_outline_opa(s, LV_OPA_60);
+
+    s_styles_ready = true;
+}
+
+const lv_style_t *ui_style(ui_style_id_t id) {
+    return &s_styles[id];
+}
+
+void ui_style_add_toggle_button(lv_obj_t *btn) {
+    lv_obj_add_style(btn, &s_styles[UI_STYLE_TOGGLE_BTN], LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(btn, &s_styles[UI_STYLE_TOGGLE_BTN_CHECKED], LV_PART_MAIN | LV_STATE_CHECKED);
+    // The theme's pressed style outranks a plain CHECKED selector
+    lv_obj_add_style(btn, &s_styles[UI_STYLE_TOGGLE_BTN_CHECKED], LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
+    lv_obj_add_style(btn, &s_styles[UI_STYLE_PENDING], LV_PART_MAIN | LV_STATE_USER_1);
+}
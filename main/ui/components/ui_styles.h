@@ -0,0 +1,60 @@
+/**
+ * @file ui_styles.h
+ * @brief Shared style objects for frequently restyled widgets
+ *
+ * Each visual state (toggle on/off, RX/TX, active VFO, RIT/XIT) is one
+ * preconstructed lv_style_t added to every widget that uses it, selected by
+ * the widget's LV_STATE_* bits. State changes then toggle a state flag instead
+ * of writing local style properties, which allocate per object and force a
+ * style refresh on each call.
+ */
+
+#ifndef UI_STYLES_H
+#define UI_STYLES_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    UI_STYLE_TOGGLE_BTN,          ///< Dark rounded button, off state
+    UI_STYLE_TOGGLE_BTN_CHECKED,  ///< Blue fill, on state (also used while pressed)
+    UI_STYLE_BTN_LABEL,           ///< Centered button-font label
+    UI_STYLE_RXTX,                ///< Green RX pill
+    UI_STYLE_RXTX_TX,             ///< Red fill while transmitting
+    UI_STYLE_VFO_ACTIVE,          ///< Blue pill behind the active VFO / memory indicator
+    UI_STYLE_RIT,                 ///< RIT label and offset text
+    UI_STYLE_XIT,                 ///< XIT label and offset text
+    UI_STYLE_PENDING,             ///< Outline while a touch change awaits the radio (LV_STATE_USER_1)
+    UI_STYLE_COUNT
+} ui_style_id_t;
+
+/**
+ * @brief Build the shared styles
+ * @note Call once with the LVGL lock held, before any screen is created.
+ *       The styles live for the lifetime of the firmware.
+ */
+void ui_styles_init(void);
+
+/**
+ * @brief Get a shared style
+ * @param id Style identifier
+ * @return The style, valid after ui_styles_init()
+ */
+const lv_style_t *ui_style(ui_style_id_t id);
+
+/**
+ * @brief Apply the off/on toggle button styles to a checkable button
+ *
+ * Includes UI_STYLE_PENDING for the LV_STATE_USER_1 state.
+ * @param btn Button object
+ */
+void ui_style_add_toggle_button(lv_obj_t *btn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_STYLES_H
@@ -0,0 +1,307 @@
+/**
+ * @file ui_tune.cpp
+ * @brief Drag-to-tune with step acceleration, inertia and coalesced frequency writes
+ */
+
+#include "ui_tune.h"
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "TUNE";
+
+#define TUNE_FREQ_MIN_HZ 30000
+#define TUNE_FREQ_MAX_HZ 300000000
+#define TUNE_RESOLUTION_HZ 10
+#define TUNE_INERTIA_TICK_MS 16
+#define TUNE_FRICTION_PER_TICK 0.90f    // Velocity kept per inertia tick (~150 ms time constant)
+#define TUNE_FLING_MIN_PX_MS 0.3f       // Slower releases stop dead
+#define TUNE_STOP_PX_MS 0.05f
+#define TUNE_VELOCITY_WEIGHT 0.5f       // Weight of the newest sample in the velocity average
+#define TUNE_HOLD_MS 60                 // No movement for this long before release means no fling
+#define TUNE_OVERSHOOT_WINDOW_MS 1500   // Tuning back this soon after a fling counts as overshoot
+
+// Hz per pixel by drag speed (px/ms): slow drags tune finely, fast ones cross a band
+static const struct {
+    float min_px_per_ms;
+    uint16_t hz_per_px;
+} s_accel[] = {
+    {0.0f, 10},
+    {0.25f, 50},
+    {0.6f, 200},
+    {1.2f, 1000},
+    {2.5f, 5000},
+};
+
+// ============================================================================
+// State
+// ============================================================================
+
+static lv_obj_t *s_obj = NULL;
+static const ui_tune_ops_t *s_ops = NULL;
+static lv_timer_t *s_write_timer = NULL;
+static lv_timer_t *s_inertia_timer = NULL;
+
+static bool s_session = false;
+static bool s_pressed = false;
+static bool s_gliding = false;
+static float s_velocity = 0.0f;         // px/ms, positive raises the frequency
+static float s_hz_remainder = 0.0f;     // Sub-resolution movement carried to the next move
+static uint32_t s_target = 0;
+static uint32_t s_written = 0;
+static uint32_t s_last_move_ms = 0;
+static uint32_t s_last_write_ms = 0;
+static uint32_t s_inertia_tick_ms = 0;
+
+static int8_t s_fling_dir = 0;          // Direction of the last fling
+static uint32_t s_fling_end_ms = 0;
+static int8_t s_overshoot_dir = 0;      // Direction that counts as tuning back, 0 if none
+
+static uint32_t s_session_start_ms = 0;
+static ui_tune_stats_t s_session_stats;
+static ui_tune_stats_t s_totals;
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+static uint16_t hz_per_px(float velocity) {
+    float speed = fabsf(velocity);
+    uint16_t step = s_accel[0].hz_per_px;
+    for (size_t i = 1; i < sizeof(s_accel) / sizeof(s_accel[0]); i++) {
+        if (speed < s_accel[i].min_px_per_ms) break;
+        step = s_accel[i].hz_per_px;
+    }
+    return step;
+}
+
+static void write_target(void) {
+    s_ops->write(s_target);
+    s_written = s_target;
+    s_last_write_ms = lv_tick_get();
+    s_session_stats.writes++;
+}
+
+static void end_session(void) {
+    s_session = false;
+    lv_timer_pause(s_write_timer);
+
+    ui_tune_stats_t *st = &s_session_stats;
+    st->sessions = 1;
+    st->duration_ms = lv_tick_diff(s_last_write_ms, s_session_start_ms);
+    if (st->moves > 0) {
+        uint32_t t = st->duration_ms ? st->duration_ms : 1;
+        uint32_t rate_x10 = st->writes * 10000 / t;
+        ESP_LOGI(TAG, "%lu ms, %lu moves, %lu writes (%lu.%lu/s, %lu coalesced), inertia %lu Hz, overshoot %lu Hz",
+                 (unsigned long)st->duration_ms, (unsigned long)st->moves, (unsigned long)st->writes,
+                 (unsigned long)(rate_x10 / 10), (unsigned long)(rate_x10 % 10),
+                 (unsigned long)(st->moves > st->writes ? st->moves - st->writes : 0),
+                 (unsigned long)st->inertia_hz, (unsigned long)st->overshoot_hz);
+    }
+
+    s_totals.sessions += st->sessions;
+    s_totals.duration_ms += st->duration_ms;
+    s_totals.moves += st->moves;
+    s_totals.writes += st->writes;
+    s_totals.inertia_hz += st->inertia_hz;
+    s_totals.overshoot_hz += st->overshoot_hz;
+
+    if (s_ops->end != NULL) {
+        s_ops->end();
+    }
+}
+
+// Moves the target by hz; returns the distance actually moved
+static uint32_t move_by(float hz) {
+    s_hz_remainder += hz;
+    int32_t step = (int32_t)(s_hz_remainder / TUNE_RESOLUTION_HZ) * TUNE_RESOLUTION_HZ;
+    if (step == 0) return 0;
+    s_hz_remainder -= (float)step;
+
+    int64_t next = (int64_t)s_target + step;
+    if (next < TUNE_FREQ_MIN_HZ) next = TUNE_FREQ_MIN_HZ;
+    if (next > TUNE_FREQ_MAX_HZ) next = TUNE_FREQ_MAX_HZ;
+    uint32_t moved = (uint32_t)llabs(next - (int64_t)s_target);
+    if (moved == 0) return 0;
+
+    if (s_overshoot_dir != 0 && (step > 0 ? 1 : -1) == s_overshoot_dir) {
+        s_session_stats.overshoot_hz += moved;
+    }
+    s_target = (uint32_t)next;
+    s_ops->show(s_target);
+    s_session_stats.moves++;
+
+    // Leading edge: the first move after a quiet slot is written at once
+    if (lv_timer_get_paused(s_write_timer)) {
+        write_target();
+        lv_timer_reset(s_write_timer);
+        lv_timer_resume(s_write_timer);
+    }
+    return moved;
+}
+
+static void write_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+    if (s_target != s_written) {
+        write_target();
+    } else if (s_pressed || s_gliding) {
+        // Nothing new this slot; the next move is written immediately
+        lv_timer_pause(s_write_timer);
+    } else {
+        end_session();
+    }
+}
+
+static void stop_glide(void) {
+    if (!s_gliding) return;
+    s_gliding = false;
+    s_fling_end_ms = lv_tick_get();
+    lv_timer_pause(s_inertia_timer);
+    if (lv_timer_get_paused(s_write_timer)) {
+        end_session();
+    }
+}
+
+static void inertia_timer_cb(lv_timer_t *timer) {
+    LV_UNUSED(timer);
+    uint32_t dt = lv_tick_elaps(s_inertia_tick_ms);
+    s_inertia_tick_ms = lv_tick_get();
+
+    s_session_stats.inertia_hz += move_by(s_velocity * (float)dt * hz_per_px(s_velocity));
+    s_velocity *= powf(TUNE_FRICTION_PER_TICK, (float)dt / TUNE_INERTIA_TICK_MS);
+
+    if (fabsf(s_velocity) < TUNE_STOP_PX_MS || s_target == TUNE_FREQ_MIN_HZ || s_target == TUNE_FREQ_MAX_HZ) {
+        stop_glide();
+    }
+}
+
+// ============================================================================
+// Gesture handling
+// ============================================================================
+
+static void on_pressed(void) {
+    // Catching a fling stops it but continues the session
+    bool caught = s_gliding;
+    if (caught) {
+        s_gliding = false;
+        s_fling_end_ms = lv_tick_get();
+        lv_timer_pause(s_inertia_timer);
+    }
+
+    if (!s_session) {
+        uint32_t freq = s_ops->get_freq();
+        if (freq == 0) return;
+        s_session = true;
+        s_target = freq;
+        s_written = freq;
+        s_session_start_ms = lv_tick_get();
+        s_last_write_ms = s_session_start_ms;
+        memset(&s_session_stats, 0, sizeof(s_session_stats));
+    }
+
+    // Pulling back against a fling that just ended (or was caught) corrects an overshoot
+    s_overshoot_dir = 0;
+    if (s_fling_dir != 0 && (caught || lv_tick_elaps(s_fling_end_ms) < TUNE_OVERSHOOT_WINDOW_MS)) {
+        s_overshoot_dir = (int8_t)-s_fling_dir;
+    }
+
+    s_pressed = true;
+    s_velocity = 0.0f;
+    s_hz_remainder = 0.0f;
+    s_last_move_ms = lv_tick_get();
+}
+
+static void on_pressing(void) {
+    if (!s_pressed) return;
+
+    lv_point_t vect;
+    lv_indev_get_vect(lv_indev_active(), &vect);
+    int32_t px = vect.x - vect.y;   // Right and up raise the frequency
+    uint32_t dt = lv_tick_elaps(s_last_move_ms);
+    if (px == 0) {
+        if (dt > TUNE_HOLD_MS) s_velocity = 0.0f;
+        return;
+    }
+    s_last_move_ms = lv_tick_get();
+
+    float sample = (float)px / (float)(dt ? dt : 1);
+    s_velocity += TUNE_VELOCITY_WEIGHT * (sample - s_velocity);
+    move_by((float)px * hz_per_px(s_velocity));
+}
+
+static void on_released(void) {
+    if (!s_pressed) return;
+    s_pressed = false;
+    s_overshoot_dir = 0;
+
+    if (lv_tick_elaps(s_last_move_ms) > TUNE_HOLD_MS || fabsf(s_velocity) < TUNE_FLING_MIN_PX_MS) {
+        if (lv_timer_get_paused(s_write_timer)) {
+            end_session();
+        }
+        return;
+    }
+    s_gliding = true;
+    s_fling_dir = s_velocity > 0 ? 1 : -1;
+    s_inertia_tick_ms = lv_tick_get();
+    lv_timer_reset(s_inertia_timer);
+    lv_timer_resume(s_inertia_timer);
+}
+
+static void tune_event_cb(lv_event_t *e) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_PRESSED:
+            on_pressed();
+            break;
+        case LV_EVENT_PRESSING:
+            on_pressing();
+            break;
+        case LV_EVENT_RELEASED:
+        case LV_EVENT_PRESS_LOST:
+            on_released();
+            break;
+        case LV_EVENT_DELETE:
+            lv_timer_pause(s_inertia_timer);
+            lv_timer_pause(s_write_timer);
+            s_pressed = false;
+            s_gliding = false;
+            s_session = false;
+            s_obj = NULL;
+            break;
+        default:
+            break;
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void ui_tune_attach(lv_obj_t *obj, const ui_tune_ops_t *ops) {
+    if (obj == NULL || ops == NULL) return;
+
+    if (s_write_timer == NULL) {
+        s_write_timer = lv_timer_create(write_timer_cb, CONFIG_UI_TUNE_WRITE_INTERVAL_MS, NULL);
+        lv_timer_pause(s_write_timer);
+        s_inertia_timer = lv_timer_create(inertia_timer_cb, TUNE_INERTIA_TICK_MS, NULL);
+        lv_timer_pause(s_inertia_timer);
+    }
+    if (s_obj != NULL) {
+        lv_obj_remove_event_cb(s_obj, tune_event_cb);
+    }
+
+    s_obj = obj;
+    s_ops = ops;
+    lv_obj_add_flag(obj, (lv_obj_flag_t)(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_PRESS_LOCK));
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE);
+    lv_obj_add_event_cb(obj, tune_event_cb, LV_EVENT_ALL, NULL);
+}
+
+bool ui_tune_is_active(void) {
+    return s_session;
+}
+
+void ui_tune_get_stats(ui_tune_stats_t *out) {
+    if (out == NULL) return;
+    *out = s_totals;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file ui_tune.h
+ * @brief Drag-to-tune with step acceleration, inertia and coalesced frequency writes
+ *
+ * Dragging on the attached widget tunes: right or up raises the frequency.
+ * The frequency change per pixel grows with drag speed, and a fling keeps
+ * tuning after release while its speed decays. The target is shown on every
+ * move but written to the radio at most once per write slot
+ * (CONFIG_UI_TUNE_WRITE_INTERVAL_MS), always with the latest target, so the
+ * CAT link never queues a backlog of intermediate frequencies.
+ *
+ * Each tuning session logs its write rate, the distance covered by inertia and
+ * how much of it the operator tuned back (overshoot), to help tune the feel.
+ *
+ * All functions must be called with the LVGL lock held (or from the LVGL task).
+ */
+
+#ifndef UI_TUNE_H
+#define UI_TUNE_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Frequency access for the tuning engine (display frequencies, Hz)
+ */
+typedef struct {
+    uint32_t (*get_freq)(void);         ///< Frequency to start from, 0 if tuning is not possible now
+    void (*show)(uint32_t freq_hz);     ///< Show the target on screen
+    void (*write)(uint32_t freq_hz);    ///< Send the target to the radio
+    void (*end)(void);                  ///< Session over, radio reports may be shown again; may be NULL
+} ui_tune_ops_t;
+
+/**
+ * @brief Totals over all tuning sessions since boot
+ */
+typedef struct {
+    uint32_t sessions;
+    uint32_t duration_ms;       ///< First press to last write
+    uint32_t moves;             ///< Target changes shown on screen
+    uint32_t writes;            ///< Frequency writes sent to the radio
+    uint32_t inertia_hz;        ///< Distance tuned by inertia after release
+    uint32_t overshoot_hz;      ///< Distance tuned back against a fling right after it
+} ui_tune_stats_t;
+
+/**
+ * @brief Make a widget a tuning surface
+ *
+ * Only one widget can be attached at a time; a later call replaces it.
+ *
+ * @param obj Widget receiving the drags (made clickable)
+ * @param ops Frequency access, must stay valid while attached
+ */
+void ui_tune_attach(lv_obj_t *obj, const ui_tune_ops_t *ops);
+
+/**
+ * @brief Whether a tuning session is in progress
+ *
+ * True while pressed, while a fling is decaying, and until the final target
+ * has been written. Frequency reports from the radio lag behind the target
+ * during this time and should not be shown; ops->end is called when it
+ * becomes false so the latest report can be drawn.
+ */
+bool ui_tune_is_active(void);
+
+/**
+ * @brief Get the totals since boot
+ * @param out Filled with the totals
+ */
+void ui_tune_get_stats(ui_tune_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_TUNE_H
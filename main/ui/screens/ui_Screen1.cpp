@@ -16,11 +16,19 @@
 #include "uart.h"
 #include "settings_storage.h"
 #include "../components/ui_power_popup.h"
+#include "../components/ui_seg_meter.h"
+#include "../components/ui_freq_display.h"
+#include "../components/ui_styles.h"
+#include "../components/ui_obj_ref.h"
+#include "../components/ui_num_label.h"
+#include "../components/ui_local_echo.h"
+#include "../components/ui_tune.h"
 #include "cat_state.hpp" // For radio_get_ssb_filter_mode
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h" // For ESP_LOGI
+#include "esp_timer.h" // For boot timing
 
 // Static variables to track multi-state button modes
 static int nr_mode = 0; // 0=OFF, 1=NR1, 2=NR2
@@ -29,7 +37,7 @@ static bool g_data_mode_active = false; // Track DATA mode status
 
 // Helper functions to update button labels
 static void update_nr_button_label() {
-    if (!lv_obj_is_valid(ui_NrButtonLabel)) return;
+    if (!ui_NrButtonLabel) return;
     
     if (nr_mode == 0) {
         lv_label_set_text(ui_NrButtonLabel, "NR");
@@ -41,7 +49,7 @@ static void update_nr_button_label() {
 }
 
 static void update_nb_button_label() {
-    if (!lv_obj_is_valid(ui_NbButtonLabel)) return;
+    if (!ui_NbButtonLabel) return;
     
     if (nb_mode == 0) {
         lv_label_set_text(ui_NbButtonLabel, "NB");
@@ -56,7 +64,7 @@ static void update_nb_button_label() {
 static int current_filter = 1; // Default to Filter A (FL1)
 
 static void update_filter_labels() {
-    if (!lv_obj_is_valid(ui_IfFilterALabel) || !lv_obj_is_valid(ui_IfFilterBLabel)) return;
+    if (!ui_IfFilterALabel || !ui_IfFilterBLabel) return;
 
     // Hide both filter labels
     lv_obj_add_flag(ui_IfFilterALabel, LV_OBJ_FLAG_HIDDEN);
@@ -123,35 +131,26 @@ void ui_screen1_update_filter(int filter_value) {
 
 lv_obj_t *ui_Screen1;
 lv_obj_t *ui_SignalPanel;
-lv_obj_t *ui_SMeterSegmentsContainer; // Container for S-Meter segments
-lv_obj_t *ui_SMeterSegments[30]; // Array for 30 S-Meter segments
+lv_obj_t *ui_SMeterSegmentsContainer; // S-Meter (single-draw segmented meter)
 lv_obj_t *ui_SMeterLabel;
 lv_obj_t *ui_Switch1;
 lv_obj_t *ui_SwrMeterLabel;
-lv_obj_t *ui_SwrMeterSegmentsContainer; // Container for SWR segments
-lv_obj_t *ui_SwrMeterSegments[30]; // Array for 30 SWR segments
+lv_obj_t *ui_SwrMeterSegmentsContainer; // SWR meter (single-draw segmented meter)
 // lv_obj_t *ui_SwrTextLabel; // Replaced by ui_SwrMeterLabelsContainer
 lv_obj_t *ui_SMeterLabelsContainer; // Container for S-Meter tick labels
 lv_obj_t *ui_SMeterTickLabels[8]; // Array for 8 S-Meter tick labels (now in ui_SMeterLabelsContainer)
 lv_obj_t *ui_SwrMeterLabelsContainer; // NEW: Container for SWR tick labels
 lv_obj_t *ui_SwrMeterTickLabels[5]; // NEW: Array for 5 SWR tick labels (removed "5")
-lv_obj_t *ui_AlcMeterSegmentsContainer; // Container for ALC segments
-lv_obj_t *ui_AlcMeterSegments[30]; // Array for 30 ALC segments
+lv_obj_t *ui_AlcMeterSegmentsContainer; // ALC meter (single-draw segmented meter)
 lv_obj_t *ui_AlcLabel;
-lv_obj_t *ui_CompMeterSegmentsContainer; // Container for COMP segments
-lv_obj_t *ui_CompMeterSegments[15]; // Array for 15 COMP segments (dual mode)
+lv_obj_t *ui_CompMeterSegmentsContainer; // COMP meter (single-draw segmented meter, dual mode)
 lv_obj_t *ui_CompLabel;
 lv_obj_t *ui_AfGainBar;
 lv_obj_t *ui_AfGainLabel;
 lv_obj_t *ui_RfGainLabel;
 lv_obj_t *ui_RfGainBar;
 lv_obj_t *ui_VfoAValue;
-lv_obj_t *ui_VfoAFreqContainer; // Container for segmented frequency display
-lv_obj_t *ui_VfoAFreqMHz; // MHz segment (e.g., "14")
-lv_obj_t *ui_VfoAFreqKHz; // kHz segment (e.g., "012")
-lv_obj_t *ui_VfoAFreqHz; // Hz segment (e.g., "000")
-lv_obj_t *ui_VfoAFreqDot1; // First period separator "."
-lv_obj_t *ui_VfoAFreqDot2; // Second period separator "."
+lv_obj_t *ui_VfoAFreqDisplay; // Main frequency readout (digit atlas)
 lv_obj_t *ui_ModeLabel;
 lv_obj_t *ui_DataModeLabel;
 lv_obj_t *ui_VfoBValue;
@@ -239,15 +238,6 @@ static const int PEAK_DECAY_RATE = 1; // Segments per decay interval
 static const uint32_t METER_UPDATE_INTERVAL_MS = 30;  // 33Hz max (was 10ms/100Hz, caused jitter)
 static const uint32_t VFO_UPDATE_THROTTLE_MS = 10;    // 100Hz max (was 5ms/200Hz)
 
-// GLOBAL frequency string cache for ULTRA-FAST display updates (exposed to CAT parser)
-bool g_freq_cache_initialized = false;
-const char* g_khz_cache[1000]; // 000-999
-const char* g_hz_cache[1000];  // 000-999  
-const char* g_mhz_cache[1000]; // 0-999 MHz
-static EXT_RAM_BSS_ATTR char g_khz_strings[1000][4];   // Storage for khz strings in SPIRAM
-static EXT_RAM_BSS_ATTR char g_hz_strings[1000][4];    // Storage for hz strings in SPIRAM
-static EXT_RAM_BSS_ATTR char g_mhz_strings[1000][4];   // Storage for MHz strings in SPIRAM
-
 // CAT Connection Status
 static const uint32_t CAT_INACTIVITY_TIMEOUT_MS = 190000; // 3 minutes and 10 seconds
 static lv_timer_t *ui_cat_activity_check_timer = NULL; // New LVGL timer for UI-based check
@@ -271,6 +261,28 @@ static uint16_t s_current_low_cut_hz = 300;   // Example default low-cut for non
 static uint16_t s_current_cw_filter_width_hz = 500; // Default CW filter width (e.g., 500Hz)
 int s_current_radio_mode = 2; // Example default mode (e.g., 2 for USB)
 
+// Touch-initiated settings are shown before the radio echoes them back (see ui_local_echo.h).
+// The radio normally answers within a few CAT polls; after this the display reverts.
+// Settings that IF does not carry are read back right after the set command:
+// with auto-information off the radio never reports them on its own, and the
+// periodic repoll is minutes apart.
+#define LOCAL_ECHO_TIMEOUT_MS 1500
+static void echo_apply_mode(int32_t value);
+static void echo_apply_nr(int32_t value);
+static void echo_apply_nb(int32_t value);
+static void echo_apply_preamp(int32_t value);
+static void echo_apply_att(int32_t value);
+static void echo_apply_proc(int32_t value);
+static void echo_apply_freq(int32_t value);
+static ui_local_echo_t s_mode_echo = UI_LOCAL_ECHO_INIT("Mode", echo_apply_mode, &ui_ModeLabel, LOCAL_ECHO_TIMEOUT_MS);
+static ui_local_echo_t s_nr_echo = UI_LOCAL_ECHO_INIT("NR", echo_apply_nr, &ui_NrButton, LOCAL_ECHO_TIMEOUT_MS);
+static ui_local_echo_t s_nb_echo = UI_LOCAL_ECHO_INIT("NB", echo_apply_nb, &ui_NbButton, LOCAL_ECHO_TIMEOUT_MS);
+static ui_local_echo_t s_preamp_echo = UI_LOCAL_ECHO_INIT("PreAmp", echo_apply_preamp, &ui_PreAmpButton, LOCAL_ECHO_TIMEOUT_MS);
+static ui_local_echo_t s_att_echo = UI_LOCAL_ECHO_INIT("ATT", echo_apply_att, &ui_AttButton, LOCAL_ECHO_TIMEOUT_MS);
+static ui_local_echo_t s_proc_echo = UI_LOCAL_ECHO_INIT("PROC", echo_apply_proc, &ui_ProcButton, LOCAL_ECHO_TIMEOUT_MS);
+// Active VFO frequency written by drag tuning (see ui_tune.h)
+static ui_local_echo_t s_freq_echo = UI_LOCAL_ECHO_INIT("Tune", echo_apply_freq, NULL, LOCAL_ECHO_TIMEOUT_MS);
+
 // ============================================================================
 // Filter lookup tables from TS-590SG CAT Command Reference
 // ============================================================================
@@ -345,17 +357,6 @@ static const uint32_t METER_MODE_SWITCH_DEBOUNCE_MS = 150; // Ignore updates for
 
 static meter_layout_mode_t s_current_meter_layout = METER_LAYOUT_SINGLE_ALC;
 
-// REVOLUTIONARY S-meter state tracking for delta-only updates
-static int s_meter_prev_state[30] = {0}; // Track previous state of each segment in internal RAM
-static int s_meter_prev_current = -1;    // Previous current segments count
-static int s_meter_prev_peak = -1;       // Previous peak segments count
-static bool s_meter_prev_peak_enabled = false; // Previous peak hold state
-
-// SWR/ALC meter state tracking for reliable delta-only updates (mirrors S-meter approach)
-static int swr_meter_prev_state[30] = {0};  // Track previous state of each SWR segment
-static int swr_meter_prev_current = -1;     // Previous SWR segments count
-static int alc_meter_prev_state[30] = {0};  // Track previous state of each ALC segment
-static int alc_meter_prev_current = -1;     // Previous ALC segments count
 // static lv_obj_t *s_meter_peak_indicator = NULL; // Removed: Single visual peak indicator object
 
 // Power meter rescaling: Track maximum SM value observed during TX to handle radios that
@@ -367,7 +368,6 @@ static int max_sm_tx_value = 30;  // Default to 30; gets updated to actual max o
 // static void update_peak_indicator(lv_obj_t *segments_array[], int peak_segment_index); // Removed
 
 static void update_rxtx_label_status(bool is_transmitting);
-static void reset_s_meter_state_tracking(void);
 static void force_clear_s_meter_segments(void);
 static void force_clear_swr_meter_segments(void);
 static void force_clear_alc_meter_segments(void);
@@ -396,26 +396,6 @@ static const char* get_mode_string(int cat_mode) {
     }
 }
 
-// Initialize shared frequency string cache once
-static void init_freq_cache(void) {
-    if (!g_freq_cache_initialized) {
-        for (int i = 0; i < 1000; i++) {
-            snprintf(g_khz_strings[i], 4, "%03d", i);
-            snprintf(g_hz_strings[i], 4, "%03d", i);
-            snprintf(g_mhz_strings[i], 4, "%u", i); // No leading zeros for MHz
-            g_khz_cache[i] = g_khz_strings[i];
-            g_hz_cache[i] = g_hz_strings[i];
-            g_mhz_cache[i] = g_mhz_strings[i];
-        }
-        g_freq_cache_initialized = true;
-    }
-}
-
-// Extern function for CAT parser to initialize frequency cache
-void init_freq_cache_extern(void) {
-    init_freq_cache();
-}
-
 // Event callback for ui_Screen1 deletion to clean up resources
 static void screen1_del_cb(lv_event_t *e)
 {
@@ -427,128 +407,13 @@ static void screen1_del_cb(lv_event_t *e)
     // Add other global resource cleanups specific to Screen1 here if needed in the future
 }
 
-// Helper function to create and style meter segments
-static void create_meter_segments(lv_obj_t *parent_container, lv_obj_t *segments_array[], int num_segments,
-                                  lv_coord_t bar_width, lv_coord_t bar_height, const lv_color_t segment_on_colors[]) {
-    for (int i = 0; i < num_segments; i++) {
-        segments_array[i] = lv_bar_create(parent_container);
-        lv_obj_set_size(segments_array[i], bar_width, bar_height);
-        lv_bar_set_range(segments_array[i], 0, 1); // On/Off
-        lv_bar_set_value(segments_array[i], 0, LV_ANIM_OFF); // Initial state: off
-
-        lv_obj_set_style_radius(segments_array[i], 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_color(segments_array[i], lv_color_hex(COLOR_BG_MEDIUM), LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(segments_array[i], 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-        lv_obj_set_style_radius(segments_array[i], 0, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_color(segments_array[i], segment_on_colors[i], LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(segments_array[i], 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_anim_time(segments_array[i], 50, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    }
-}
 
 // Helper function to update the display of a segmented meter
-static void update_meter_display(
-    lv_obj_t *segments_array[],
-    int total_segments,
-    int current_segments_to_light,
-    bool is_peak_hold_enabled,
-    int peak_segments_to_light,
-    const lv_color_t base_on_colors[]
-) {
-    // Clamp values to be within [0, total_segments]
-    current_segments_to_light = (current_segments_to_light < 0)
-                                    ? 0
-                                    : (current_segments_to_light > total_segments)
-                                          ? total_segments
-                                          : current_segments_to_light;
-    peak_segments_to_light = (peak_segments_to_light < 0)
-                                 ? 0
-                                 : (peak_segments_to_light > total_segments)
-                                       ? total_segments
-                                       : peak_segments_to_light;
-
-    // REVOLUTIONARY: Quick bailout if nothing changed for S-meter
-    if (segments_array == ui_SMeterSegments) {
-        if (s_meter_prev_current == current_segments_to_light &&
-            s_meter_prev_peak == peak_segments_to_light &&
-            s_meter_prev_peak_enabled == is_peak_hold_enabled) {
-            return; // Nothing changed - ULTRA-FAST exit
-        }
-        
-        // Update tracking variables
-        s_meter_prev_current = current_segments_to_light;
-        s_meter_prev_peak = peak_segments_to_light;
-        s_meter_prev_peak_enabled = is_peak_hold_enabled;
-    }
-
-    // Calculate target states for all segments
-    int target_states[total_segments];
-    for (int i = 0; i < total_segments; i++) {
-        target_states[i] = 0; // Default off
-        
-        if (segments_array == ui_SMeterSegments && is_peak_hold_enabled && 
-            peak_segments_to_light > 0 && i == (peak_segments_to_light - 1) &&
-            i >= current_segments_to_light) {
-            // Peak segment for S-Meter with peak hold enabled
-            // Only show peak dot if it's ABOVE the current live signal level
-            target_states[i] = 1;
-        } else if (i < current_segments_to_light) {
-            // Part of current live value "bar"
-            target_states[i] = 1;
-        }
-    }
-
-    // Delta-only updates - only process changed segments
-    // Use LV_ANIM_OFF for instant updates (animation causes multiple redraws per segment)
-    if (segments_array == ui_SMeterSegments) {
-        for (int i = 0; i < total_segments; i++) {
-            if (segments_array[i] != NULL && lv_obj_is_valid(segments_array[i])) {
-                // Compare against tracked state to skip redundant LVGL calls
-                if (s_meter_prev_state[i] != target_states[i]) {
-                    lv_bar_set_value(segments_array[i], target_states[i], LV_ANIM_OFF);
-                    s_meter_prev_state[i] = target_states[i];
-                }
-            }
-        }
-    } else if (segments_array == ui_SwrMeterSegments) {
-        // SWR meter - use explicit state tracking like S-meter
-        if (swr_meter_prev_current == current_segments_to_light) {
-            return; // Nothing changed - fast exit
-        }
-        swr_meter_prev_current = current_segments_to_light;
-
-        for (int i = 0; i < total_segments; i++) {
-            if (segments_array[i] != NULL && lv_obj_is_valid(segments_array[i])) {
-                if (swr_meter_prev_state[i] != target_states[i]) {
-                    lv_bar_set_value(segments_array[i], target_states[i], LV_ANIM_OFF);
-                    swr_meter_prev_state[i] = target_states[i];
-                }
-            }
-        }
-    } else if (segments_array == ui_AlcMeterSegments) {
-        // ALC meter - use explicit state tracking like S-meter
-        if (alc_meter_prev_current == current_segments_to_light) {
-            return; // Nothing changed - fast exit
-        }
-        alc_meter_prev_current = current_segments_to_light;
-
-        for (int i = 0; i < total_segments; i++) {
-            if (segments_array[i] != NULL && lv_obj_is_valid(segments_array[i])) {
-                if (alc_meter_prev_state[i] != target_states[i]) {
-                    lv_bar_set_value(segments_array[i], target_states[i], LV_ANIM_OFF);
-                    alc_meter_prev_state[i] = target_states[i];
-                }
-            }
-        }
-    } else {
-        // Generic fallback for unknown meters
-        for (int i = 0; i < total_segments; i++) {
-            if (segments_array[i] != NULL && lv_obj_is_valid(segments_array[i])) {
-                lv_bar_set_value(segments_array[i], target_states[i], LV_ANIM_OFF);
-            }
-        }
-    }
+// The meter widget tracks its own state and invalidates only the segments that flip
+static void update_meter_display(lv_obj_t *meter, int current_segments_to_light,
+                                 bool is_peak_hold_enabled, int peak_segments_to_light) {
+    ui_seg_meter_set_value(meter, current_segments_to_light,
+                           is_peak_hold_enabled ? peak_segments_to_light : 0);
 }
 
 // Peak decay timer callback - automatically reduces peak over time
@@ -569,12 +434,11 @@ static void peak_decay_timer_cb(lv_timer_t *timer) {
                 pep->pep_timestamp = now;
 
                 // Refresh S-meter using PEP as the peak indicator during TX
-                if (lv_obj_is_valid(ui_SMeterSegmentsContainer)) {
-                    update_meter_display(ui_SMeterSegments, 30,
+                if (ui_SMeterSegmentsContainer) {
+                    update_meter_display(ui_SMeterSegmentsContainer,
                                          s_meter_current_value,
                                          g_peak_hold_enabled,
-                                         pep->pep_power_raw,
-                                         s_meter_on_colors);
+                                         pep->pep_power_raw);
                 }
                 // No LV_MSG broadcast needed; UI already refreshed
             }
@@ -595,12 +459,11 @@ static void peak_decay_timer_cb(lv_timer_t *timer) {
 
         s_meter_peak_last_update_time = current_time;
 
-        if (lv_obj_is_valid(ui_SMeterSegmentsContainer)) {
-            update_meter_display(ui_SMeterSegments, 30,
+        if (ui_SMeterSegmentsContainer) {
+            update_meter_display(ui_SMeterSegmentsContainer,
                                  s_meter_current_value,
                                  g_peak_hold_enabled,
-                                 s_meter_peak_value,
-                                 s_meter_on_colors);
+                                 s_meter_peak_value);
         }
     }
 }
@@ -611,20 +474,24 @@ static void update_filter_visibility_from_cat_mode(int mode);
 static bool s_rit_enabled = false;
 static bool s_xit_enabled = false;
 static int s_rit_xit_offset = 0;  // Shared offset in Hz
+static ui_num_label_t s_rit_value_text;
+static ui_num_label_t s_xit_value_text;
+
+// Show the RIT/XIT offset in kHz with two decimals ("+1.25")
+static void set_rit_xit_value_label(lv_obj_t *label, ui_num_label_t *text) {
+    int32_t offset_10hz = (s_rit_xit_offset >= 0 ? s_rit_xit_offset + 5 : s_rit_xit_offset - 5) / 10;
+    ui_num_label_set_fixed(label, text, offset_10hz, 2, true, NULL);
+}
 
 // Core RIT status display update logic
 static void update_rit_status_display(int rit_status) {
     s_rit_enabled = (rit_status != 0);
     ESP_LOGI("RIT_CB", "RIT status: %d, offset: %d", s_rit_enabled, s_rit_xit_offset);
 
-    if (lv_obj_is_valid(ui_RitContainer)) {
+    if (ui_RitContainer) {
         if (s_rit_enabled) {
             lv_obj_remove_flag(ui_RitContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_style_text_color(ui_RitLabel, lv_color_hex(COLOR_ORANGE_VIBRANT), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_text_color(ui_RitValue, lv_color_hex(COLOR_ORANGE_VIBRANT), LV_PART_MAIN | LV_STATE_DEFAULT);
-            static char buf[16];
-            snprintf(buf, sizeof(buf), "%+.2f", (float) s_rit_xit_offset / 1000.0f);
-            lv_label_set_text(ui_RitValue, buf);
+            set_rit_xit_value_label(ui_RitValue, &s_rit_value_text);
         } else {
             lv_obj_add_flag(ui_RitContainer, LV_OBJ_FLAG_HIDDEN);
         }
@@ -642,14 +509,10 @@ static void update_xit_status_display(int xit_status) {
     s_xit_enabled = (xit_status != 0);
     ESP_LOGI("XIT_CB", "XIT status: %d, offset: %d", s_xit_enabled, s_rit_xit_offset);
 
-    if (lv_obj_is_valid(ui_XitContainer)) {
+    if (ui_XitContainer) {
         if (s_xit_enabled) {
             lv_obj_remove_flag(ui_XitContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_style_text_color(ui_XitLabel, lv_color_hex(COLOR_ORANGE), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_text_color(ui_XitValue, lv_color_hex(COLOR_ORANGE), LV_PART_MAIN | LV_STATE_DEFAULT);
-            static char buf[16];
-            snprintf(buf, sizeof(buf), "%+.2f", (float) s_rit_xit_offset / 1000.0f);
-            lv_label_set_text(ui_XitValue, buf);
+            set_rit_xit_value_label(ui_XitValue, &s_xit_value_text);
         } else {
             lv_obj_add_flag(ui_XitContainer, LV_OBJ_FLAG_HIDDEN);
         }
@@ -668,16 +531,12 @@ static void update_rit_xit_freq_display(int freq) {
     ESP_LOGI("RIT_FREQ_CB", "RIT/XIT offset: %d Hz", s_rit_xit_offset);
 
     // Update displayed value if RIT is enabled
-    if (s_rit_enabled && lv_obj_is_valid(ui_RitValue)) {
-        static char buf[16];
-        snprintf(buf, sizeof(buf), "%+.2f", (float) s_rit_xit_offset / 1000.0f);
-        lv_label_set_text(ui_RitValue, buf);
+    if (s_rit_enabled && ui_RitValue) {
+        set_rit_xit_value_label(ui_RitValue, &s_rit_value_text);
     }
     // Update displayed value if XIT is enabled
-    if (s_xit_enabled && lv_obj_is_valid(ui_XitValue)) {
-        static char buf[16];
-        snprintf(buf, sizeof(buf), "%+.2f", (float) s_rit_xit_offset / 1000.0f);
-        lv_label_set_text(ui_XitValue, buf);
+    if (s_xit_enabled && ui_XitValue) {
+        set_rit_xit_value_label(ui_XitValue, &s_xit_value_text);
     }
 }
 
@@ -689,62 +548,83 @@ static void update_rit_freq_observer_cb(lv_observer_t *observer, lv_subject_t *s
 
 // Forward declarations
 static void refresh_vfo_active_display();
-static void format_memory_channel_text(char *buffer, size_t buffer_size, uint16_t channel);
+static void set_memory_channel_label(uint16_t channel);
 static void update_memory_channel_display(const memory_channel_data_t *mem_data);
 
-// Helper function to update display from IF data
-static void update_if_data_display(const kenwood_if_data_t *if_data) {
-    if (!if_data) {
-        return;
-    }
+// IF deliveries, and how often the mask-gated sections (RIT/XIT, memory label)
+// had work to do and skipped it because their fields did not change
+#define IF_STATS_LOG_INTERVAL 400   // Deliveries between log lines (~1 min at the IF poll rate)
+static uint32_t s_if_deliveries = 0;
+static uint32_t s_if_sections_due = 0;
+static uint32_t s_if_sections_skipped = 0;
+
+// Returns whether a section that would redraw has changed fields, counting it as skipped otherwise
+static bool if_section_changed(uint32_t changed, uint32_t section_bits) {
+    s_if_sections_due++;
+    if (changed & section_bits) return true;
+    s_if_sections_skipped++;
+    return false;
+}
 
-    // Debug: log RIT/XIT status from IF data
-    static bool last_rit_logged = false;
-    static bool last_xit_logged = false;
-    if (if_data->rit_on != last_rit_logged || if_data->xit_on != last_xit_logged) {
+// RIT/XIT status and offset from IF data (authoritative source)
+static void update_if_rit_xit(const kenwood_if_data_t *if_data, uint32_t changed) {
+    if (changed & (RADIO_IF_CHANGED_RIT | RADIO_IF_CHANGED_XIT)) {
         ESP_LOGI("IF_DATA_CB", "RIT=%d XIT=%d offset=%d", if_data->rit_on, if_data->xit_on, if_data->rit_xit_frequency);
-        last_rit_logged = if_data->rit_on;
-        last_xit_logged = if_data->xit_on;
     }
 
-    // VFO A frequency: updated via radio_vfo_a_freq_subject observer
-    // to ensure a single, transverter-aware source of truth.
-
-    // --- RIT/XIT Status and Frequency Update from IF data ---
-    // Sync local state variables with IF data (authoritative source)
+    // Sync local state variables with IF data
     s_rit_enabled = if_data->rit_on;
     s_xit_enabled = if_data->xit_on;
     s_rit_xit_offset = if_data->rit_xit_frequency;
 
-    static char rit_xit_buf[16];
-    if (lv_obj_is_valid(ui_RitContainer)) {
+    if (ui_RitContainer) {
         if (s_rit_enabled) {
             lv_obj_remove_flag(ui_RitContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_style_text_color(ui_RitLabel, lv_color_hex(COLOR_ORANGE_VIBRANT), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_text_color(ui_RitValue, lv_color_hex(COLOR_ORANGE_VIBRANT), LV_PART_MAIN | LV_STATE_DEFAULT);
-            snprintf(rit_xit_buf, sizeof(rit_xit_buf), "%+.2f", (float) s_rit_xit_offset / 1000.0f);
-            lv_label_set_text(ui_RitValue, rit_xit_buf);
+            set_rit_xit_value_label(ui_RitValue, &s_rit_value_text);
         } else {
             lv_obj_add_flag(ui_RitContainer, LV_OBJ_FLAG_HIDDEN);
         }
     }
 
-    if (lv_obj_is_valid(ui_XitContainer)) {
+    if (ui_XitContainer) {
         if (s_xit_enabled) {
             lv_obj_remove_flag(ui_XitContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_style_text_color(ui_XitLabel, lv_color_hex(COLOR_ORANGE), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_text_color(ui_XitValue, lv_color_hex(COLOR_ORANGE), LV_PART_MAIN | LV_STATE_DEFAULT);
-            snprintf(rit_xit_buf, sizeof(rit_xit_buf), "%+.2f", (float) s_rit_xit_offset / 1000.0f);
-            lv_label_set_text(ui_XitValue, rit_xit_buf);
+            set_rit_xit_value_label(ui_XitValue, &s_xit_value_text);
         } else {
             lv_obj_add_flag(ui_XitContainer, LV_OBJ_FLAG_HIDDEN);
         }
     }
+}
+
+// Helper function to update display from IF data
+// `changed` holds the RADIO_IF_CHANGED_* fields that differ from the previous delivery.
+// Only the sections that redraw unconditionally are skipped when their fields did not
+// change; the cheap ones compare with the displayed state on every IF and resync it.
+static void update_if_data_display(const kenwood_if_data_t *if_data, uint32_t changed) {
+    if (!if_data) {
+        return;
+    }
+
+    if (++s_if_deliveries % IF_STATS_LOG_INTERVAL == 0) {
+        ESP_LOGI("IF_DATA_CB", "%lu IF updates, %lu of %lu RIT/XIT and memory label redraws skipped (fields unchanged)",
+                 (unsigned long)s_if_deliveries, (unsigned long)s_if_sections_skipped,
+                 (unsigned long)s_if_sections_due);
+    }
+
+    // VFO A frequency: updated via radio_vfo_a_freq_subject observer
+    // to ensure a single, transverter-aware source of truth.
+
+    // --- RIT/XIT Status and Frequency Update from IF data ---
+    if (if_section_changed(changed, RADIO_IF_CHANGED_RIT | RADIO_IF_CHANGED_XIT | RADIO_IF_CHANGED_RIT_XIT_FREQ)) {
+        update_if_rit_xit(if_data, changed);
+    }
 
     // --- TX/RX Label Update ---
     // IF command is the authoritative source for TX/RX state - update timestamp
     s_tx_last_confirmed_time = lv_tick_get();
 
+    // Checked on every IF regardless of the mask: other paths may have moved the
+    // displayed TX state away from an unchanged IF state, and IF resyncs it.
     // Only update UI when TX/RX state actually changes (avoids expensive S-meter clear on every IF)
     bool tx_state_changed = (s_tx_active != if_data->tx_rx);
     if (tx_state_changed) {
@@ -753,19 +633,13 @@ static void update_if_data_display(const kenwood_if_data_t *if_data) {
         }
         s_tx_active = if_data->tx_rx; // Sync with authoritative IF state
 
-        if (lv_obj_is_valid(ui_RxTxLabel)) {
+        if (ui_RxTxLabel) {
             update_rxtx_label_status(if_data->tx_rx);
         }
     }
 
-    // --- Mode Label Update (only when mode changes) ---
-    if (s_current_radio_mode != if_data->mode && lv_obj_is_valid(ui_ModeLabel)) {
-        const char* mode_str = get_mode_string(if_data->mode);
-        lv_label_set_text(ui_ModeLabel, mode_str);
-    }
-
     // --- Split status tracking ---
-    // Update global split status from IF data and refresh UI if changed
+    // Compared on every IF: the split subject also sets it, and IF is the authoritative resync
     if (g_split_mode_active != if_data->split_on) {
         g_split_mode_active = if_data->split_on;
         refresh_vfo_active_display();
@@ -773,22 +647,16 @@ static void update_if_data_display(const kenwood_if_data_t *if_data) {
 
     // --- Memory Channel Label Update (when in memory mode) ---
     // Update M.CH label directly from IF data so it shows immediately
-    if (if_data->function == 2 && if_data->memory_channel >= 0 && if_data->memory_channel <= 999) {
-        if (lv_obj_is_valid(ui_MemoryChannelLabel)) {
-            static int16_t s_last_displayed_channel = -1;
-            if (if_data->memory_channel != s_last_displayed_channel) {
-                char channel_text[16];
-                format_memory_channel_text(channel_text, sizeof(channel_text), (uint16_t)if_data->memory_channel);
-                lv_label_set_text(ui_MemoryChannelLabel, channel_text);
-                s_last_displayed_channel = if_data->memory_channel;
-            }
-        }
+    if (if_data->function == 2 && if_data->memory_channel >= 0 && if_data->memory_channel <= 999 &&
+        if_section_changed(changed, RADIO_IF_CHANGED_MEMORY | RADIO_IF_CHANGED_FUNCTION)) {
+        set_memory_channel_label((uint16_t)if_data->memory_channel);
     }
 
-    // Only update filter visibility when mode actually changes (avoids UART spam)
-    if (s_current_radio_mode != if_data->mode) {
-        s_current_radio_mode = if_data->mode; // Store current mode
-        update_filter_visibility_from_cat_mode(if_data->mode);
+    // --- Mode label and filter visibility (only when mode changes, avoids UART spam) ---
+    // While a touch mode change is unconfirmed the mode is passed on so it can confirm it.
+    // Compared on every IF, as MD answers and local echo also change the displayed mode.
+    if (s_current_radio_mode != if_data->mode || ui_local_echo_is_pending(&s_mode_echo)) {
+        ui_local_echo_report(&s_mode_echo, if_data->mode);
     }
 }
 
@@ -796,12 +664,12 @@ static void update_if_data_display(const kenwood_if_data_t *if_data) {
 static void update_if_data_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
     LV_UNUSED(observer);
     const kenwood_if_data_t *if_data = (const kenwood_if_data_t *)lv_subject_get_pointer(subject);
-    update_if_data_display(if_data);
+    update_if_data_display(if_data, radio_if_data_changed());
 }
 
 static void refresh_filter_display_for_current_mode(); // Forward declaration
 
-// Legacy deferred screen change removed (Screen2 is pre-created)
+// Legacy deferred screen change removed (Screen2 is built by _ui_screen_change when first opened)
 
 // Helper function to update filter display based on CAT-style mode
 static void update_filter_visibility_from_cat_mode(int cat_mode) {
@@ -852,9 +720,9 @@ static void update_filter_visibility_from_cat_mode(int cat_mode) {
             break;
     }
 
-    if (lv_obj_is_valid(ui_FilterUsbContainer)) {
+    if (ui_FilterUsbContainer) {
         _ui_flag_modify(ui_FilterUsbContainer, LV_OBJ_FLAG_HIDDEN, show_usb_filter ? _UI_MODIFY_FLAG_REMOVE : _UI_MODIFY_FLAG_ADD);
-        if (show_usb_filter && lv_obj_is_valid(ui_FilterGlyph)) {
+        if (show_usb_filter && ui_FilterGlyph) {
             switch (cat_mode) {
                 case 1: // LSB
                 case 11: // DATA-LSB
@@ -880,7 +748,7 @@ static void update_filter_visibility_from_cat_mode(int cat_mode) {
             }
         }
     }
-    if (lv_obj_is_valid(ui_CwFilterContainer)) {
+    if (ui_CwFilterContainer) {
         _ui_flag_modify(ui_CwFilterContainer, LV_OBJ_FLAG_HIDDEN, show_cw_filter ? _UI_MODIFY_FLAG_REMOVE : _UI_MODIFY_FLAG_ADD);
     }
     refresh_filter_display_for_current_mode();
@@ -890,7 +758,7 @@ static void update_filter_visibility_from_cat_mode(int cat_mode) {
 // g_current_vfo_function now represents the currently active VFO (RX when receiving, TX when transmitting)
 // g_current_vfo_function: 0=VFO A, 1=VFO B, 2=Memory
 static void refresh_vfo_active_display() {
-    if (!lv_obj_is_valid(ui_VfoAButtonBackground) || !lv_obj_is_valid(ui_VfoBButtonBackground)) {
+    if (!ui_VfoAButtonBackground || !ui_VfoBButtonBackground) {
         return;
     }
 
@@ -923,20 +791,20 @@ static void refresh_vfo_active_display() {
     if (memory_mode_changed) {
         if (is_memory_mode) {
             // Entering memory mode - hide VFO A/B labels, show Memory labels
-            if (lv_obj_is_valid(ui_VfoALabel)) {
+            if (ui_VfoALabel) {
                 lv_obj_add_flag(ui_VfoALabel, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_VfoBLabel)) {
+            if (ui_VfoBLabel) {
                 lv_obj_add_flag(ui_VfoBLabel, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_MemoryLabel)) {
+            if (ui_MemoryLabel) {
                 lv_obj_add_state(ui_MemoryLabel, LV_STATE_CHECKED);
                 lv_obj_remove_flag(ui_MemoryLabel, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_MemoryChannelLabel)) {
+            if (ui_MemoryChannelLabel) {
                 lv_obj_remove_flag(ui_MemoryChannelLabel, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_VfoBValue)) {
+            if (ui_VfoBValue) {
                 lv_obj_remove_flag(ui_VfoBValue, LV_OBJ_FLAG_HIDDEN);
                 // Immediately show memory name (or placeholder) when entering memory mode
                 // This clears the old VFO B frequency text
@@ -954,29 +822,29 @@ static void refresh_vfo_active_display() {
                 }
             }
             // Hide VFO A/B backgrounds in memory mode
-            if (lv_obj_is_valid(ui_VfoAButtonBackground)) {
+            if (ui_VfoAButtonBackground) {
                 lv_obj_add_flag(ui_VfoAButtonBackground, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_VfoBButtonBackground)) {
+            if (ui_VfoBButtonBackground) {
                 lv_obj_add_flag(ui_VfoBButtonBackground, LV_OBJ_FLAG_HIDDEN);
             }
             // Hide split button in memory mode
-            if (lv_obj_is_valid(ui_SplitButton)) {
+            if (ui_SplitButton) {
                 lv_obj_add_flag(ui_SplitButton, LV_OBJ_FLAG_HIDDEN);
             }
         } else {
             // Exiting memory mode - show VFO A/B labels, hide Memory labels
-            if (lv_obj_is_valid(ui_VfoALabel)) {
+            if (ui_VfoALabel) {
                 lv_obj_remove_flag(ui_VfoALabel, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_VfoBLabel)) {
+            if (ui_VfoBLabel) {
                 lv_obj_remove_flag(ui_VfoBLabel, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_MemoryLabel)) {
+            if (ui_MemoryLabel) {
                 lv_obj_remove_state(ui_MemoryLabel, LV_STATE_CHECKED);
                 lv_obj_add_flag(ui_MemoryLabel, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_MemoryChannelLabel)) {
+            if (ui_MemoryChannelLabel) {
                 lv_obj_add_flag(ui_MemoryChannelLabel, LV_OBJ_FLAG_HIDDEN);
             }
         }
@@ -986,33 +854,33 @@ static void refresh_vfo_active_display() {
     // Handle split mode and VFO highlight changes (only in VFO mode)
     if (!is_memory_mode && (split_mode_changed || vfo_highlight_changed || memory_mode_changed)) {
         if (g_split_mode_active) {
-            if (lv_obj_is_valid(ui_SplitButton)) {
+            if (ui_SplitButton) {
                 lv_obj_add_state(ui_SplitButton, LV_STATE_CHECKED);
                 lv_obj_remove_flag(ui_SplitButton, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_VfoBValue)) {
+            if (ui_VfoBValue) {
                 lv_obj_remove_flag(ui_VfoBValue, LV_OBJ_FLAG_HIDDEN);
             }
         } else {
-            if (lv_obj_is_valid(ui_SplitButton)) {
+            if (ui_SplitButton) {
                 lv_obj_remove_state(ui_SplitButton, LV_STATE_CHECKED);
                 lv_obj_add_flag(ui_SplitButton, LV_OBJ_FLAG_HIDDEN);
             }
-            if (lv_obj_is_valid(ui_VfoBValue)) {
+            if (ui_VfoBValue) {
                 lv_obj_add_flag(ui_VfoBValue, LV_OBJ_FLAG_HIDDEN);
             }
         }
         s_last_split_mode = g_split_mode_active;
 
         // Update VFO backgrounds
-        if (lv_obj_is_valid(ui_VfoAButtonBackground)) {
+        if (ui_VfoAButtonBackground) {
             if (vfo_highlight == 0) {
                 lv_obj_remove_flag(ui_VfoAButtonBackground, LV_OBJ_FLAG_HIDDEN);
             } else {
                 lv_obj_add_flag(ui_VfoAButtonBackground, LV_OBJ_FLAG_HIDDEN);
             }
         }
-        if (lv_obj_is_valid(ui_VfoBButtonBackground)) {
+        if (ui_VfoBButtonBackground) {
             if (vfo_highlight == 1) {
                 lv_obj_remove_flag(ui_VfoBButtonBackground, LV_OBJ_FLAG_HIDDEN);
             } else {
@@ -1040,51 +908,39 @@ static void update_split_observer_cb(lv_observer_t *observer, lv_subject_t *subj
 }
 
 
+// Boot timing: the first radio frequency is logged once the refresh that
+// draws it has been flushed. Pairs with the boot splash's first-pixel log.
+static int64_t s_first_freq_us = 0;
+
+static void first_freq_refr_ready_cb(lv_event_t *e) {
+    int64_t now_us = esp_timer_get_time();
+    ESP_LOGI("UI_Screen1", "First live frequency on screen %lu ms after app start (%lu ms after the radio reported it)",
+             (unsigned long)(now_us / 1000), (unsigned long)((now_us - s_first_freq_us) / 1000));
+    // Needed once per boot; LVGL allows removing a callback while it runs
+    LV_UNUSED(e);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), first_freq_refr_ready_cb, NULL);
+}
+
 // Helper function to update VFO display from consolidated update
 static void update_vfo_consolidated_display(const vfo_update_t *update) {
     if (!update) return;
 
-    // Initialize shared frequency cache once
-    init_freq_cache();
-
     // Static state for change detection
     static uint32_t s_prev_active_freq = 0xFFFFFFFF;
     static uint32_t s_prev_inactive_freq = 0xFFFFFFFF;
     static int8_t s_prev_active_vfo = -1;
 
     // ---- Update Active VFO Frequency (main display) ----
+    // Echoes of drag-tuning writes lag the target and are held back until the last one arrives
     if (update->active_freq != s_prev_active_freq) {
-        static char mhz_buf[12];
-        static uint32_t prev_mhz = 0xFFFFFFFF;
-        static uint32_t prev_khz = 0xFFFFFFFF;
-        static uint32_t prev_hz = 0xFFFFFFFF;
-
         uint32_t new_freq = update->active_freq;
         if (new_freq >= 30000 && new_freq <= 300000000) {
-            if (lv_obj_is_valid(ui_VfoAFreqMHz) && lv_obj_is_valid(ui_VfoAFreqKHz) && lv_obj_is_valid(ui_VfoAFreqHz)) {
-                uint32_t mhz_val = new_freq / 1000000;
-                uint32_t khz_val = (new_freq % 1000000) / 1000;
-                uint32_t hz_val = new_freq % 1000;
-
-                if (mhz_val != prev_mhz) {
-                    if (mhz_val < 1000) {
-                        lv_label_set_text_static(ui_VfoAFreqMHz, g_mhz_cache[mhz_val]);
-                    } else {
-                        snprintf(mhz_buf, sizeof(mhz_buf), "%lu", mhz_val);
-                        lv_label_set_text_static(ui_VfoAFreqMHz, mhz_buf);
-                    }
-                    prev_mhz = mhz_val;
-                }
-                if (khz_val != prev_khz && khz_val < 1000) {
-                    lv_label_set_text_static(ui_VfoAFreqKHz, g_khz_cache[khz_val]);
-                    prev_khz = khz_val;
-                }
-                if (hz_val != prev_hz && hz_val < 1000) {
-                    lv_label_set_text_static(ui_VfoAFreqHz, g_hz_cache[hz_val]);
-                    prev_hz = hz_val;
-                }
-            }
+            ui_local_echo_report(&s_freq_echo, (int32_t)new_freq);
             s_prev_active_freq = new_freq;
+            if (s_first_freq_us == 0) {
+                s_first_freq_us = esp_timer_get_time();
+                lv_display_add_event_cb(lv_display_get_default(), first_freq_refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+            }
         }
     }
 
@@ -1094,7 +950,7 @@ static void update_vfo_consolidated_display(const vfo_update_t *update) {
         static char inactive_buf[32];
         uint32_t new_freq = update->inactive_freq;
 
-        if (new_freq >= 30000 && new_freq <= 300000000 && lv_obj_is_valid(ui_VfoBValue)) {
+        if (new_freq >= 30000 && new_freq <= 300000000 && ui_VfoBValue) {
             uint32_t mhz_val = new_freq / 1000000;
             uint32_t khz_val = (new_freq % 1000000) / 1000;
             uint32_t hz_val = new_freq % 1000;
@@ -1123,16 +979,8 @@ static void update_vfo_consolidated_observer_cb(lv_observer_t *observer, lv_subj
 // Shared helper to update the top segmented frequency display from either VFO
 // Set force=true to bypass throttle/equality checks (e.g., on VFO function toggle)
 void set_top_segmented_frequency(uint32_t new_freq, bool force) {
-    // Validate segmented UI objects exist
-    if (!lv_obj_is_valid(ui_VfoAFreqContainer) || !lv_obj_is_valid(ui_VfoAFreqMHz) ||
-        !lv_obj_is_valid(ui_VfoAFreqKHz) || !lv_obj_is_valid(ui_VfoAFreqHz)) {
-        return;
-    }
+    if (!ui_VfoAFreqDisplay) return;
 
-    static char mhz_buf[12];
-    static uint32_t prev_mhz = 0xFFFFFFFF;
-    static uint32_t prev_khz = 0xFFFFFFFF;
-    static uint32_t prev_hz = 0xFFFFFFFF;
     static uint32_t displayed_freq = 0xFFFFFFFF;
     static uint32_t last_ui_update_time = 0;
 
@@ -1144,56 +992,18 @@ void set_top_segmented_frequency(uint32_t new_freq, bool force) {
     uint32_t current_time = lv_tick_get();
     if (!force && lv_tick_elaps(last_ui_update_time) < VFO_UPDATE_THROTTLE_MS) return;
 
-    uint32_t new_mhz = new_freq / 1000000;
-    uint32_t new_khz = (new_freq % 1000000) / 1000;
-    uint32_t new_actual_hz = new_freq % 1000;
-
-    bool updated = false;
-    bool mhz_valid = lv_obj_is_valid(ui_VfoAFreqMHz);
-    bool khz_valid = lv_obj_is_valid(ui_VfoAFreqKHz);
-    bool hz_valid = lv_obj_is_valid(ui_VfoAFreqHz);
-
-    if (new_mhz != prev_mhz && mhz_valid && new_mhz < 1000) {
-        lv_label_set_text_static(ui_VfoAFreqMHz, g_mhz_cache[new_mhz]);
-        prev_mhz = new_mhz;
-        updated = true;
-    } else if (new_mhz != prev_mhz && mhz_valid && new_mhz >= 1000) {
-        snprintf(mhz_buf, sizeof(mhz_buf), "%lu", new_mhz);
-        lv_label_set_text_static(ui_VfoAFreqMHz, mhz_buf);
-        prev_mhz = new_mhz;
-        updated = true;
-    }
-
-    if (new_khz != prev_khz && new_khz < 1000 && khz_valid) {
-        lv_label_set_text_static(ui_VfoAFreqKHz, g_khz_cache[new_khz]);
-        prev_khz = new_khz;
-        updated = true;
-    }
-
-    if (new_actual_hz != prev_hz && new_actual_hz < 1000 && hz_valid) {
-        lv_label_set_text_static(ui_VfoAFreqHz, g_hz_cache[new_actual_hz]);
-        prev_hz = new_actual_hz;
-        updated = true;
-    }
-
+    bool updated = ui_freq_display_set_freq(ui_VfoAFreqDisplay, new_freq);
     if (updated || force) {
         displayed_freq = new_freq;
         last_ui_update_time = current_time;
-
-        static uint32_t last_invalidation_time = 0;
-        uint32_t time_since_last_invalidation = current_time - last_invalidation_time;
-        bool major_change = (new_mhz != prev_mhz);
-        if (force || (time_since_last_invalidation >= 10 || major_change)) {
-            if (lv_obj_is_valid(ui_VfoAFreqContainer)) lv_obj_invalidate(ui_VfoAFreqContainer);
-            last_invalidation_time = current_time;
-        }
+        if (force) lv_obj_invalidate(ui_VfoAFreqDisplay);
     }
 }
 
 // Core S-meter display update logic
 static void update_s_meter_display(int sm_current_value) {
     // Ensure UI elements are initialized
-    if (!lv_obj_is_valid(ui_SMeterSegmentsContainer) || !lv_obj_is_valid(ui_SwrMeterSegmentsContainer)) {
+    if (!ui_SMeterSegmentsContainer || !ui_SwrMeterSegmentsContainer) {
         return;
     }
 
@@ -1242,7 +1052,7 @@ static void update_s_meter_display(int sm_current_value) {
         s_meter_peak_value = final_sm_value;
     }
 
-    if (lv_obj_is_valid(ui_SMeterSegmentsContainer)) {
+    if (ui_SMeterSegmentsContainer) {
         int peak_value_to_use = s_meter_peak_value;
         if (cat_get_transmit_status()) {
             pep_data_t* pep_data = pep_get_data();
@@ -1250,7 +1060,7 @@ static void update_s_meter_display(int sm_current_value) {
                 peak_value_to_use = pep_data->pep_power_raw;
             }
         }
-        update_meter_display(ui_SMeterSegments, 30, final_sm_value, g_peak_hold_enabled, peak_value_to_use, s_meter_on_colors);
+        update_meter_display(ui_SMeterSegmentsContainer, final_sm_value, g_peak_hold_enabled, peak_value_to_use);
     }
 }
 
@@ -1270,7 +1080,7 @@ static void update_swr_meter_display(int swr_new_value) {
     }
     last_update_time_obs = lv_tick_get();
 
-    if (!lv_obj_is_valid(ui_SwrMeterSegmentsContainer)) {
+    if (!ui_SwrMeterSegmentsContainer) {
         return;
     }
 
@@ -1295,8 +1105,8 @@ static void update_swr_meter_display(int swr_new_value) {
         swr_display_value = 1;
     }
 
-    if (lv_obj_is_valid(ui_SwrMeterSegmentsContainer)) {
-        update_meter_display(ui_SwrMeterSegments, 30, swr_display_value, false, 0, swr_meter_on_colors);
+    if (ui_SwrMeterSegmentsContainer) {
+        update_meter_display(ui_SwrMeterSegmentsContainer, swr_display_value, false, 0);
     }
 }
 
@@ -1310,7 +1120,7 @@ void update_filter_visibility_from_dropdown_idx(uint16_t uint16);
 
 // Core mode display update logic
 static void update_mode_display(int cat_mode) {
-    if (!lv_obj_is_valid(ui_ModeLabel)) {
+    if (!ui_ModeLabel) {
         return;
     }
 
@@ -1329,7 +1139,7 @@ static void update_mode_display(int cat_mode) {
 // LVGL 9 observer callback for mode updates
 static void update_mode_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
     LV_UNUSED(observer);
-    update_mode_display(lv_subject_get_int(subject));
+    ui_local_echo_report(&s_mode_echo, lv_subject_get_int(subject));
 }
 
 // Helper function to update filter display based on dropdown index
@@ -1354,9 +1164,9 @@ void update_filter_visibility_from_dropdown_idx(uint16_t dropdown_idx) {
             break;
     }
 
-    if (lv_obj_is_valid(ui_FilterUsbContainer)) {
+    if (ui_FilterUsbContainer) {
         _ui_flag_modify(ui_FilterUsbContainer, LV_OBJ_FLAG_HIDDEN, show_usb_filter ? _UI_MODIFY_FLAG_REMOVE : _UI_MODIFY_FLAG_ADD);
-        if (show_usb_filter && lv_obj_is_valid(ui_FilterGlyph)) {
+        if (show_usb_filter && ui_FilterGlyph) {
             // Dropdown options: "USB\nLSB\nCW\nDATA\nFM\nAM"
             // Index 0: USB, 1: LSB, 2: CW, 3: DATA, 4: FM, 5: AM
             switch (dropdown_idx) {
@@ -1377,15 +1187,18 @@ void update_filter_visibility_from_dropdown_idx(uint16_t dropdown_idx) {
             }
         }
     }
-    if (lv_obj_is_valid(ui_CwFilterContainer)) {
+    if (ui_CwFilterContainer) {
         _ui_flag_modify(ui_CwFilterContainer, LV_OBJ_FLAG_HIDDEN, show_cw_filter ? _UI_MODIFY_FLAG_REMOVE : _UI_MODIFY_FLAG_ADD);
     }
     refresh_filter_display_for_current_mode();
 }
 
 // Helper function to refresh the displayed filter values (High/Low or CW Width)
+static ui_num_label_t s_high_cut_text;
+static ui_num_label_t s_low_cut_text;
+static ui_num_label_t s_cw_filter_width_text;
+
 static void refresh_filter_display_for_current_mode() {
-    static char buf[10]; // Buffer for formatting numbers
 
     // Check current mode
     bool is_cw_mode = (s_current_radio_mode == 3 || s_current_radio_mode == 7);
@@ -1394,18 +1207,15 @@ static void refresh_filter_display_for_current_mode() {
              s_current_radio_mode, s_current_high_cut_hz, s_current_low_cut_hz, s_current_cw_filter_width_hz);
 
     if (is_cw_mode) {
-        if (lv_obj_is_valid(ui_CwFilterWidth)) {
-            snprintf(buf, sizeof(buf), "%u", s_current_cw_filter_width_hz);
-            lv_label_set_text(ui_CwFilterWidth, buf);
+        if (ui_CwFilterWidth) {
+            ui_num_label_set_int(ui_CwFilterWidth, &s_cw_filter_width_text, NULL, s_current_cw_filter_width_hz, 0, NULL);
         }
     } else { // USB, LSB, AM, FM, DATA modes
-        if (lv_obj_is_valid(ui_High)) {
-            snprintf(buf, sizeof(buf), "%u", s_current_high_cut_hz);
-            lv_label_set_text(ui_High, buf);
+        if (ui_High) {
+            ui_num_label_set_int(ui_High, &s_high_cut_text, NULL, s_current_high_cut_hz, 0, NULL);
         }
-        if (lv_obj_is_valid(ui_Low)) {
-            snprintf(buf, sizeof(buf), "%u", s_current_low_cut_hz);
-            lv_label_set_text(ui_Low, buf);
+        if (ui_Low) {
+            ui_num_label_set_int(ui_Low, &s_low_cut_text, NULL, s_current_low_cut_hz, 0, NULL);
         }
     }
 }
@@ -1420,7 +1230,7 @@ static void update_alc_meter_display(int alc_new_value) {
     }
     last_update_time_obs = lv_tick_get();
 
-    if (!lv_obj_is_valid(ui_AlcMeterSegmentsContainer)) {
+    if (!ui_AlcMeterSegmentsContainer) {
         return;
     }
 
@@ -1439,15 +1249,13 @@ static void update_alc_meter_display(int alc_new_value) {
     // In dual mode, map 30 dots to 15 segments (each segment = 2 dots)
     // In single mode, use full 30 segments
     int display_value = alc_display_value;
-    int segment_count = 30;
 
     if (s_current_meter_layout == METER_LAYOUT_DUAL_ALC_COMP) {
         display_value = alc_display_value / 2; // Map 0-30 dots to 0-15 segments
-        segment_count = 15;
     }
 
-    if (lv_obj_is_valid(ui_AlcMeterSegmentsContainer)) {
-        update_meter_display(ui_AlcMeterSegments, segment_count, display_value, false, 0, alc_meter_on_colors);
+    if (ui_AlcMeterSegmentsContainer) {
+        update_meter_display(ui_AlcMeterSegmentsContainer, display_value, false, 0);
     }
 }
 
@@ -1465,7 +1273,7 @@ static void update_comp_meter_display(int comp_new_value) {
         return;
     }
 
-    if (!lv_obj_is_valid(ui_CompMeterSegmentsContainer)) {
+    if (!ui_CompMeterSegmentsContainer) {
         return;
     }
 
@@ -1484,8 +1292,8 @@ static void update_comp_meter_display(int comp_new_value) {
     // Map 0-30 dots from radio to 0-15 segments (each segment = 2 dots)
     int display_value = comp_display_value / 2;
 
-    if (lv_obj_is_valid(ui_CompMeterSegmentsContainer)) {
-        update_meter_display(ui_CompMeterSegments, 15, display_value, false, 0, comp_meter_on_colors);
+    if (ui_CompMeterSegmentsContainer) {
+        update_meter_display(ui_CompMeterSegmentsContainer, display_value, false, 0);
     }
 }
 
@@ -1503,7 +1311,7 @@ static void update_comp_meter_observer_cb(lv_observer_t *observer, lv_subject_t
 
 // Core AGC display update logic
 static void update_agc_display(int agc_val) {
-    if (!lv_obj_is_valid(ui_AgcLabel)) {
+    if (!ui_AgcLabel) {
         return;
     }
     switch (agc_val) {
@@ -1532,7 +1340,7 @@ static void update_agc_observer_cb(lv_observer_t *observer, lv_subject_t *subjec
 
 // Core Notch display update logic
 static void update_notch_display(int mode) {
-    if (!lv_obj_is_valid(ui_NotchLabel)) {
+    if (!ui_NotchLabel) {
         return;
     }
     switch ((notch_mode_t)mode) {
@@ -1562,7 +1370,7 @@ static void update_notch_observer_cb(lv_observer_t *observer, lv_subject_t *subj
 
 // Core ATT display update logic
 static void update_att_display(int att_status) {
-    if (!lv_obj_is_valid(ui_AttButton)) {
+    if (!ui_AttButton) {
         return;
     }
     bool att_on = (att_status == 1);
@@ -1576,12 +1384,12 @@ static void update_att_display(int att_status) {
 // LVGL 9 observer callback for ATT updates
 static void update_att_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
     LV_UNUSED(observer);
-    update_att_display(lv_subject_get_int(subject));
+    ui_local_echo_report(&s_att_echo, lv_subject_get_int(subject));
 }
 
 // Core NB display update logic
 static void update_nb_display(int mode) {
-    if (!lv_obj_is_valid(ui_NbButton)) {
+    if (!ui_NbButton) {
         return;
     }
     ESP_LOGI("UI_Screen1", "NB status callback: received mode=%d", mode);
@@ -1601,7 +1409,7 @@ static void update_nb_display(int mode) {
 // LVGL 9 observer callback for NB updates
 static void update_nb_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
     LV_UNUSED(observer);
-    update_nb_display(lv_subject_get_int(subject));
+    ui_local_echo_report(&s_nb_echo, lv_subject_get_int(subject));
 }
 
 // Core DATA mode display update logic
@@ -1610,7 +1418,7 @@ static void update_data_mode_display(int data_mode) {
     ESP_LOGI("UI_Screen1", "DATA mode status updated: %s", g_data_mode_active ? "ON" : "OFF");
 
     // Show or hide the DATA mode label based on status
-    if (lv_obj_is_valid(ui_DataModeLabel)) {
+    if (ui_DataModeLabel) {
         if (g_data_mode_active) {
             lv_obj_remove_flag(ui_DataModeLabel, LV_OBJ_FLAG_HIDDEN);
         } else {
@@ -1627,7 +1435,7 @@ static void update_data_mode_observer_cb(lv_observer_t *observer, lv_subject_t *
 
 // Core NR display update logic
 static void update_nr_display(int mode) {
-    if (!lv_obj_is_valid(ui_NrButton)) {
+    if (!ui_NrButton) {
         return;
     }
 
@@ -1646,12 +1454,12 @@ static void update_nr_display(int mode) {
 // LVGL 9 observer callback for NR updates
 static void update_nr_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
     LV_UNUSED(observer);
-    update_nr_display(lv_subject_get_int(subject));
+    ui_local_echo_report(&s_nr_echo, lv_subject_get_int(subject));
 }
 
 // Core Preamp display update logic
 static void update_preamp_display(int preamp_val) {
-    if (!lv_obj_is_valid(ui_PreAmpButton) || !lv_obj_is_valid(ui_PreAmpButtonLabel)) {
+    if (!ui_PreAmpButton || !ui_PreAmpButtonLabel) {
         return;
     }
     if (preamp_val == 0) {
@@ -1665,7 +1473,7 @@ static void update_preamp_display(int preamp_val) {
 // LVGL 9 observer callback for Preamp updates
 static void update_preamp_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
     LV_UNUSED(observer);
-    update_preamp_display(lv_subject_get_int(subject));
+    ui_local_echo_report(&s_preamp_echo, lv_subject_get_int(subject));
 }
 
 // Core Peak Hold status display update logic
@@ -1687,7 +1495,11 @@ static void update_peak_hold_status_display(bool enabled) {
         s_meter_peak_value = 0;
         s_meter_current_value = 0;
         s_meter_peak_last_update_time = 0;
-        reset_s_meter_state_tracking();
+        // Drop the peak marker now rather than on the next S-meter sample
+        if (ui_SMeterSegmentsContainer) {
+            ui_seg_meter_set_value(ui_SMeterSegmentsContainer,
+                                   ui_seg_meter_get_level(ui_SMeterSegmentsContainer), 0);
+        }
 
         if (peak_decay_timer != NULL) {
             lv_timer_del(peak_decay_timer);
@@ -1721,10 +1533,8 @@ static void update_peak_hold_duration_observer_cb(lv_observer_t *observer, lv_su
 
 // Core S-Meter Averaging update logic
 static void update_smeter_averaging_display(bool new_averaging_state) {
-    // If the state changed, reset S-meter tracking to prevent stuck segments
     if (s_meter_averaging_enabled != new_averaging_state) {
-        reset_s_meter_state_tracking();
-        ESP_LOGI("UI_Screen1", "S-meter state reset due to averaging toggle");
+        ESP_LOGI("UI_Screen1", "S-meter averaging %s", new_averaging_state ? "enabled" : "disabled");
     }
 
     s_meter_averaging_enabled = new_averaging_state;
@@ -1739,7 +1549,7 @@ static void update_smeter_averaging_observer_cb(lv_observer_t *observer, lv_subj
 
 // Core XVTR label visibility update logic
 static void update_xvtr_label_visibility(void) {
-    if (!lv_obj_is_valid(ui_XvtrLabel)) {
+    if (!ui_XvtrLabel) {
         return;
     }
 
@@ -1784,7 +1594,7 @@ static void update_transverter_enabled_observer_cb(lv_observer_t *observer, lv_s
 // Core TX status display update logic
 // Note: IF command is the authoritative source - this handles faster TX/RX notifications
 static void update_tx_status_display(int tx_status) {
-    if (!lv_obj_is_valid(ui_RxTxLabel)) {
+    if (!ui_RxTxLabel) {
         return;
     }
     bool new_tx_state = (tx_status != 0);
@@ -1805,10 +1615,6 @@ static void update_tx_status_display(int tx_status) {
             // Use explicit force_clear functions for reliable segment clearing
             force_clear_swr_meter_segments();
             force_clear_alc_meter_segments();
-            // Reset S-meter cached segment counts so the next reading draws correctly
-            s_meter_prev_current = -1;
-            s_meter_prev_peak = -1;
-            s_meter_prev_peak_enabled = false;
         }
     }
 
@@ -1829,7 +1635,7 @@ static void update_tx_status_observer_cb(lv_observer_t *observer, lv_subject_t *
 
 // Core AF gain display update logic
 static void update_af_gain_display(int af_gain_value) {
-    if (!lv_obj_is_valid(ui_AfGainBar)) {
+    if (!ui_AfGainBar) {
         return;
     }
 
@@ -1850,7 +1656,7 @@ static void update_af_gain_observer_cb(lv_observer_t *observer, lv_subject_t *su
 
 // Core RF gain display update logic
 static void update_rf_gain_display(int rf_gain_value) {
-    if (!lv_obj_is_valid(ui_RfGainBar)) {
+    if (!ui_RfGainBar) {
         return;
     }
 
@@ -1871,7 +1677,7 @@ static void update_rf_gain_observer_cb(lv_observer_t *observer, lv_subject_t *su
 
 // Core Processor (PROC) status display update logic
 static void update_proc_display(int proc_status) {
-    if (!lv_obj_is_valid(ui_ProcButton)) {
+    if (!ui_ProcButton) {
         return;
     }
 
@@ -1908,14 +1714,14 @@ static void update_proc_display(int proc_status) {
 // LVGL 9 observer callback for Processor status updates
 static void update_proc_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
     LV_UNUSED(observer);
-    update_proc_display(lv_subject_get_int(subject));
+    ui_local_echo_report(&s_proc_echo, lv_subject_get_int(subject));
 }
 
 // ui_at_status_t is now defined in cat_shared_types.h
 
 // Core Antenna Select display update logic
 static void update_antenna_select_display(int antenna_select) {
-    if (!lv_obj_is_valid(ui_Ant1Label) || !lv_obj_is_valid(ui_Ant2Label)) {
+    if (!ui_Ant1Label || !ui_Ant2Label) {
         return;
     }
 
@@ -1937,24 +1743,24 @@ static void update_antenna_select_observer_cb(lv_observer_t *observer, lv_subjec
     update_antenna_select_display(lv_subject_get_int(subject));
 }
 
-// Helper function to format memory channel number according to TS-590SG conventions
+// Show a memory channel number according to TS-590SG conventions
 // Channels 0-99: "M.CH 00" to "M.CH 99"
 // Channels 100-109: "M.CH P00" to "M.CH P09" (Program Memory)
 // Channels 110-119: "M.CH E00" to "M.CH E09" (Emergency Memory)
 // Channels 120-299: "M.CH 120" to "M.CH 299"
-static void format_memory_channel_text(char *buffer, size_t buffer_size, uint16_t channel) {
+static void set_memory_channel_label(uint16_t channel) {
+    static ui_num_label_t s_memory_channel_text;
+    if (!ui_MemoryChannelLabel) return;
+
     if (channel >= 100 && channel <= 109) {
         // Program Memory: P00-P09
-        snprintf(buffer, buffer_size, "M.CH P%02d", channel - 100);
+        ui_num_label_set_int(ui_MemoryChannelLabel, &s_memory_channel_text, "M.CH P", channel - 100, 2, NULL);
     } else if (channel >= 110 && channel <= 119) {
         // Emergency Memory: E00-E09
-        snprintf(buffer, buffer_size, "M.CH E%02d", channel - 110);
-    } else if (channel < 100) {
-        // Standard channels: 00-99
-        snprintf(buffer, buffer_size, "M.CH %02d", channel);
+        ui_num_label_set_int(ui_MemoryChannelLabel, &s_memory_channel_text, "M.CH E", channel - 110, 2, NULL);
     } else {
-        // Extended channels: 120-299
-        snprintf(buffer, buffer_size, "M.CH %d", channel);
+        // Standard channels 00-99 (two digits), extended channels 120-299
+        ui_num_label_set_int(ui_MemoryChannelLabel, &s_memory_channel_text, "M.CH ", channel, 2, NULL);
     }
 }
 
@@ -1970,15 +1776,11 @@ static void update_memory_channel_display(const memory_channel_data_t *mem_data)
              mem_data->channel, mem_data->name);
 
     // Update Memory channel label (e.g., "M.CH 15", "M.CH P05", "M.CH E07")
-    if (lv_obj_is_valid(ui_MemoryChannelLabel)) {
-        char channel_text[16];
-        format_memory_channel_text(channel_text, sizeof(channel_text), mem_data->channel);
-        lv_label_set_text(ui_MemoryChannelLabel, channel_text);
-    }
+    set_memory_channel_label(mem_data->channel);
 
     // Update VFO B value area with memory channel name
     // Note: This function is only called when in memory mode, so we don't need to check g_current_vfo_function
-    if (lv_obj_is_valid(ui_VfoBValue)) {
+    if (ui_VfoBValue) {
         // Display memory name if non-empty, otherwise show channel number with proper formatting
         if (mem_data->name[0] != '\0') {
             ESP_LOGI("UI", "Setting memory name: '%s'", mem_data->name);
@@ -2009,7 +1811,7 @@ static void update_memory_channel_observer_cb(lv_observer_t *observer, lv_subjec
 // Helper function to update AT status display
 // AT status bitmask: bit0=rx_at_in, bit1=tx_at_in, bit2=tuning_in_progress
 static void update_at_status_display(bool rx_at_in, bool tx_at_in, bool tuning_in_progress) {
-    if (!lv_obj_is_valid(ui_AtTuneButton) || !lv_obj_is_valid(ui_AtTuneButtonLabel)) {
+    if (!ui_AtTuneButton || !ui_AtTuneButtonLabel) {
         return; // Early exit if UI elements don't exist or are invalid
     }
 
@@ -2027,7 +1829,7 @@ static void update_at_status_display(bool rx_at_in, bool tx_at_in, bool tuning_i
         // lv_obj_remove_state(ui_AtTuneButton, LV_STATE_USER_1);
 
         // TODO reconsider this
-        if (lv_obj_is_valid(ui_AtTuneButton)) { // Ensure button is valid before changing state
+        if (ui_AtTuneButton) { // Ensure button is valid before changing state
             if (rx_at_in) {
                 // lv_label_set_text(ui_AtTuneButtonLabel, "RX<AT>");
                 lv_obj_add_state(ui_AtTuneButton, LV_STATE_CHECKED);
@@ -2044,7 +1846,7 @@ static void update_at_status_display(bool rx_at_in, bool tx_at_in, bool tuning_i
                     // lv_label_set_text(ui_AtTuneButtonLabel, "AT>TX");
                     lv_obj_add_state(ui_AtTuneButton, LV_STATE_CHECKED);
                 } else { // This 'else' branch is logically unreachable given the preceding conditions.
-                    if (lv_obj_is_valid(ui_AtTuneButtonLabel)) {
+                    if (ui_AtTuneButtonLabel) {
                         //lv_label_set_text(ui_AtTuneButtonLabel, "AT");
                         lv_obj_remove_state(ui_AtTuneButton, LV_STATE_DEFAULT);
                     }
@@ -2053,7 +1855,7 @@ static void update_at_status_display(bool rx_at_in, bool tx_at_in, bool tuning_i
                 }
             } else { // Neither rx_at_in nor tx_at_in is true
                  lv_obj_remove_state(ui_AtTuneButton, LV_STATE_CHECKED); // Clear the checked state
-                 if (lv_obj_is_valid(ui_AtTuneButtonLabel)) {
+                 if (ui_AtTuneButtonLabel) {
                     //lv_label_set_text(ui_AtTuneButtonLabel, "AT"); // Optionally reset label text
                  }
             }
@@ -2075,10 +1877,8 @@ static void update_cw_filter_width_display(uint16_t new_width) {
     s_current_cw_filter_width_hz = new_width;
     ESP_LOGD("UI_Screen1", "FW Updated: CW Width %u Hz (cached)", s_current_cw_filter_width_hz);
 
-    if (lv_obj_is_valid(ui_CwFilterWidth)) {
-        static char buf[6]; // Max "9999" + null
-        snprintf(buf, sizeof(buf), "%u", s_current_cw_filter_width_hz);
-        lv_label_set_text(ui_CwFilterWidth, buf);
+    if (ui_CwFilterWidth) {
+        ui_num_label_set_int(ui_CwFilterWidth, &s_cw_filter_width_text, NULL, s_current_cw_filter_width_hz, 0, NULL);
     }
 }
 
@@ -2250,7 +2050,7 @@ static void update_xi_data_observer_cb(lv_observer_t *observer, lv_subject_t *su
 static void ui_cat_activity_check_timer_cb(lv_timer_t *timer) {
     LV_UNUSED(timer);
 
-    if (!lv_obj_is_valid(ui_CatConnectedLabel)) {
+    if (!ui_CatConnectedLabel) {
         return;
     }
 
@@ -2271,7 +2071,6 @@ static void ui_cat_activity_check_timer_cb(lv_timer_t *timer) {
                 ESP_LOGI("UI_Screen1", "CAT Inactivity timeout (UI timer). Label set to Inactive.");
                 // Clear all meters when CAT connection is lost to prevent stuck segments
                 force_clear_all_meters();
-                reset_s_meter_state_tracking();
             }
         }
     }
@@ -2312,12 +2111,12 @@ void ui_event_Switch1(lv_event_t *e) {
     lv_obj_t *target = (lv_obj_t*)lv_event_get_target(e);
 
     if (event_code == LV_EVENT_VALUE_CHANGED && lv_obj_has_state(target, LV_STATE_CHECKED)) {
-        if (lv_obj_is_valid(ui_VfoAButtonBackground)) _ui_flag_modify(ui_VfoAButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
-        if (lv_obj_is_valid(ui_VfoBButtonBackground)) _ui_flag_modify(ui_VfoBButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
+        if (ui_VfoAButtonBackground) _ui_flag_modify(ui_VfoAButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
+        if (ui_VfoBButtonBackground) _ui_flag_modify(ui_VfoBButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
     }
     if (event_code == LV_EVENT_VALUE_CHANGED && !lv_obj_has_state(target, LV_STATE_CHECKED)) {
-        if (lv_obj_is_valid(ui_VfoAButtonBackground)) _ui_flag_modify(ui_VfoAButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
-        if (lv_obj_is_valid(ui_VfoBButtonBackground)) _ui_flag_modify(ui_VfoBButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
+        if (ui_VfoAButtonBackground) _ui_flag_modify(ui_VfoAButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
+        if (ui_VfoBButtonBackground) _ui_flag_modify(ui_VfoBButtonBackground, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
     }
 }
 
@@ -2374,63 +2173,23 @@ void ui_event_RxTxLabel(lv_event_t *e) {
 }
 
 // Force clear all S-meter segments to ensure clean visual state
-// Uses delta tracking to only clear segments that are actually on
 static void force_clear_s_meter_segments(void) {
-    if (!lv_obj_is_valid(ui_SMeterSegmentsContainer)) return;
-
-    int cleared = 0;
-    for (int i = 0; i < 30; i++) {
-        // Only clear if tracking says it's on - avoids redundant LVGL calls
-        if (s_meter_prev_state[i] != 0 &&
-            ui_SMeterSegments[i] != NULL && lv_obj_is_valid(ui_SMeterSegments[i])) {
-            lv_bar_set_value(ui_SMeterSegments[i], 0, LV_ANIM_OFF);
-            s_meter_prev_state[i] = 0;
-            cleared++;
-        }
-    }
-    if (cleared > 0) {
-        ESP_LOGD("UI_Screen1", "Cleared %d S-meter segments", cleared);
-    }
+    if (!ui_SMeterSegmentsContainer) return;
+    ui_seg_meter_set_value(ui_SMeterSegmentsContainer, 0, 0);
 }
 
-// Force clear all SWR meter segments using delta tracking
+// Force clear all SWR meter segments
 static void force_clear_swr_meter_segments(void) {
-    if (!lv_obj_is_valid(ui_SwrMeterSegmentsContainer)) return;
-
-    int cleared = 0;
-    for (int i = 0; i < 30; i++) {
-        if (swr_meter_prev_state[i] != 0 &&
-            ui_SwrMeterSegments[i] != NULL && lv_obj_is_valid(ui_SwrMeterSegments[i])) {
-            lv_bar_set_value(ui_SwrMeterSegments[i], 0, LV_ANIM_OFF);
-            swr_meter_prev_state[i] = 0;
-            cleared++;
-        }
-    }
-    swr_meter_prev_current = 0;
     swr_display_value = 0;
-    if (cleared > 0) {
-        ESP_LOGD("UI_Screen1", "Cleared %d SWR meter segments", cleared);
-    }
+    if (!ui_SwrMeterSegmentsContainer) return;
+    ui_seg_meter_set_value(ui_SwrMeterSegmentsContainer, 0, 0);
 }
 
-// Force clear all ALC meter segments using delta tracking
+// Force clear all ALC meter segments
 static void force_clear_alc_meter_segments(void) {
-    if (!lv_obj_is_valid(ui_AlcMeterSegmentsContainer)) return;
-
-    int cleared = 0;
-    for (int i = 0; i < 30; i++) {
-        if (alc_meter_prev_state[i] != 0 &&
-            ui_AlcMeterSegments[i] != NULL && lv_obj_is_valid(ui_AlcMeterSegments[i])) {
-            lv_bar_set_value(ui_AlcMeterSegments[i], 0, LV_ANIM_OFF);
-            alc_meter_prev_state[i] = 0;
-            cleared++;
-        }
-    }
-    alc_meter_prev_current = 0;
     alc_display_value = 0;
-    if (cleared > 0) {
-        ESP_LOGD("UI_Screen1", "Cleared %d ALC meter segments", cleared);
-    }
+    if (!ui_AlcMeterSegmentsContainer) return;
+    ui_seg_meter_set_value(ui_AlcMeterSegmentsContainer, 0, 0);
 }
 
 // Force clear all meters (S-meter, SWR, ALC)
@@ -2440,39 +2199,6 @@ static void force_clear_all_meters(void) {
     force_clear_alc_meter_segments();
 }
 
-// Debug function to verify S-meter state consistency
-static void debug_s_meter_state(const char *context) {
-    if (!lv_obj_is_valid(ui_SMeterSegmentsContainer)) return;
-    
-    int segments_on = 0;
-    int tracking_on = 0;
-    
-    for (int i = 0; i < 30; i++) {
-        if (ui_SMeterSegments[i] != NULL && lv_obj_is_valid(ui_SMeterSegments[i])) {
-            int visual_state = lv_bar_get_value(ui_SMeterSegments[i]);
-            if (visual_state == 1) segments_on++;
-        }
-        if (s_meter_prev_state[i] == 1) tracking_on++;
-    }
-    
-    if (segments_on != tracking_on) {
-        ESP_LOGW("UI_Screen1", "%s: State mismatch - Visual:%d vs Tracking:%d", 
-                context, segments_on, tracking_on);
-    } else {
-        ESP_LOGD("UI_Screen1", "%s: State consistent - %d segments on", context, segments_on);
-    }
-}
-
-// Reset S-meter state tracking for clean slate
-static void reset_s_meter_state_tracking(void) {
-    for (int i = 0; i < 30; i++) {
-        s_meter_prev_state[i] = 0;
-    }
-    s_meter_prev_current = -1;
-    s_meter_prev_peak = -1;
-    s_meter_prev_peak_enabled = false;
-}
-
 // Function to update RX/TX label and related UI elements
 static void update_rxtx_label_status(bool is_transmitting) {
     s_meter_peak_value = 0; // Reset peak value whenever TX/RX state changes
@@ -2484,9 +2210,7 @@ static void update_rxtx_label_status(bool is_transmitting) {
         max_sm_tx_value = 30;  // Reset to default for next TX session
     }
 
-    // Clear segments BEFORE resetting tracking - force_clear uses tracking to know which segments need clearing
     force_clear_s_meter_segments();
-    reset_s_meter_state_tracking(); // Reset delta tracking for clean state
 
     // Check if we need to switch meter layout mode based on TX/RX and PROC states
     meter_layout_mode_t target_mode = METER_LAYOUT_SINGLE_ALC;
@@ -2501,54 +2225,104 @@ static void update_rxtx_label_status(bool is_transmitting) {
         switch_meter_layout_mode(target_mode);
     }
 
-    if (lv_obj_is_valid(ui_RxTxLabel)) {
+    if (ui_RxTxLabel) {
         if (is_transmitting) {
             lv_label_set_text(ui_RxTxLabel, "TX");
             lv_obj_add_state(ui_RxTxLabel, LV_STATE_CHECKED);
 
             // Hide S-unit label container, show Power scale label
-            if (lv_obj_is_valid(ui_SMeterLabelsContainer))
+            if (ui_SMeterLabelsContainer)
                 _ui_flag_modify(ui_SMeterLabelsContainer, LV_OBJ_FLAG_HIDDEN,
                                 _UI_MODIFY_FLAG_ADD);
 
 
-            if (lv_obj_is_valid(ui_PwrLabelsContainer)) _ui_flag_modify(ui_PwrLabelsContainer, LV_OBJ_FLAG_HIDDEN,
+            if (ui_PwrLabelsContainer) _ui_flag_modify(ui_PwrLabelsContainer, LV_OBJ_FLAG_HIDDEN,
                                                                         _UI_MODIFY_FLAG_REMOVE); // MODIFIED
 
-            if (lv_obj_is_valid(ui_SMeterLabel)) _ui_flag_modify(ui_SMeterLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
-            if (lv_obj_is_valid(ui_PwrLabel)) _ui_flag_modify(ui_PwrLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
+            if (ui_SMeterLabel) _ui_flag_modify(ui_SMeterLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
+            if (ui_PwrLabel) _ui_flag_modify(ui_PwrLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
 
             // Force invalidate the area to ensure proper redraw - REMOVED as _ui_flag_modify handles invalidation
-            // if (lv_obj_is_valid(ui_SMeterLabelsContainer)) lv_obj_invalidate(ui_SMeterLabelsContainer);
-            // if (lv_obj_is_valid(ui_PwrLabelsContainer)) lv_obj_invalidate(ui_PwrLabelsContainer);
+            // if (ui_SMeterLabelsContainer) lv_obj_invalidate(ui_SMeterLabelsContainer);
+            // if (ui_PwrLabelsContainer) lv_obj_invalidate(ui_PwrLabelsContainer);
         } else {
             // Receiving
             lv_label_set_text(ui_RxTxLabel, "RX");
             lv_obj_remove_state(ui_RxTxLabel, LV_STATE_CHECKED);
 
             // Show S-unit label container, hide Power scale label
-            if (lv_obj_is_valid(ui_SMeterLabelsContainer))
+            if (ui_SMeterLabelsContainer)
                 _ui_flag_modify(ui_SMeterLabelsContainer, LV_OBJ_FLAG_HIDDEN,
                                 _UI_MODIFY_FLAG_REMOVE);
-            if (lv_obj_is_valid(ui_PwrLabelsContainer)) _ui_flag_modify(ui_PwrLabelsContainer, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
+            if (ui_PwrLabelsContainer) _ui_flag_modify(ui_PwrLabelsContainer, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
             // MODIFIED
 
-            if (lv_obj_is_valid(ui_SMeterLabel)) _ui_flag_modify(ui_SMeterLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
-            if (lv_obj_is_valid(ui_PwrLabel)) _ui_flag_modify(ui_PwrLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
+            if (ui_SMeterLabel) _ui_flag_modify(ui_SMeterLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_REMOVE);
+            if (ui_PwrLabel) _ui_flag_modify(ui_PwrLabel, LV_OBJ_FLAG_HIDDEN, _UI_MODIFY_FLAG_ADD);
 
             // Force invalidate the area to ensure proper redraw - REMOVED as _ui_flag_modify handles invalidation
-            // if (lv_obj_is_valid(ui_SMeterLabelsContainer)) lv_obj_invalidate(ui_SMeterLabelsContainer);
-            // if (lv_obj_is_valid(ui_PwrLabelsContainer)) lv_obj_invalidate(ui_PwrLabelsContainer);
+            // if (ui_SMeterLabelsContainer) lv_obj_invalidate(ui_SMeterLabelsContainer);
+            // if (ui_PwrLabelsContainer) lv_obj_invalidate(ui_PwrLabelsContainer);
         }
     }
 }
 
+// Local echo display callbacks
+static void echo_apply_mode(int32_t value) { update_mode_display((int)value); }
+static void echo_apply_nr(int32_t value) { update_nr_display((int)value); }
+static void echo_apply_nb(int32_t value) { update_nb_display((int)value); }
+static void echo_apply_preamp(int32_t value) { update_preamp_display((int)value); }
+static void echo_apply_att(int32_t value) { update_att_display((int)value); }
+static void echo_apply_proc(int32_t value) { update_proc_display((int)value); }
+
+static void echo_apply_freq(int32_t value) {
+    // While dragging the display shows the drag target instead; tune_end() catches up
+    if (ui_VfoAFreqDisplay && !ui_tune_is_active()) {
+        // Only the digit cells that changed are invalidated
+        ui_freq_display_set_freq(ui_VfoAFreqDisplay, (uint32_t)value);
+    }
+}
+
+// Drag tuning on the main frequency display (active VFO only, not in memory mode or TX)
+static uint32_t tune_get_freq(void) {
+    if (!ui_VfoAFreqDisplay || s_tx_active || (g_current_vfo_function != 0 && g_current_vfo_function != 1)) {
+        return 0;
+    }
+    return ui_freq_display_get_freq(ui_VfoAFreqDisplay);
+}
+
+static void tune_show(uint32_t freq_hz) {
+    if (ui_VfoAFreqDisplay) {
+        ui_freq_display_set_freq(ui_VfoAFreqDisplay, freq_hz);
+    }
+}
+
+static void tune_write(uint32_t freq_hz) {
+    char cmd[20];
+    uint64_t radio_hz = compute_radio_frequency_from_display(freq_hz);
+    snprintf(cmd, sizeof(cmd), "%s%011llu;", g_current_vfo_function == 1 ? "FB" : "FA", (unsigned long long)radio_hz);
+    uart_write_message(cmd);
+    ui_local_echo_request(&s_freq_echo, (int32_t)freq_hz);
+}
+
+// Reports skipped during the session (e.g. the knob turned meanwhile) are drawn now
+static void tune_end(void) {
+    ui_local_echo_reapply(&s_freq_echo);
+}
+
+static const ui_tune_ops_t s_tune_ops = {tune_get_freq, tune_show, tune_write, tune_end};
+
+// Show a mode the user just sent to the radio (MD command) until the radio confirms it
+void ui_screen1_request_mode(int cat_mode) {
+    ui_local_echo_request(&s_mode_echo, cat_mode);
+}
+
 void ui_event_PreAmpButton(lv_event_t *e) {
     lv_event_code_t event_code = lv_event_get_code(e);
 
     if (event_code == LV_EVENT_VALUE_CHANGED) {
         // Add safety check to prevent commands during initialization
-        if (!lv_obj_is_valid(ui_PreAmpButton)) return;
+        if (!ui_PreAmpButton) return;
         
         // Check the actual current state after the change
         bool is_checked = lv_obj_has_state(ui_PreAmpButton, LV_STATE_CHECKED);
@@ -2559,6 +2333,8 @@ void ui_event_PreAmpButton(lv_event_t *e) {
         } else {
             uart_write_message("PA0;");
         }
+        uart_write_message("PA;");
+        ui_local_echo_request(&s_preamp_echo, is_checked ? 1 : 0);
     }
 }
 
@@ -2566,7 +2342,7 @@ void ui_event_AttButton(lv_event_t *e) {
     lv_event_code_t event_code = lv_event_get_code(e);
 
     if (event_code == LV_EVENT_VALUE_CHANGED) {
-        if (!lv_obj_is_valid(ui_AttButton)) return;
+        if (!ui_AttButton) return;
         
         bool is_checked = lv_obj_has_state(ui_AttButton, LV_STATE_CHECKED);
         ESP_LOGI("UI_ATT", "ATT button state changed to: %s", is_checked ? "ON" : "OFF");
@@ -2576,6 +2352,8 @@ void ui_event_AttButton(lv_event_t *e) {
         } else {
             uart_write_message("RA00;");
         }
+        uart_write_message("RA;");
+        ui_local_echo_request(&s_att_echo, is_checked ? 1 : 0);
     }
 }
 
@@ -2591,7 +2369,7 @@ void ui_event_ProcButton(lv_event_t *e) {
     lv_event_code_t event_code = lv_event_get_code(e);
 
     if (event_code == LV_EVENT_VALUE_CHANGED) {
-        if (!lv_obj_is_valid(ui_ProcButton)) return;
+        if (!ui_ProcButton) return;
         
         bool is_checked = lv_obj_has_state(ui_ProcButton, LV_STATE_CHECKED);
         ESP_LOGI("UI_PROC", "PROC button state changed to: %s", is_checked ? "ON" : "OFF");
@@ -2601,6 +2379,8 @@ void ui_event_ProcButton(lv_event_t *e) {
         } else {
             uart_write_message("PR0;");
         }
+        uart_write_message("PR;");
+        ui_local_echo_request(&s_proc_echo, is_checked ? 1 : 0);
     }
 }
 
@@ -2673,29 +2453,20 @@ void ui_event_NrButton(lv_event_t *e) {
     lv_event_code_t event_code = lv_event_get_code(e);
 
     if (event_code == LV_EVENT_CLICKED) {
-        if (!lv_obj_is_valid(ui_NrButton)) return;
+        if (!ui_NrButton) return;
         
         // Cycle through NR modes: 0=OFF, 1=NR1, 2=NR2
-        nr_mode = (nr_mode + 1) % 3;
+        int next_mode = (nr_mode + 1) % 3;
         
         const char* mode_names[] = {"OFF", "NR1", "NR2"};
-        ESP_LOGI("UI_NR", "NR button clicked, cycling to: %s", mode_names[nr_mode]);
+        ESP_LOGI("UI_NR", "NR button clicked, cycling to: %s", mode_names[next_mode]);
         
-        // Update button appearance and label
-        if (nr_mode == 0) {
-            lv_obj_remove_state(ui_NrButton, LV_STATE_CHECKED);
-            uart_write_message("NR0;");
-        } else {
-            lv_obj_add_state(ui_NrButton, LV_STATE_CHECKED);
-            if (nr_mode == 1) {
-                uart_write_message("NR1;");
-            } else { // nr_mode == 2
-                uart_write_message("NR2;");
-            }
-        }
+        const char* nr_commands[] = {"NR0;", "NR1;", "NR2;"};
+        uart_write_message(nr_commands[next_mode]);
+        uart_write_message("NR;");
         
-        // Update button label to show current mode
-        update_nr_button_label();
+        // Button state and label follow immediately
+        ui_local_echo_request(&s_nr_echo, next_mode);
     }
 }
 
@@ -2703,31 +2474,20 @@ void ui_event_NbButton(lv_event_t *e) {
     lv_event_code_t event_code = lv_event_get_code(e);
 
     if (event_code == LV_EVENT_CLICKED) {
-        if (!lv_obj_is_valid(ui_NbButton)) return;
+        if (!ui_NbButton) return;
         
         // Cycle through NB modes: 0=OFF, 1=NB1, 2=NB2, 3=NB3
-        nb_mode = (nb_mode + 1) % 4;
+        int next_mode = (nb_mode + 1) % 4;
         
         const char* mode_names[] = {"OFF", "NB1", "NB2", "NB3"};
-        ESP_LOGI("UI_NB", "NB button clicked, cycling to: %s", mode_names[nb_mode]);
+        ESP_LOGI("UI_NB", "NB button clicked, cycling to: %s", mode_names[next_mode]);
         
-        // Update button appearance
-        if (nb_mode == 0) {
-            lv_obj_remove_state(ui_NbButton, LV_STATE_CHECKED);
-            uart_write_message("NB0;");
-        } else {
-            lv_obj_add_state(ui_NbButton, LV_STATE_CHECKED);
-            if (nb_mode == 1) {
-                uart_write_message("NB1;");
-            } else if (nb_mode == 2) {
-                uart_write_message("NB2;");
-            } else { // nb_mode == 3
-                uart_write_message("NB3;");
-            }
-        }
+        const char* nb_commands[] = {"NB0;", "NB1;", "NB2;", "NB3;"};
+        uart_write_message(nb_commands[next_mode]);
+        uart_write_message("NB;");
         
-        // Update button label to show current mode
-        update_nb_button_label();
+        // Button state and label follow immediately
+        ui_local_echo_request(&s_nb_echo, next_mode);
     }
 }
 
@@ -2737,7 +2497,7 @@ void ui_event_DebugMode(lv_event_t *e) {
     if (event_code == LV_EVENT_CLICKED) {
         // Obsolete SWR bar manipulation removed.
         _ui_screen_change(&ui_Screen2, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen2_screen_init);
-        // Screen2 is pre-created; direct screen change is used
+        // Builds Screen2 if it does not exist yet (see CONFIG_UI_SETTINGS_* policy)
     }
 }
 
@@ -2745,7 +2505,7 @@ void ui_event_SettingsButton(lv_event_t *e) {
     lv_event_code_t event_code = lv_event_get_code(e);
     if (event_code == LV_EVENT_CLICKED) {
         _ui_screen_change(&ui_Screen2, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen2_screen_init);
-        // Screen2 is pre-created; direct screen change is used
+        // Builds Screen2 if it does not exist yet (see CONFIG_UI_SETTINGS_* policy)
     }
 }
 
@@ -2786,69 +2546,38 @@ static void switch_meter_layout_mode(meter_layout_mode_t new_mode) {
         const lv_coord_t single_meter_width = (dual_segment_count * dual_segment_width) +
                                                ((dual_segment_count - 1) * bar_gap_px); // 88px
 
-        // Destroy existing 30-segment ALC meter
-        if (ui_AlcMeterSegmentsContainer && lv_obj_is_valid(ui_AlcMeterSegmentsContainer)) {
-            for (int i = 0; i < 30; i++) {
-                if (ui_AlcMeterSegments[i] && lv_obj_is_valid(ui_AlcMeterSegments[i])) {
-                    lv_obj_delete(ui_AlcMeterSegments[i]);
-                    ui_AlcMeterSegments[i] = NULL;
-                }
-            }
-        }
-
-        // Reset ALC display value and state tracking for fresh start
+        // Reset ALC display value for fresh start
         alc_display_value = 0;
-        alc_meter_prev_current = -1; // Force redraw on next update
-        for (int i = 0; i < 30; i++) {
-            alc_meter_prev_state[i] = 0;
-        }
-
-        // Recreate ALC container with 15 segments
-        if (ui_AlcMeterSegmentsContainer && lv_obj_is_valid(ui_AlcMeterSegmentsContainer)) {
-            lv_obj_set_width(ui_AlcMeterSegmentsContainer, single_meter_width);
 
+        // Switch ALC meter to 15 segments
+        if (ui_AlcMeterSegmentsContainer) {
             // Initialize ALC color zones for 15 segments (0-10 blue, 11-14 red)
             for (int k = 0; k < 15; k++) {
                 alc_meter_on_colors[k] = (k < 11) ? lv_color_hex(COLOR_BLUE_METER_S_UNITS)
                                                    : lv_color_hex(COLOR_RED_METER_HIGH);
             }
 
-            create_meter_segments(ui_AlcMeterSegmentsContainer, ui_AlcMeterSegments, dual_segment_count,
-                                  dual_segment_width, bar_height, alc_meter_on_colors);
+            ui_seg_meter_set_layout(ui_AlcMeterSegmentsContainer, dual_segment_count, dual_segment_width);
+            ui_seg_meter_set_colors(ui_AlcMeterSegmentsContainer, alc_meter_on_colors, dual_segment_count);
 
             // Reposition ALC meter to left side (40px label + meter starts at common_meter_area_x_pos)
             lv_obj_set_pos(ui_AlcMeterSegmentsContainer, common_meter_area_x_pos, alc_meter_y_pos);
         }
 
         // Move ALC label closer to meter
-        if (ui_AlcLabel && lv_obj_is_valid(ui_AlcLabel)) {
+        if (ui_AlcLabel) {
             lv_obj_set_x(ui_AlcLabel, ui_sx(-374)); // Keep original X
         }
 
-        // Delete existing COMP segments before creating new ones (handles mode switch cycling)
-        for (int i = 0; i < 15; i++) {
-            if (ui_CompMeterSegments[i] && lv_obj_is_valid(ui_CompMeterSegments[i])) {
-                lv_obj_delete(ui_CompMeterSegments[i]);
-                ui_CompMeterSegments[i] = NULL;
+        // Create COMP meter if it doesn't exist
+        if (!ui_CompMeterSegmentsContainer) {
+            ui_CompMeterSegmentsContainer = ui_seg_meter_create(ui_Screen1, dual_segment_count, dual_segment_width,
+                                                                bar_height, bar_gap_px);
+            if (ui_CompMeterSegmentsContainer) {
+                lv_obj_set_align(ui_CompMeterSegmentsContainer, LV_ALIGN_TOP_LEFT);
             }
         }
 
-        // Create COMP meter container if it doesn't exist
-        if (!ui_CompMeterSegmentsContainer || !lv_obj_is_valid(ui_CompMeterSegmentsContainer)) {
-            ui_CompMeterSegmentsContainer = lv_obj_create(ui_Screen1);
-            lv_obj_remove_style_all(ui_CompMeterSegmentsContainer);
-            lv_obj_add_flag(ui_CompMeterSegmentsContainer, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
-            lv_obj_set_height(ui_CompMeterSegmentsContainer, LV_SIZE_CONTENT);
-            lv_obj_set_align(ui_CompMeterSegmentsContainer, LV_ALIGN_TOP_LEFT);
-            lv_obj_set_layout(ui_CompMeterSegmentsContainer, LV_LAYOUT_FLEX);
-            lv_obj_set_flex_flow(ui_CompMeterSegmentsContainer, LV_FLEX_FLOW_ROW);
-            lv_obj_set_flex_align(ui_CompMeterSegmentsContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER,
-                                  LV_FLEX_ALIGN_CENTER);
-            lv_obj_set_style_pad_column(ui_CompMeterSegmentsContainer, bar_gap_px, 0);
-            lv_obj_set_style_pad_left(ui_CompMeterSegmentsContainer, 0, 0);
-            lv_obj_set_style_pad_right(ui_CompMeterSegmentsContainer, 0, 0);
-        }
-
         // Initialize COMP color zones (0-10 blue, 11-14 red)
         for (int k = 0; k < 15; k++) {
             comp_meter_on_colors[k] = (k < 11) ? lv_color_hex(COLOR_BLUE_METER_S_UNITS)
@@ -2858,10 +2587,11 @@ static void switch_meter_layout_mode(meter_layout_mode_t new_mode) {
         // Reset COMP display value for fresh start
         comp_display_value = 0;
 
-        // Create COMP meter segments
-        lv_obj_set_width(ui_CompMeterSegmentsContainer, single_meter_width);
-        create_meter_segments(ui_CompMeterSegmentsContainer, ui_CompMeterSegments, dual_segment_count,
-                              dual_segment_width, bar_height, comp_meter_on_colors);
+        // Clear COMP meter and apply color zones
+        if (ui_CompMeterSegmentsContainer) {
+            ui_seg_meter_set_colors(ui_CompMeterSegmentsContainer, comp_meter_on_colors, dual_segment_count);
+            ui_seg_meter_set_value(ui_CompMeterSegmentsContainer, 0, 0);
+        }
 
         // Position COMP meter to right of ALC: ALC_end + gap + COMP_label_space
         // ALC starts at common_meter_area_x_pos, is 88px wide
@@ -2871,7 +2601,7 @@ static void switch_meter_layout_mode(meter_layout_mode_t new_mode) {
         lv_obj_remove_flag(ui_CompMeterSegmentsContainer, LV_OBJ_FLAG_HIDDEN);
 
         // Create COMP label if it doesn't exist
-        if (!ui_CompLabel || !lv_obj_is_valid(ui_CompLabel)) {
+        if (!ui_CompLabel) {
             ui_CompLabel = lv_label_create(ui_Screen1);
             lv_obj_set_width(ui_CompLabel, LV_SIZE_CONTENT);
             lv_obj_set_height(ui_CompLabel, LV_SIZE_CONTENT);
@@ -2894,49 +2624,33 @@ static void switch_meter_layout_mode(meter_layout_mode_t new_mode) {
         const lv_coord_t single_segment_count = 30;
 
         // Hide COMP meter and label
-        if (ui_CompMeterSegmentsContainer && lv_obj_is_valid(ui_CompMeterSegmentsContainer)) {
+        if (ui_CompMeterSegmentsContainer) {
             lv_obj_add_flag(ui_CompMeterSegmentsContainer, LV_OBJ_FLAG_HIDDEN);
         }
-        if (ui_CompLabel && lv_obj_is_valid(ui_CompLabel)) {
+        if (ui_CompLabel) {
             lv_obj_add_flag(ui_CompLabel, LV_OBJ_FLAG_HIDDEN);
         }
 
-        // Destroy existing 15-segment ALC meter
-        if (ui_AlcMeterSegmentsContainer && lv_obj_is_valid(ui_AlcMeterSegmentsContainer)) {
-            for (int i = 0; i < 30; i++) { // Clear full array
-                if (ui_AlcMeterSegments[i] && lv_obj_is_valid(ui_AlcMeterSegments[i])) {
-                    lv_obj_delete(ui_AlcMeterSegments[i]);
-                    ui_AlcMeterSegments[i] = NULL;
-                }
-            }
-        }
-
-        // Reset ALC display value and state tracking for fresh start
+        // Reset ALC display value for fresh start
         alc_display_value = 0;
-        alc_meter_prev_current = -1; // Force redraw on next update
-        for (int i = 0; i < 30; i++) {
-            alc_meter_prev_state[i] = 0;
-        }
-
-        // Recreate ALC container with 30 segments
-        if (ui_AlcMeterSegmentsContainer && lv_obj_is_valid(ui_AlcMeterSegmentsContainer)) {
-            lv_obj_set_width(ui_AlcMeterSegmentsContainer, fixed_meter_area_width);
 
+        // Switch ALC meter back to 30 segments
+        if (ui_AlcMeterSegmentsContainer) {
             // Initialize ALC color zones for 30 segments (0-20 blue, 21-29 red)
             for (int k = 0; k < 30; k++) {
                 alc_meter_on_colors[k] = (k < 21) ? lv_color_hex(COLOR_BLUE_METER_S_UNITS)
                                                    : lv_color_hex(COLOR_RED_METER_HIGH);
             }
 
-            create_meter_segments(ui_AlcMeterSegmentsContainer, ui_AlcMeterSegments, single_segment_count,
-                                  single_segment_width, bar_height, alc_meter_on_colors);
+            ui_seg_meter_set_layout(ui_AlcMeterSegmentsContainer, single_segment_count, single_segment_width);
+            ui_seg_meter_set_colors(ui_AlcMeterSegmentsContainer, alc_meter_on_colors, single_segment_count);
 
             // Restore original ALC position
             lv_obj_set_pos(ui_AlcMeterSegmentsContainer, common_meter_area_x_pos, alc_meter_y_pos);
         }
 
         // Restore ALC label position
-        if (ui_AlcLabel && lv_obj_is_valid(ui_AlcLabel)) {
+        if (ui_AlcLabel) {
             lv_obj_set_x(ui_AlcLabel, ui_sx(-374)); // Original position
         }
     }
@@ -2946,6 +2660,35 @@ static void switch_meter_layout_mode(meter_layout_mode_t new_mode) {
     ESP_LOGI("METER_LAYOUT", "Layout switch complete, debounce for %dms", METER_MODE_SWITCH_DEBOUNCE_MS);
 }
 
+// Widgets referenced from subject observers and update paths. Tracking clears
+// each pointer when its widget is deleted, so those paths check for NULL
+// instead of calling lv_obj_is_valid(), which walks the whole object tree.
+static lv_obj_t **const s_tracked_widgets[] = {
+    // Screen
+    &ui_Screen1,
+    // Meters
+    &ui_SMeterSegmentsContainer, &ui_SwrMeterSegmentsContainer, &ui_AlcMeterSegmentsContainer,
+    &ui_CompMeterSegmentsContainer, &ui_SMeterLabelsContainer, &ui_SMeterLabel,
+    &ui_PwrLabelsContainer, &ui_PwrLabel, &ui_AlcLabel, &ui_CompLabel,
+    // VFO, mode and TX state
+    &ui_VfoAFreqDisplay, &ui_VfoBValue, &ui_VfoAButtonBackground, &ui_VfoBButtonBackground,
+    &ui_VfoALabel, &ui_VfoBLabel, &ui_MemoryLabel, &ui_MemoryChannelLabel, &ui_SplitButton,
+    &ui_ModeLabel, &ui_DataModeLabel, &ui_RxTxLabel,
+    // RIT / XIT
+    &ui_RitContainer, &ui_RitValue, &ui_XitContainer, &ui_XitValue,
+    // IF filter
+    &ui_IfFilterALabel, &ui_IfFilterBLabel, &ui_FilterUsbContainer, &ui_FilterGlyph, &ui_High,
+    &ui_Low, &ui_CwFilterContainer, &ui_CwFilterWidth,
+    // Gains, AGC, antenna
+    &ui_AfGainBar, &ui_RfGainBar, &ui_AgcLabel, &ui_NotchLabel, &ui_XvtrLabel, &ui_Ant1Label,
+    &ui_Ant2Label,
+    // Function buttons
+    &ui_PreAmpButton, &ui_PreAmpButtonLabel, &ui_AttButton, &ui_ProcButton, &ui_NrButton,
+    &ui_NrButtonLabel, &ui_NbButton, &ui_NbButtonLabel, &ui_AtTuneButton, &ui_AtTuneButtonLabel,
+    // Status
+    &ui_CatConnectedLabel, &ui_UtcTime,
+};
+
 void ui_Screen1_screen_init(void) {
     // Initialize peak decay interval and S-meter averaging from settings
     user_settings_t settings;
@@ -2990,22 +2733,14 @@ void ui_Screen1_screen_init(void) {
     lv_obj_remove_flag(ui_SignalPanel, LV_OBJ_FLAG_SCROLLABLE); /// Flags
     lv_obj_set_style_radius(ui_SignalPanel, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    // Create container for S-Meter segments (meter_parent)
-    ui_SMeterSegmentsContainer = lv_obj_create(ui_Screen1);
-    lv_obj_remove_style_all(ui_SMeterSegmentsContainer); // Remove default container styling
-    lv_obj_add_flag(ui_SMeterSegmentsContainer, LV_OBJ_FLAG_OVERFLOW_VISIBLE); // Allow drawing outside bounds
-    // Width and position will be set with common_meter_area_width and common_meter_area_x_pos
-    lv_obj_set_height(ui_SMeterSegmentsContainer, LV_SIZE_CONTENT); // Height based on bar_height
-    lv_obj_set_align(ui_SMeterSegmentsContainer, LV_ALIGN_TOP_LEFT);
-    lv_obj_set_layout(ui_SMeterSegmentsContainer, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(ui_SMeterSegmentsContainer, LV_FLEX_FLOW_ROW);
-    // Align bars to the start, with a gap between them
-    lv_obj_set_flex_align(ui_SMeterSegmentsContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     lv_coord_t bar_gap_px = ui_sx(2); // Gap between individual bars
-    lv_obj_set_style_pad_column(ui_SMeterSegmentsContainer, bar_gap_px, 0);
-    lv_obj_set_style_pad_left(ui_SMeterSegmentsContainer, 0, 0);
-    lv_obj_set_style_pad_right(ui_SMeterSegmentsContainer, 0, 0);
+    lv_coord_t bar_width = ui_sx(7); // Increased width
+    lv_coord_t bar_height = ui_sy(22); // Increased height
 
+    // S-Meter: one object draws all 30 segments and the peak marker
+    // Position will be set with common_meter_area_x_pos
+    ui_SMeterSegmentsContainer = ui_seg_meter_create(ui_Screen1, 30, bar_width, bar_height, bar_gap_px);
+    lv_obj_set_align(ui_SMeterSegmentsContainer, LV_ALIGN_TOP_LEFT);
 
     // Define "on" colors for 30 segments
     // Moved s_meter_on_colors to file scope, initialized here
@@ -3019,9 +2754,6 @@ void ui_Screen1_screen_init(void) {
         }
     }
 
-    lv_coord_t bar_width = ui_sx(7); // Increased width
-    lv_coord_t bar_height = ui_sy(22); // Increased height
-
     // Initialize grid column descriptors with scaled bar_width
     for (int i = 0; i < 30; i++) grid_cols_30_scaled[i] = bar_width;
     grid_cols_30_scaled[30] = LV_GRID_TEMPLATE_LAST;
@@ -3065,40 +2797,13 @@ void ui_Screen1_screen_init(void) {
     lv_obj_set_style_text_align(ui_SwrMeterLabel, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_font(ui_SwrMeterLabel, ui_meter_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    // Create container for SWR Meter segments
-    ui_SwrMeterSegmentsContainer = lv_obj_create(ui_Screen1);
-    lv_obj_remove_style_all(ui_SwrMeterSegmentsContainer);
-    lv_obj_add_flag(ui_SwrMeterSegmentsContainer, LV_OBJ_FLAG_OVERFLOW_VISIBLE); // Allow drawing outside bounds
-    lv_obj_set_height(ui_SwrMeterSegmentsContainer, LV_SIZE_CONTENT); // Height based on segments
-    // Y position for SWR segments container (top edge)
-    // Original bar was y=-140, align=center. Screen top Y = (480/2) - 140 = 100. Adjusted to 81.
-    lv_obj_set_pos(ui_SwrMeterSegmentsContainer, 0, ui_sy(81)); // X will be set after width calculation, Y is top edge
+    // SWR meter (single-draw segmented meter)
+    ui_SwrMeterSegmentsContainer = ui_seg_meter_create(ui_Screen1, 30, bar_width, bar_height, bar_gap_px);
     lv_obj_set_align(ui_SwrMeterSegmentsContainer, LV_ALIGN_TOP_LEFT); // Align to top-left for absolute positioning
-    lv_obj_set_layout(ui_SwrMeterSegmentsContainer, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(ui_SwrMeterSegmentsContainer, LV_FLEX_FLOW_ROW);
-    // Align bars to the start, with a gap between them
-    lv_obj_set_flex_align(ui_SwrMeterSegmentsContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER,
-                          LV_FLEX_ALIGN_CENTER);
-    // bar_gap_px is defined earlier (e.g. 2px)
-    lv_obj_set_style_pad_column(ui_SwrMeterSegmentsContainer, bar_gap_px, 0);
-    lv_obj_set_style_pad_left(ui_SwrMeterSegmentsContainer, 0, 0);
-    lv_obj_set_style_pad_right(ui_SwrMeterSegmentsContainer, 0, 0);
-
-    // Create container for ALC Meter segments (Moved earlier)
-    ui_AlcMeterSegmentsContainer = lv_obj_create(ui_Screen1);
-    lv_obj_remove_style_all(ui_AlcMeterSegmentsContainer);
-    lv_obj_add_flag(ui_AlcMeterSegmentsContainer, LV_OBJ_FLAG_OVERFLOW_VISIBLE); // Allow drawing outside bounds
-    lv_obj_set_height(ui_AlcMeterSegmentsContainer, LV_SIZE_CONTENT); // Height based on segments
+
+    // ALC meter (single-draw segmented meter)
+    ui_AlcMeterSegmentsContainer = ui_seg_meter_create(ui_Screen1, 30, bar_width, bar_height, bar_gap_px);
     lv_obj_set_align(ui_AlcMeterSegmentsContainer, LV_ALIGN_TOP_LEFT); // Align to top-left for absolute positioning
-    lv_obj_set_layout(ui_AlcMeterSegmentsContainer, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(ui_AlcMeterSegmentsContainer, LV_FLEX_FLOW_ROW);
-    // Align bars to the start, with a gap between them
-    lv_obj_set_flex_align(ui_AlcMeterSegmentsContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER,
-                          LV_FLEX_ALIGN_CENTER);
-    // bar_gap_px is defined earlier (e.g. 2px)
-    lv_obj_set_style_pad_column(ui_AlcMeterSegmentsContainer, bar_gap_px, 0);
-    lv_obj_set_style_pad_left(ui_AlcMeterSegmentsContainer, 0, 0);
-    lv_obj_set_style_pad_right(ui_AlcMeterSegmentsContainer, 0, 0);
 
     // Define "on" colors for 30 SWR segments
     // SWR > 3.0 (dot 19 / segment index 18 and above) should be red.
@@ -3123,40 +2828,20 @@ void ui_Screen1_screen_init(void) {
     lv_coord_t label_y_pos = ui_sy(10); // Y position for label containers (S-Meter ticks and Power scale)
     lv_coord_t meter_y_pos = ui_sy(35); // Y position for the S-Meter bar container
 
-    // S-Meter container
+    // S-Meter
     if (ui_SMeterSegmentsContainer) {
-        lv_obj_set_width(ui_SMeterSegmentsContainer, fixed_meter_area_width);
-        // Create children before setting position for LV_SIZE_CONTENT height
-        create_meter_segments(ui_SMeterSegmentsContainer, ui_SMeterSegments, 30, bar_width, bar_height,
-                              s_meter_on_colors);
-        // Reduce animation time for S-Meter segments for snappier updates
-        for (int i = 0; i < 30; i++) {
-            if (ui_SMeterSegments[i] != NULL && lv_obj_is_valid(ui_SMeterSegments[i])) {
-                lv_obj_set_style_anim_time(ui_SMeterSegments[i], 10, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-            }
-        }
+        ui_seg_meter_set_colors(ui_SMeterSegmentsContainer, s_meter_on_colors, 30);
         lv_obj_set_pos(ui_SMeterSegmentsContainer, common_meter_area_x_pos, meter_y_pos);
     }
 
-    // SWR Meter container: Y=89
+    // SWR Meter: Y=89
     if (ui_SwrMeterSegmentsContainer) {
-        lv_obj_set_width(ui_SwrMeterSegmentsContainer, fixed_meter_area_width);
-        // Create children before setting position for LV_SIZE_CONTENT height
-        create_meter_segments(ui_SwrMeterSegmentsContainer, ui_SwrMeterSegments, 30, bar_width, bar_height,
-                              swr_meter_on_colors);
-        // Reduce animation time for SWR Meter segments for snappier updates
-        for (int i = 0; i < 30; i++) {
-            if (ui_SwrMeterSegments[i] != NULL && lv_obj_is_valid(ui_SwrMeterSegments[i])) {
-                lv_obj_set_style_anim_time(ui_SwrMeterSegments[i], 10, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-            }
-        }
+        ui_seg_meter_set_colors(ui_SwrMeterSegmentsContainer, swr_meter_on_colors, 30);
         lv_obj_set_pos(ui_SwrMeterSegmentsContainer, common_meter_area_x_pos, ui_sy(89));
     }
 
-    // ALC Meter container: Y=62
+    // ALC Meter: Y=62
     if (ui_AlcMeterSegmentsContainer) {
-        lv_obj_set_width(ui_AlcMeterSegmentsContainer, fixed_meter_area_width);
-
         // Define "on" colors for 30 ALC segments immediately before use
         for (int k = 0; k < 30; k++) {
             if (k < 21) {
@@ -3168,15 +2853,7 @@ void ui_Screen1_screen_init(void) {
             }
         }
 
-        // Create children before setting position for LV_SIZE_CONTENT height
-        create_meter_segments(ui_AlcMeterSegmentsContainer, ui_AlcMeterSegments, 30, bar_width, bar_height,
-                              alc_meter_on_colors);
-        // Reduce animation time for ALC Meter segments for snappier updates
-        for (int i = 0; i < 30; i++) {
-            if (ui_AlcMeterSegments[i] != NULL && lv_obj_is_valid(ui_AlcMeterSegments[i])) {
-                lv_obj_set_style_anim_time(ui_AlcMeterSegments[i], 10, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-            }
-        }
+        ui_seg_meter_set_colors(ui_AlcMeterSegmentsContainer, alc_meter_on_colors, 30);
         lv_obj_set_pos(ui_AlcMeterSegmentsContainer, common_meter_area_x_pos, ui_sy(62));
     }
 
@@ -3400,62 +3077,15 @@ void ui_Screen1_screen_init(void) {
     lv_obj_set_style_text_font(ui_VfoAValue, ui_freq_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_VfoAValue, LV_OBJ_FLAG_HIDDEN); // Hide old implementation during testing
 
-    // Create segmented frequency display container
-    ui_VfoAFreqContainer = lv_obj_create(ui_Screen1);
-    lv_obj_set_size(ui_VfoAFreqContainer, ui_sx(600), LV_SIZE_CONTENT);
-    lv_obj_set_flex_flow(ui_VfoAFreqContainer, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(ui_VfoAFreqContainer, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_border_width(ui_VfoAFreqContainer, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_VfoAFreqContainer, LV_OPA_TRANSP, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_all(ui_VfoAFreqContainer, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    // Sets all paddings including column
-    lv_obj_set_style_pad_column(ui_VfoAFreqContainer, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    // Explicitly set column padding to 0
-
-    // Create MHz segment (e.g., "014")
-    ui_VfoAFreqMHz = lv_label_create(ui_VfoAFreqContainer);
-    lv_label_set_text(ui_VfoAFreqMHz, "14"); // Updated initial text
-    lv_obj_set_style_text_font(ui_VfoAFreqMHz, ui_freq_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_align(ui_VfoAFreqMHz, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    lv_point_t label_size; // Renamed for generic use
-    lv_txt_get_size(&label_size, "000", ui_freq_font(), 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
-    lv_obj_set_width(ui_VfoAFreqMHz, label_size.x);
-
-    // Create first period separator
-    ui_VfoAFreqDot1 = lv_label_create(ui_VfoAFreqContainer);
-    lv_label_set_text(ui_VfoAFreqDot1, ".");
-    lv_obj_set_style_text_font(ui_VfoAFreqDot1, ui_freq_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_txt_get_size(&label_size, ".", ui_freq_font(), 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
-    lv_obj_set_width(ui_VfoAFreqDot1, label_size.x);
-
-    // Create kHz segment (e.g., "012")
-    ui_VfoAFreqKHz = lv_label_create(ui_VfoAFreqContainer);
-    lv_label_set_text(ui_VfoAFreqKHz, "012");
-    lv_obj_set_style_text_font(ui_VfoAFreqKHz, ui_freq_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_align(ui_VfoAFreqKHz, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_txt_get_size(&label_size, "000", ui_freq_font(), 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
-    lv_obj_set_width(ui_VfoAFreqKHz, label_size.x);
-
-    // Create second period separator
-    ui_VfoAFreqDot2 = lv_label_create(ui_VfoAFreqContainer);
-    lv_label_set_text(ui_VfoAFreqDot2, ".");
-    lv_obj_set_style_text_font(ui_VfoAFreqDot2, ui_freq_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_txt_get_size(&label_size, ".", ui_freq_font(), 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
-    lv_obj_set_width(ui_VfoAFreqDot2, label_size.x);
-
-    // Create Hz segment (e.g., "00")
-    ui_VfoAFreqHz = lv_label_create(ui_VfoAFreqContainer);
-    lv_label_set_text(ui_VfoAFreqHz, "000"); // Updated initial text for 3 digits
-    lv_obj_set_style_text_font(ui_VfoAFreqHz, ui_freq_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_align(ui_VfoAFreqHz, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_txt_get_size(&label_size, "000", ui_freq_font(), 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE); // Measure "000"
-    lv_obj_set_width(ui_VfoAFreqHz, label_size.x);
-
-    // Children created, now set position for LV_SIZE_CONTENT height
-    lv_obj_set_x(ui_VfoAFreqContainer, 0);
-    lv_obj_set_y(ui_VfoAFreqContainer, ui_sy(45));
-    lv_obj_set_align(ui_VfoAFreqContainer, LV_ALIGN_CENTER);
+    // Frequency display: digits blitted from an atlas rasterized once from the frequency font
+    ui_VfoAFreqDisplay = ui_freq_display_create(ui_Screen1, ui_freq_font());
+    if (ui_VfoAFreqDisplay != NULL) {
+        ui_freq_display_set_freq(ui_VfoAFreqDisplay, 14012000); // Initial text "14.012.000"
+        lv_obj_set_x(ui_VfoAFreqDisplay, 0);
+        lv_obj_set_y(ui_VfoAFreqDisplay, ui_sy(45));
+        lv_obj_set_align(ui_VfoAFreqDisplay, LV_ALIGN_CENTER);
+        ui_tune_attach(ui_VfoAFreqDisplay, &s_tune_ops);
+    }
 
     // Mode label - displays current operating mode (USB, LSB, CW, etc.)
     ui_ModeLabel = lv_label_create(ui_Screen1);
@@ -3469,6 +3099,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_set_style_text_font(ui_ModeLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_color(ui_ModeLabel, lv_color_hex(COLOR_TEXT), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_opa(ui_ModeLabel, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_ModeLabel, ui_style(UI_STYLE_PENDING), LV_PART_MAIN | LV_STATE_USER_1);
 
     // DATA mode label - appears next to mode dropdown when DATA mode is active
     ui_DataModeLabel = lv_label_create(ui_Screen1);
@@ -3519,11 +3150,7 @@ void ui_Screen1_screen_init(void) {
     lv_label_set_text(ui_VfoALabel, "A");
     lv_obj_set_style_text_align(ui_VfoALabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_font(ui_VfoALabel, ui_btn_large_bold_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(ui_VfoALabel, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_VfoALabel, lv_color_hex(COLOR_BLUE_VFO_A_CHECKED), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_VfoALabel, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_border_color(ui_VfoALabel, lv_color_hex(COLOR_BORDER), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_border_opa(ui_VfoALabel, 255, LV_PART_MAIN | LV_STATE_CHECKED);
+    lv_obj_add_style(ui_VfoALabel, ui_style(UI_STYLE_VFO_ACTIVE), LV_PART_MAIN | LV_STATE_CHECKED);
     lv_obj_set_style_radius(ui_VfoALabel, 5, LV_PART_MAIN | LV_STATE_USER_1);
     lv_obj_set_style_bg_color(ui_VfoALabel, lv_color_hex(COLOR_BLUE_PRIMARY), LV_PART_MAIN | LV_STATE_USER_1);
     lv_obj_set_style_bg_opa(ui_VfoALabel, 255, LV_PART_MAIN | LV_STATE_USER_1);
@@ -3573,11 +3200,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_set_style_text_align(ui_MemoryLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_font(ui_MemoryLabel, ui_btn_large_bold_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
     // CHECKED state styling (same as VFO A) with padding for proper button appearance
-    lv_obj_set_style_radius(ui_MemoryLabel, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_MemoryLabel, lv_color_hex(COLOR_BLUE_VFO_A_CHECKED), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_MemoryLabel, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_border_color(ui_MemoryLabel, lv_color_hex(COLOR_BORDER), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_border_opa(ui_MemoryLabel, 255, LV_PART_MAIN | LV_STATE_CHECKED);
+    lv_obj_add_style(ui_MemoryLabel, ui_style(UI_STYLE_VFO_ACTIVE), LV_PART_MAIN | LV_STATE_CHECKED);
     lv_obj_set_style_pad_left(ui_MemoryLabel, ui_sx(12), LV_PART_MAIN | LV_STATE_CHECKED);
     lv_obj_set_style_pad_right(ui_MemoryLabel, ui_sx(12), LV_PART_MAIN | LV_STATE_CHECKED);
     lv_obj_set_style_pad_top(ui_MemoryLabel, 8, LV_PART_MAIN | LV_STATE_CHECKED);
@@ -3754,29 +3377,9 @@ void ui_Screen1_screen_init(void) {
     lv_label_set_text(ui_RxTxLabel, "RX");
     lv_obj_add_flag(ui_RxTxLabel, LV_OBJ_FLAG_CLICKABLE); /// Flags
     lv_obj_set_scrollbar_mode(ui_RxTxLabel, LV_SCROLLBAR_MODE_OFF);
-    lv_obj_set_style_text_color(ui_RxTxLabel, lv_color_hex(COLOR_TEXT), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_opa(ui_RxTxLabel, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_RxTxLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_align(ui_RxTxLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT); // Center text
-    lv_obj_set_style_radius(ui_RxTxLabel, 5, 0);
-    lv_obj_set_style_bg_color(ui_RxTxLabel, lv_color_hex(COLOR_GREEN_RX_ACTIVE), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_RxTxLabel, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_left(ui_RxTxLabel, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_right(ui_RxTxLabel, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_top(ui_RxTxLabel, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_bottom(ui_RxTxLabel, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_color(ui_RxTxLabel, lv_color_hex(COLOR_TEXT), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_text_opa(ui_RxTxLabel, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_text_font(ui_RxTxLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_CHECKED);
-    // Use MeterFont for TX state
-    lv_obj_set_style_text_align(ui_RxTxLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_CHECKED);
-    // Center text for TX state
-    lv_obj_set_style_bg_color(ui_RxTxLabel, lv_color_hex(COLOR_RED_TX_ACTIVE), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_RxTxLabel, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_pad_left(ui_RxTxLabel, 3, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_pad_right(ui_RxTxLabel, 3, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_pad_top(ui_RxTxLabel, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_pad_bottom(ui_RxTxLabel, 1, LV_PART_MAIN | LV_STATE_CHECKED);
+    // RX green / TX red, switched by LV_STATE_CHECKED in update_rxtx_label_status()
+    lv_obj_add_style(ui_RxTxLabel, ui_style(UI_STYLE_RXTX), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_RxTxLabel, ui_style(UI_STYLE_RXTX_TX), LV_PART_MAIN | LV_STATE_CHECKED);
 
     // Create a column container for the left-side buttons
     ui_LeftButtonColumn = lv_obj_create(ui_Screen1);
@@ -3802,16 +3405,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_remove_flag(ui_NrButton, (lv_obj_flag_t)(
                       LV_OBJ_FLAG_GESTURE_BUBBLE | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE |
                       LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_radius(ui_NrButton, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(ui_NrButton, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_NrButton, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(ui_NrButton, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_NrButton, lv_color_hex(COLOR_BLUE_PRIMARY), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_NrButton, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_radius(ui_NrButton, 5, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_color(ui_NrButton, lv_color_hex(COLOR_BLUE_PRIMARY),
-                              LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_opa(ui_NrButton, 255, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
+    ui_style_add_toggle_button(ui_NrButton);
     ui_NrButtonLabel = lv_label_create(ui_NrButton);
     lv_obj_set_width(ui_NrButtonLabel, LV_SIZE_CONTENT);
     lv_obj_set_height(ui_NrButtonLabel, LV_SIZE_CONTENT);
@@ -3821,8 +3415,7 @@ void ui_Screen1_screen_init(void) {
                       LV_OBJ_FLAG_PRESS_LOCK | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_GESTURE_BUBBLE |
                       LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC |
                       LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_text_align(ui_NrButtonLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_NrButtonLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_NrButtonLabel, ui_style(UI_STYLE_BTN_LABEL), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_event_cb(ui_NrButton, ui_event_NrButton, LV_EVENT_ALL, NULL);
     
     // Initialize NR button label
@@ -3838,16 +3431,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_remove_flag(ui_NbButton, (lv_obj_flag_t)(
                       LV_OBJ_FLAG_GESTURE_BUBBLE | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE |
                       LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_radius(ui_NbButton, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(ui_NbButton, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_NbButton, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(ui_NbButton, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_NbButton, lv_color_hex(COLOR_BLUE_PRIMARY), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_NbButton, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_radius(ui_NbButton, 5, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_color(ui_NbButton, lv_color_hex(COLOR_BLUE_PRIMARY),
-                              LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_opa(ui_NbButton, 255, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
+    ui_style_add_toggle_button(ui_NbButton);
     ui_NbButtonLabel = lv_label_create(ui_NbButton);
     lv_obj_set_width(ui_NbButtonLabel, LV_SIZE_CONTENT);
     lv_obj_set_height(ui_NbButtonLabel, LV_SIZE_CONTENT);
@@ -3857,8 +3441,7 @@ void ui_Screen1_screen_init(void) {
                       LV_OBJ_FLAG_PRESS_LOCK | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_GESTURE_BUBBLE |
                       LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC |
                       LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_text_align(ui_NbButtonLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_NbButtonLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_NbButtonLabel, ui_style(UI_STYLE_BTN_LABEL), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_event_cb(ui_NbButton, ui_event_NbButton, LV_EVENT_ALL, NULL);
     
     // Initialize NB button label
@@ -3874,16 +3457,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_remove_flag(ui_PreAmpButton, (lv_obj_flag_t)(
                       LV_OBJ_FLAG_GESTURE_BUBBLE | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE |
                       LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_radius(ui_PreAmpButton, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(ui_PreAmpButton, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_PreAmpButton, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(ui_PreAmpButton, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_PreAmpButton, lv_color_hex(COLOR_BLUE_PRIMARY), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_PreAmpButton, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_radius(ui_PreAmpButton, 5, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_color(ui_PreAmpButton, lv_color_hex(COLOR_BLUE_PRIMARY),
-                              LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_opa(ui_PreAmpButton, 255, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
+    ui_style_add_toggle_button(ui_PreAmpButton);
     ui_PreAmpButtonLabel = lv_label_create(ui_PreAmpButton);
     lv_obj_set_width(ui_PreAmpButtonLabel, LV_SIZE_CONTENT);
     lv_obj_set_height(ui_PreAmpButtonLabel, LV_SIZE_CONTENT);
@@ -3893,8 +3467,7 @@ void ui_Screen1_screen_init(void) {
                       LV_OBJ_FLAG_PRESS_LOCK | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_GESTURE_BUBBLE |
                       LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC |
                       LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_text_align(ui_PreAmpButtonLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_PreAmpButtonLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_PreAmpButtonLabel, ui_style(UI_STYLE_BTN_LABEL), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_event_cb(ui_PreAmpButton, ui_event_PreAmpButton, LV_EVENT_ALL, NULL);
 
     // --- Proc Button ---
@@ -3907,16 +3480,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_remove_flag(ui_ProcButton, (lv_obj_flag_t)(
                       LV_OBJ_FLAG_GESTURE_BUBBLE | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE |
                       LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_radius(ui_ProcButton, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(ui_ProcButton, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_ProcButton, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(ui_ProcButton, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_ProcButton, lv_color_hex(COLOR_BLUE_PRIMARY), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_ProcButton, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_radius(ui_ProcButton, 5, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_color(ui_ProcButton, lv_color_hex(COLOR_BLUE_PRIMARY),
-                              LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_opa(ui_ProcButton, 255, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
+    ui_style_add_toggle_button(ui_ProcButton);
     ui_ProcButtonLabel = lv_label_create(ui_ProcButton);
     lv_obj_set_width(ui_ProcButtonLabel, LV_SIZE_CONTENT);
     lv_obj_set_height(ui_ProcButtonLabel, LV_SIZE_CONTENT);
@@ -3926,8 +3490,7 @@ void ui_Screen1_screen_init(void) {
                       LV_OBJ_FLAG_PRESS_LOCK | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_GESTURE_BUBBLE |
                       LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC |
                       LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_text_align(ui_ProcButtonLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_ProcButtonLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_ProcButtonLabel, ui_style(UI_STYLE_BTN_LABEL), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_event_cb(ui_ProcButton, ui_event_ProcButton, LV_EVENT_ALL, NULL);
 
     // --- AT Tune Button ---
@@ -3940,16 +3503,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_remove_flag(ui_AtTuneButton, (lv_obj_flag_t)(
                       LV_OBJ_FLAG_GESTURE_BUBBLE | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE |
                       LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_radius(ui_AtTuneButton, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(ui_AtTuneButton, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_AtTuneButton, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(ui_AtTuneButton, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_AtTuneButton, lv_color_hex(COLOR_BLUE_PRIMARY), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_AtTuneButton, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_radius(ui_AtTuneButton, 5, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_color(ui_AtTuneButton, lv_color_hex(COLOR_BLUE_PRIMARY),
-                              LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_opa(ui_AtTuneButton, 255, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
+    ui_style_add_toggle_button(ui_AtTuneButton);
     ui_AtTuneButtonLabel = lv_label_create(ui_AtTuneButton);
     lv_obj_set_width(ui_AtTuneButtonLabel, LV_SIZE_CONTENT);
     lv_obj_set_height(ui_AtTuneButtonLabel, LV_SIZE_CONTENT);
@@ -3959,8 +3513,7 @@ void ui_Screen1_screen_init(void) {
                       LV_OBJ_FLAG_PRESS_LOCK | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_GESTURE_BUBBLE |
                       LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC |
                       LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_text_align(ui_AtTuneButtonLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_AtTuneButtonLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_AtTuneButtonLabel, ui_style(UI_STYLE_BTN_LABEL), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_event_cb(ui_AtTuneButton, ui_event_AtTuneButton, LV_EVENT_ALL, NULL);
 
     // --- ATT Button ---
@@ -3973,16 +3526,7 @@ void ui_Screen1_screen_init(void) {
     lv_obj_remove_flag(ui_AttButton, (lv_obj_flag_t)(
                       LV_OBJ_FLAG_GESTURE_BUBBLE | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE |
                       LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_radius(ui_AttButton, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(ui_AttButton, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_AttButton, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(ui_AttButton, 5, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(ui_AttButton, lv_color_hex(COLOR_BLUE_PRIMARY), LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_opa(ui_AttButton, 255, LV_PART_MAIN | LV_STATE_CHECKED);
-    lv_obj_set_style_radius(ui_AttButton, 5, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_color(ui_AttButton, lv_color_hex(COLOR_BLUE_PRIMARY),
-                              LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
-    lv_obj_set_style_bg_opa(ui_AttButton, 255, LV_PART_MAIN | LV_STATE_CHECKED | LV_STATE_PRESSED);
+    ui_style_add_toggle_button(ui_AttButton);
     ui_AttButtonLabel = lv_label_create(ui_AttButton);
     lv_obj_set_width(ui_AttButtonLabel, LV_SIZE_CONTENT);
     lv_obj_set_height(ui_AttButtonLabel, LV_SIZE_CONTENT);
@@ -3992,8 +3536,7 @@ void ui_Screen1_screen_init(void) {
                       LV_OBJ_FLAG_PRESS_LOCK | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_GESTURE_BUBBLE |
                       LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC |
                       LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN));
-    lv_obj_set_style_text_align(ui_AttButtonLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_AttButtonLabel, ui_btn_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_AttButtonLabel, ui_style(UI_STYLE_BTN_LABEL), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_event_cb(ui_AttButton, ui_event_AttButton, LV_EVENT_ALL, NULL);
 
     // --- Position LeftButtonColumn now that children are created ---
@@ -4161,11 +3704,11 @@ void ui_Screen1_screen_init(void) {
 
     ui_RitLabel = lv_label_create(ui_RitContainer);
     lv_label_set_text(ui_RitLabel, "RIT");
-    lv_obj_set_style_text_font(ui_RitLabel, ui_btn_small_reg_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_RitLabel, ui_style(UI_STYLE_RIT), LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_RitValue = lv_label_create(ui_RitContainer);
     lv_label_set_text(ui_RitValue, "+0.00");
-    lv_obj_set_style_text_font(ui_RitValue, ui_btn_small_reg_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_RitValue, ui_style(UI_STYLE_RIT), LV_PART_MAIN | LV_STATE_DEFAULT);
 
     // XIT container - right of SPLIT button
     ui_XitContainer = lv_obj_create(ui_Screen1);
@@ -4185,11 +3728,11 @@ void ui_Screen1_screen_init(void) {
 
     ui_XitLabel = lv_label_create(ui_XitContainer);
     lv_label_set_text(ui_XitLabel, "XIT");
-    lv_obj_set_style_text_font(ui_XitLabel, ui_btn_small_reg_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_XitLabel, ui_style(UI_STYLE_XIT), LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_XitValue = lv_label_create(ui_XitContainer);
     lv_label_set_text(ui_XitValue, "+0.00");
-    lv_obj_set_style_text_font(ui_XitValue, ui_btn_small_reg_font(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_XitValue, ui_style(UI_STYLE_XIT), LV_PART_MAIN | LV_STATE_DEFAULT);
 
     // Original NbButton creation code removed, it's now in LeftButtonColumn
     ui_DebugMode = lv_button_create(ui_Screen1);
@@ -4345,15 +3888,16 @@ void ui_Screen1_screen_init(void) {
     lv_obj_add_event_cb(ui_DebugMode, ui_event_DebugMode, LV_EVENT_ALL, NULL);
     lv_obj_add_event_cb(ui_SettingsButton, ui_event_SettingsButton, LV_EVENT_ALL, NULL);
 
+    // Clear the hot-path widget pointers when their widgets are deleted
+    ui_obj_ref_track_all(s_tracked_widgets, sizeof(s_tracked_widgets) / sizeof(s_tracked_widgets[0]));
+
     // Initialize RX/TX label status
-    // The update_rxtx_label_status function itself now contains lv_obj_is_valid checks for its UI elements.
-    // We still need to ensure ui_RxTxLabel is valid before calling.
-    if (lv_obj_is_valid(ui_RxTxLabel)) {
+    if (ui_RxTxLabel) {
         update_rxtx_label_status(cat_get_transmit_status());
     }
 
     // Register LVGL 9 subject observers for ui_Screen1
-    if (lv_obj_is_valid(ui_Screen1)) {
+    if (ui_Screen1) {
         // VFO consolidated updates (LVGL 9 observer only)
         lv_subject_add_observer_obj(&radio_vfo_consolidated_subject, update_vfo_consolidated_observer_cb, ui_Screen1, NULL);
 
@@ -4500,15 +4044,13 @@ void ui_Screen1_screen_destroy(void) {
 
     ui_AlcLabel = NULL;
     ui_CompMeterSegmentsContainer = NULL;
-    for (int i = 0; i < 15; i++) {
-        ui_CompMeterSegments[i] = NULL;
-    }
     ui_CompLabel = NULL;
     ui_AfGainBar = NULL;
     ui_AfGainLabel = NULL;
     ui_RfGainLabel = NULL;
     ui_RfGainBar = NULL;
     ui_VfoAValue = NULL;
+    ui_VfoAFreqDisplay = NULL;
     ui_ModeLabel = NULL;
     ui_DataModeLabel = NULL;
     ui_VfoBValue = NULL;
@@ -15,34 +15,25 @@ extern void ui_Screen1_screen_init(void);
 extern void ui_Screen1_screen_destroy(void);
 extern lv_obj_t * ui_Screen1;
 extern lv_obj_t * ui_SignalPanel;
-extern lv_obj_t * ui_SMeterSegmentsContainer; // Container for S-Meter segments
-extern lv_obj_t * ui_SMeterSegments[30];     // Array for 30 S-Meter segments
+extern lv_obj_t * ui_SMeterSegmentsContainer; // S-Meter (ui_seg_meter, 30 segments)
 extern lv_obj_t * ui_SMeterLabelsContainer; // Container for S-Meter tick labels
 extern lv_obj_t * ui_SMeterTickLabels[8]; // Array for 8 S-Meter tick labels
 extern lv_obj_t * ui_SMeterLabel;
 extern void ui_event_Switch1(lv_event_t * e);
 extern lv_obj_t * ui_Switch1;
 extern lv_obj_t * ui_SwrMeterLabel;
-extern lv_obj_t * ui_SwrMeterSegmentsContainer; // Container for SWR segments
-extern lv_obj_t * ui_SwrMeterSegments[30];     // Array for 30 SWR segments
+extern lv_obj_t * ui_SwrMeterSegmentsContainer; // SWR meter (ui_seg_meter, 30 segments)
 extern lv_obj_t * ui_SwrTextLabel;
-extern lv_obj_t * ui_AlcMeterSegmentsContainer; // Container for ALC segments
-extern lv_obj_t * ui_AlcMeterSegments[30];     // Array for 30 ALC segments (single mode)
+extern lv_obj_t * ui_AlcMeterSegmentsContainer; // ALC meter (ui_seg_meter, 30 or 15 segments)
 extern lv_obj_t * ui_ALC;
-extern lv_obj_t * ui_CompMeterSegmentsContainer; // Container for COMP segments
-extern lv_obj_t * ui_CompMeterSegments[15];     // Array for 15 COMP segments (dual mode)
+extern lv_obj_t * ui_CompMeterSegmentsContainer; // COMP meter (ui_seg_meter, 15 segments, dual mode)
 extern lv_obj_t * ui_CompLabel;
 extern lv_obj_t * ui_AfGainBar;
 extern lv_obj_t * ui_AfGainLabel;
 extern lv_obj_t * ui_RfGainLabel;
 extern lv_obj_t * ui_RfGainBar;
 extern lv_obj_t * ui_VfoAValue;
-extern lv_obj_t * ui_VfoAFreqContainer;  // Container for segmented frequency display
-extern lv_obj_t * ui_VfoAFreqMHz;        // MHz segment (e.g., "14")
-extern lv_obj_t * ui_VfoAFreqKHz;        // kHz segment (e.g., "012") 
-extern lv_obj_t * ui_VfoAFreqHz;         // Hz segment (e.g., "000")
-extern lv_obj_t * ui_VfoAFreqDot1;       // First period separator "."
-extern lv_obj_t * ui_VfoAFreqDot2;       // Second period separator "."
+extern lv_obj_t * ui_VfoAFreqDisplay;    // Main frequency readout (ui_freq_display)
 extern lv_obj_t * ui_ModeLabel;
 extern lv_obj_t * ui_DataModeLabel;
 extern lv_obj_t * ui_VfoBValue;
@@ -60,6 +51,8 @@ extern void ui_event_UtcTime(lv_event_t * e);
 extern lv_obj_t * ui_UtcTime;
 extern void update_filter_visibility_from_dropdown_idx(uint16_t dropdown_idx);
 extern int s_current_radio_mode;
+// Show a mode just sent to the radio until it is confirmed (optimistic local echo)
+extern void ui_screen1_request_mode(int cat_mode);
 extern lv_obj_t * ui_PwrLabel;
 extern lv_obj_t * ui_PwrValueLabel;
 extern void ui_event_IfFilter(lv_event_t * e);
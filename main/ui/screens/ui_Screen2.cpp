@@ -17,6 +17,8 @@
 #include "freertos/timers.h"
 #include "esp_lvgl_port.h"  // For lvgl_port_lock/unlock
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 
 static const char *TAG = "ui_Screen2";
 
@@ -84,7 +86,44 @@ static lv_obj_t * ui_MenuPageMeter;
 static lv_obj_t * ui_MenuPageAntennas;
 static lv_obj_t * ui_MenuPageMacros;
 static lv_obj_t * ui_MenuPageSystem;
-static bool ui_MenuDeferredBuilt = false;
+
+// Settings pages, in sidebar order. Each is populated on first selection unless
+// CONFIG_UI_SETTINGS_AT_BOOT (menuconfig: Settings screen construction).
+typedef enum {
+    UI_SETTINGS_PAGE_DISPLAY,
+    UI_SETTINGS_PAGE_RADIO_MENU,
+    UI_SETTINGS_PAGE_CAT,
+    UI_SETTINGS_PAGE_METER,
+    UI_SETTINGS_PAGE_ANTENNAS,
+    UI_SETTINGS_PAGE_MACROS,
+    UI_SETTINGS_PAGE_SYSTEM,
+    UI_SETTINGS_PAGE_COUNT
+} ui_settings_page_id_t;
+
+typedef struct {
+    const char *name;
+    lv_obj_t **page;
+    void (*build)(void);
+    bool built;
+} ui_settings_page_t;
+
+static void ui_build_display_page(void);
+static void ui_build_radio_menu_page(void);
+static void ui_build_cat_page(void);
+static void ui_build_meter_page(void);
+static void ui_build_antennas_page(void);
+static void ui_build_macros_page(void);
+static void ui_build_system_page(void);
+
+static ui_settings_page_t ui_settings_pages[UI_SETTINGS_PAGE_COUNT] = {
+    {"Display", &ui_MenuPageDisplay, ui_build_display_page, false},
+    {"Radio Menu", &ui_MenuPageRadioMenu, ui_build_radio_menu_page, false},
+    {"CAT & Transverter", &ui_MenuPageCat, ui_build_cat_page, false},
+    {"Meter", &ui_MenuPageMeter, ui_build_meter_page, false},
+    {"Antennas", &ui_MenuPageAntennas, ui_build_antennas_page, false},
+    {"Macros", &ui_MenuPageMacros, ui_build_macros_page, false},
+    {"System", &ui_MenuPageSystem, ui_build_system_page, false},
+};
 
 // Macro management state
 #define MAX_UI_MACROS 50
@@ -97,7 +136,7 @@ typedef struct {
     uint8_t fkey;  // 0=unassigned, 1-6=F1-F6
     char name[MACRO_NAME_MAX];
     char command[MACRO_COMMAND_MAX];
-    lv_obj_t *row_container;  // For dynamic updates/deletion
+    bool truncated;  // Longer on the radio than the cache holds; saving would cut it short
 } ui_macro_item_t;
 
 static ui_macro_item_t ui_macro_cache[MAX_UI_MACROS] = {0};
@@ -105,6 +144,27 @@ static uint8_t ui_macro_count = 0;
 static uint8_t ui_macro_fkey_assignments[MACRO_FKEY_SLOTS] = {0};  // macro_id for each F-key slot (0=empty)
 static int ui_macro_selected_index = -1;  // Currently selected row for deletion (-1=none)
 
+// Macro table rows are virtualized: a small pool of row objects is bound to the
+// cache entries around the scroll position and rebound as the table scrolls.
+#define MACRO_ROW_MARGIN 2     // Rows bound above and below the visible area
+#define MACRO_ROW_POOL_MAX 16
+
+typedef struct {
+    lv_obj_t *row;
+    lv_obj_t *id_lbl;
+    lv_obj_t *fkey_btn;
+    lv_obj_t *fkey_lbl;
+    lv_obj_t *name_lbl;
+    lv_obj_t *cmd_lbl;
+    int index;                 // Bound cache index (-1 = unbound)
+} ui_macro_row_t;
+
+static ui_macro_row_t ui_macro_rows[MACRO_ROW_POOL_MAX];
+static int ui_macro_row_pool = 0;        // Rows in the pool
+static int32_t ui_macro_rows_y0 = 0;     // Y of the first row in the table
+static int32_t ui_macro_row_pitch = 0;   // Row height plus gap
+static lv_obj_t *ui_macro_list_end = NULL;  // Marks the scrollable content height
+
 // Inline macro editor state (context-aware dual-pane editing)
 typedef struct {
     lv_obj_t *edit_overlay;       // Full overlay panel for editing (covers macro list)
@@ -125,6 +185,7 @@ typedef struct {
 } ui_macro_editor_t;
 
 static ui_macro_editor_t macro_editor = {0};
+static lv_obj_t *delete_confirm_popup = NULL;
 
 // Debounced refresh timer for macro list (avoid flashing when receiving many MXR responses)
 static TimerHandle_t macro_refresh_timer = NULL;
@@ -192,7 +253,6 @@ static bool s_radio_menu_internal_update = false;
 
 // Forward declarations
 void ui_update_polling_controls(void);
-static void ui_load_saved_settings(void);
 // static void post_screen2_init_cb(lv_timer_t *t);  // Commented out - not used
 static void ui_event_PlaceholderButton1_clicked(lv_event_t * e);
 static void ui_event_TransverterButton_clicked(lv_event_t * e);
@@ -205,6 +265,7 @@ static void ui_event_RadioMenuSlider(lv_event_t * e);
 static void ui_event_AntennaButton_clicked(lv_event_t * e);
 static void ui_update_antenna_button_states(int current_antenna, const uint8_t* available_antennas, int available_count);
 static void back_event_handler(lv_event_t * e);
+static void ui_Screen2_leave(void);
 static void queue_settings_save(void);
 static void ui_update_cw_sidetone_display(int value);
 static void ui_update_cw_pitch_display(int value);
@@ -222,6 +283,7 @@ static void ui_macro_show_delete_confirm(uint8_t macro_id);
 static void ui_macro_start_inline_edit(int cache_index, bool edit_name);
 static void ui_macro_end_inline_edit(bool save);
 static void ui_macro_keyboard_event_cb(lv_event_t *e);
+static void ui_macro_select(int cache_index);
 void ui_macro_refresh_list(void);  // Non-static: called from cat_parser.cpp
 void ui_macro_request_refresh(void);  // Non-static: debounced refresh for batch MXR updates
 void ui_macro_set_cached(uint8_t id, const char *name, const char *cmd);  // Non-static: called from cat_parser.cpp
@@ -264,6 +326,7 @@ static void back_event_handler(lv_event_t * e)
     if(code == LV_EVENT_CLICKED) {
         if (lv_menu_back_button_is_root(menu, obj)) {
             _ui_screen_change(&ui_Screen1, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen1_screen_init);
+            ui_Screen2_leave();
         }
     }
 }
@@ -523,6 +586,7 @@ void ui_event_ReturnToScreen1Button(lv_event_t * e)
     if(event_code == LV_EVENT_CLICKED) {
         // NVS save disabled - just return to Screen1
         _ui_screen_change(&ui_Screen1, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen1_screen_init);
+        ui_Screen2_leave();
     }
 }
 
@@ -945,7 +1009,9 @@ static void ui_update_transverter_display(void) {
     transverter_state_t* state = get_transverter_state();
     if (state && state->xo_data.valid && state->ex056_data.valid) {
         // Transverter data is available, enable the button functionality
-        lv_obj_remove_state(ui_PlaceholderButton1, LV_STATE_DISABLED);
+        if (lv_obj_is_valid(ui_PlaceholderButton1)) {
+            lv_obj_remove_state(ui_PlaceholderButton1, LV_STATE_DISABLED);
+        }
     } else {
         // No transverter data available - switch remains functional
     }
@@ -1312,13 +1378,16 @@ static void ai_mode_restore_timer_cb(lv_timer_t* timer) {
     lv_timer_del(timer);  // Delete one-shot timer
 }
 
-// Load saved settings and apply them to UI and system state
-static void ui_load_saved_settings(void) {
+// Load saved settings and apply them to system state. The Settings pages read
+// this state when they are built, so it must run at boot even if Screen2 is not.
+void ui_Screen2_apply_saved_settings(void) {
     user_settings_t settings;
     esp_err_t ret = settings_load(&settings);
     
     if (ret != ESP_OK) {
         ESP_LOGW("UI_Settings", "Failed to load settings, using defaults: %s", esp_err_to_name(ret));
+        current_settings.pep_enabled = true;
+        current_settings.smeter_averaging_enabled = true;
         return;
     }
     
@@ -1337,23 +1406,9 @@ static void ui_load_saved_settings(void) {
     
     // Apply XVTR offset mix setting
     xvtr_offset_mix_enabled = settings.xvtr_offset_mix_enabled;
-    if (lv_obj_is_valid(ui_PlaceholderButton1)) {
-        if (xvtr_offset_mix_enabled) {
-            lv_obj_add_state(ui_PlaceholderButton1, LV_STATE_CHECKED);
-        } else {
-            lv_obj_remove_state(ui_PlaceholderButton1, LV_STATE_CHECKED);
-        }
-    }
     
     // Apply CAT polling setting
     cat_polling_set_user_override(settings.cat_polling_enabled);
-    if (lv_obj_is_valid(ui_PlaceholderButton2)) {
-        if (settings.cat_polling_enabled) {
-            lv_obj_add_state(ui_PlaceholderButton2, LV_STATE_CHECKED);
-        } else {
-            lv_obj_remove_state(ui_PlaceholderButton2, LV_STATE_CHECKED);
-        }
-    }
     
     // Apply AI mode setting (only if it's a valid known mode, not UNKNOWN)
     // Use a short timer to defer this until after screen initialization is complete
@@ -1366,216 +1421,52 @@ static void ui_load_saved_settings(void) {
         lv_timer_set_repeat_count(ai_restore_timer, 1);
     }
     
-    // Apply peak hold setting
-    if (settings.peak_hold_enabled) {
-        lv_obj_add_state(ui_PeakHoldSwitch, LV_STATE_CHECKED);
-    } else {
-        lv_obj_remove_state(ui_PeakHoldSwitch, LV_STATE_CHECKED);
-    }
-    // Update Screen1 state via observer
+    // Update Screen1 peak hold state and timing via observer
     lv_subject_set_int(&radio_peak_hold_enabled_subject, settings.peak_hold_enabled ? 1 : 0);
-    
-    // Apply peak hold duration setting
-    if (lv_obj_is_valid(ui_PeakHoldDurationSlider)) {
-        lv_slider_set_value(ui_PeakHoldDurationSlider, settings.peak_hold_duration_ms, LV_ANIM_OFF);
-        
-        // Update the duration label
-        if (lv_obj_is_valid(ui_PeakHoldDurationLabel)) {
-            static char duration_text[32];
-            snprintf(duration_text, sizeof(duration_text), "Peak Hold Duration: %lums", settings.peak_hold_duration_ms);
-            lv_label_set_text(ui_PeakHoldDurationLabel, duration_text);
-        }
-    }
-    // Update Screen1 peak hold timing via observer
     lv_subject_set_int(&radio_peak_hold_duration_subject, (int32_t)settings.peak_hold_duration_ms);
 
-    // Apply PEP enabled setting
-    if (settings.pep_enabled) {
-        lv_obj_add_state(ui_PepToggleSwitch, LV_STATE_CHECKED);
-    } else {
-        lv_obj_remove_state(ui_PepToggleSwitch, LV_STATE_CHECKED);
-    }
     // Update PEP system
     pep_enable(settings.pep_enabled);
     
-    // Apply S-meter averaging setting
-    if (lv_obj_is_valid(ui_SMeterAveragingSwitch)) {
-        if (settings.smeter_averaging_enabled) {
-            lv_obj_add_state(ui_SMeterAveragingSwitch, LV_STATE_CHECKED);
-        } else {
-            lv_obj_remove_state(ui_SMeterAveragingSwitch, LV_STATE_CHECKED);
-        }
-    }
     // Update Screen1 averaging behavior via observer
     lv_subject_set_int(&radio_smeter_averaging_subject, settings.smeter_averaging_enabled ? 1 : 0);
 
-    // Apply antenna switch setting
-    if (lv_obj_is_valid(ui_AntennaSwitchButton)) {
-        if (settings.antenna_switch_enabled) {
-            lv_obj_add_state(ui_AntennaSwitchButton, LV_STATE_CHECKED);
-        } else {
-            lv_obj_remove_state(ui_AntennaSwitchButton, LV_STATE_CHECKED);
-        }
-    }
-
     ESP_LOGI("UI_Settings", "Settings loaded and applied successfully");
 }
 
-void ui_Screen2_screen_init(void) {
-    
-    // If already created, avoid rebuilding to keep init work minimal
-    if (ui_Screen2 && lv_obj_is_valid(ui_Screen2)) {
-        ESP_LOGI("UI_Screen2", "Screen2 already exists - skipping init");
-        return;
-    }
-    
-    ESP_LOGI("UI_Screen2", "Creating Screen2 UI elements...");
-    // Base screen
-    ui_Screen2 = lv_obj_create(NULL);
-    lv_obj_remove_flag(ui_Screen2, (lv_obj_flag_t)(LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM));
-    // Match Screen1 palette: keep a deep background for content area
-    lv_obj_set_style_bg_color(ui_Screen2, lv_color_hex(0x101418), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Screen2, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Create a full-screen opaque background panel to prevent Screen1 bleed-through
-    // This sits behind the menu and ensures complete coverage without modifying menu styling
-    lv_obj_t *bg_panel = lv_obj_create(ui_Screen2);
-    lv_obj_remove_style_all(bg_panel);
-    lv_obj_set_size(bg_panel, LV_PCT(100), LV_PCT(100));
-    lv_obj_set_style_bg_color(bg_panel, lv_color_hex(0x101418), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(bg_panel, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_remove_flag(bg_panel, LV_OBJ_FLAG_SCROLLABLE);
-
-    // Create LVGL Complex Menu
-    ESP_LOGI("UI_Screen2", "Creating menu on Screen2=%p", (void*)ui_Screen2);
-    ui_Menu = lv_menu_create(ui_Screen2);
-    ESP_LOGI("UI_Screen2", "Menu created: ui_Menu=%p", (void*)ui_Menu);
-
-    if (ui_Menu == NULL) {
-        ESP_LOGE("UI_Screen2", "FATAL: lv_menu_create returned NULL!");
+// Populate a settings page if it has not been built yet
+static void ui_settings_build_page(ui_settings_page_id_t id)
+{
+    ui_settings_page_t *p = &ui_settings_pages[id];
+    if (p->built || *p->page == NULL) {
         return;
     }
 
-    // DEBUG: Check menu internal structure
-    lv_menu_t* menu_priv = (lv_menu_t*)ui_Menu;
-    ESP_LOGI("UI_Screen2", "Menu internals: storage=%p main=%p main_header=%p",
-             (void*)menu_priv->storage, (void*)menu_priv->main, (void*)menu_priv->main_header);
-
-    lv_obj_set_size(ui_Menu, LV_PCT(100), LV_PCT(100));
-    lv_obj_center(ui_Menu);
-    lv_menu_set_mode_header(ui_Menu, LV_MENU_HEADER_TOP_FIXED);
-    // Enable proper LVGL menu back button instead of custom overlay
-    lv_menu_set_mode_root_back_button(ui_Menu, LV_MENU_ROOT_BACK_BUTTON_ENABLED);
-    lv_obj_add_event_cb(ui_Menu, back_event_handler, LV_EVENT_CLICKED, ui_Menu);
-
-    // Style the menu header and back button properly
-    lv_obj_t *header = lv_menu_get_main_header(ui_Menu);
-    ESP_LOGI("UI_Screen2", "Got menu header: header=%p", (void*)header);
-    lv_obj_set_style_bg_color(header, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_color(header, lv_color_hex(COLOR_TEXT), LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Set header font that supports LVGL symbols (for back button arrow LV_SYMBOL_LEFT)
-    lv_obj_set_style_text_font(header, ui_symbol_font_lg(), LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Ensure the menu inherits the main background for the content panel
-    lv_obj_set_style_bg_color(ui_Menu, lv_color_hex(0x101418), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Menu, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Create root page with proper sidebar styling
-    ESP_LOGI("UI_Screen2", "About to create menu page with ui_Menu=%p", (void*)ui_Menu);
-    lv_obj_t *root = lv_menu_page_create(ui_Menu, "Settings");
-    lv_obj_set_style_pad_hor(root, lv_obj_get_style_pad_left(lv_menu_get_main_header(ui_Menu), LV_PART_MAIN), 0);
-
-    // Enhanced sidebar styling with width for text content
-    lv_obj_set_width(root, ui_sx(225)); // Wider for better text spacing
-    lv_obj_set_scroll_dir(root, LV_DIR_VER); // Disable horizontal scrolling on sidebar
-
-    // Clean sidebar styling without border
-    lv_obj_set_style_bg_color(root, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(root, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(root, 0, LV_PART_MAIN | LV_STATE_DEFAULT);  // Remove blue border
-    lv_obj_set_style_shadow_width(root, 8, LV_PART_MAIN | LV_STATE_DEFAULT);  // Subtle shadow
-    lv_obj_set_style_shadow_color(root, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);  // Dark shadow
-    lv_obj_set_style_shadow_opa(root, 30, LV_PART_MAIN | LV_STATE_DEFAULT);   // Subtle opacity
-    lv_obj_set_style_radius(root, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    lv_obj_t *root_sec = lv_menu_section_create(root);
-    // Add padding for better spacing
-    lv_obj_set_style_pad_all(root_sec, ui_sx(15), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_top(root, ui_sy(18), 0);      // extra space above the first section
-    lv_obj_set_style_pad_top(root_sec, ui_sy(18), 0);  // and above the section contents
-
-    // Sub pages (store for deferred population)
-    ui_MenuPageDisplay = lv_menu_page_create(ui_Menu, "Display");
-    ui_MenuPageRadioMenu = lv_menu_page_create(ui_Menu, "Radio Menu");
-    ui_MenuPageCat = lv_menu_page_create(ui_Menu, "CAT & Transverter");
-    ui_MenuPageMeter = lv_menu_page_create(ui_Menu, "Meter");
-    ui_MenuPageAntennas = lv_menu_page_create(ui_Menu, "Antennas");
-    ui_MenuPageMacros = lv_menu_page_create(ui_Menu, "Macros");
-    ui_MenuPageSystem = lv_menu_page_create(ui_Menu, "System");
-
-    // Disable horizontal scrolling on all menu pages to prevent unwanted shifts
-    lv_obj_set_scroll_dir(ui_MenuPageDisplay, LV_DIR_VER);
-    lv_obj_set_scroll_dir(ui_MenuPageRadioMenu, LV_DIR_VER);
-    lv_obj_set_scroll_dir(ui_MenuPageCat, LV_DIR_VER);
-    lv_obj_set_scroll_dir(ui_MenuPageMeter, LV_DIR_VER);
-    lv_obj_set_scroll_dir(ui_MenuPageAntennas, LV_DIR_VER);
-    lv_obj_set_scroll_dir(ui_MenuPageMacros, LV_DIR_VER);
-    lv_obj_set_scroll_dir(ui_MenuPageSystem, LV_DIR_VER);
-
-    // Create sidebar menu items with themed colored LVGL symbols
-    lv_obj_t *it_display = create_text_colored(root_sec, LV_SYMBOL_IMAGE, "Display", COLOR_AQUA_LIGHT);
-    lv_menu_set_load_page_event(ui_Menu, it_display, ui_MenuPageDisplay);
-
-    lv_obj_t *it_radio_menu = create_text_colored(root_sec, LV_SYMBOL_AUDIO, "Radio Menu", COLOR_ORANGE_VIBRANT);
-    lv_menu_set_load_page_event(ui_Menu, it_radio_menu, ui_MenuPageRadioMenu);
-
-    lv_obj_t *it_cat = create_text_colored(root_sec, LV_SYMBOL_LIST, "CAT & Transverter", COLOR_SELECTIVE_YELLOW);
-    lv_menu_set_load_page_event(ui_Menu, it_cat, ui_MenuPageCat);
-
-    lv_obj_t *it_meter = create_text_colored(root_sec, LV_SYMBOL_BARS, "Meter", COLOR_SUCCESS_GREEN);
-    lv_menu_set_load_page_event(ui_Menu, it_meter, ui_MenuPageMeter);
-
-    lv_obj_t *it_antennas = create_text_colored(root_sec, LV_SYMBOL_WIFI, "Antennas", COLOR_PURPLE_ACCENT);
-    lv_menu_set_load_page_event(ui_Menu, it_antennas, ui_MenuPageAntennas);
-
-    lv_obj_t *it_macros = create_text_colored(root_sec, LV_SYMBOL_SHUFFLE, "Macros", COLOR_SELECTIVE_YELLOW);
-    lv_menu_set_load_page_event(ui_Menu, it_macros, ui_MenuPageMacros);
-
-    lv_obj_t *it_system = create_text_colored(root_sec, LV_SYMBOL_SETTINGS, "System", COLOR_ARGENTINIAN_BLUE);
-    lv_menu_set_load_page_event(ui_Menu, it_system, ui_MenuPageSystem);
-
-    // Set the sidebar and default main page
-    lv_menu_set_sidebar_page(ui_Menu, root);
-    lv_menu_set_page(ui_Menu, ui_MenuPageDisplay);
-
-    // Disable horizontal scrolling on menu and its internal components to prevent
-    // unwanted horizontal shifts when interacting with switches/buttons
-    lv_obj_set_scroll_dir(ui_Menu, LV_DIR_VER);
-    if (menu_priv->main) {
-        lv_obj_set_scroll_dir(menu_priv->main, LV_DIR_VER);
-    }
-    if (menu_priv->sidebar) {
-        lv_obj_set_scroll_dir(menu_priv->sidebar, LV_DIR_VER);
-    }
+    int64_t start_us = esp_timer_get_time();
+    size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    p->build();
+    p->built = true;
+    ESP_LOGI("UI_Screen2", "Page '%s' built in %lu us, heap %ld bytes", p->name,
+             (unsigned long)(esp_timer_get_time() - start_us),
+             (long)heap_before - (long)heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
+}
 
-    // Style the sidebar header
-    lv_obj_t *sidebar_header = lv_menu_get_sidebar_header(ui_Menu);
-    if (sidebar_header) {
-        lv_obj_set_style_pad_ver(sidebar_header, ui_sy(12), LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_pad_hor(sidebar_header, ui_sx(15), LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_color(sidebar_header, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
+static void ui_settings_page_select_cb(lv_event_t * e)
+{
+    ui_settings_build_page((ui_settings_page_id_t)(uintptr_t)lv_event_get_user_data(e));
+}
 
-        // Find the existing "Settings" label created by lv_menu and style it
-        lv_obj_t *header_label = lv_obj_get_child(sidebar_header, 0);
-        if (header_label && lv_obj_check_type(header_label, &lv_label_class)) {
-            lv_obj_set_style_text_font(header_label, ui_font30(), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_text_color(header_label, lv_color_hex(COLOR_TEXT), LV_PART_MAIN | LV_STATE_DEFAULT);
-        }
-    }
+// Sidebar item -> page. The build handler is added before lv_menu's own click
+// handler so the page has its contents by the time the menu shows it.
+static void ui_settings_bind_page(lv_obj_t * item, ui_settings_page_id_t id)
+{
+    lv_obj_add_event_cb(item, ui_settings_page_select_cb, LV_EVENT_CLICKED, (void *)(uintptr_t)id);
+    lv_menu_set_load_page_event(ui_Menu, item, *ui_settings_pages[id].page);
+}
 
-    // ===== Build all pages immediately with enhanced styling =====
-    // Enhanced Display page
+// Display page: brightness and screensaver
+static void ui_build_display_page(void)
+{
     lv_obj_t *sec_disp = lv_menu_section_create(ui_MenuPageDisplay);
     lv_obj_set_style_bg_color(ui_MenuPageDisplay, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_pad_all(sec_disp, ui_sx(20), LV_PART_MAIN | LV_STATE_DEFAULT);
@@ -1602,8 +1493,11 @@ void ui_Screen2_screen_init(void) {
     lv_obj_add_event_cb(ui_ScreensaverButton, ui_event_ScreensaverButton_clicked, LV_EVENT_CLICKED, NULL);
     // Set initial button text and color based on current screensaver setting
     ui_update_screensaver_button_style(screensaver_get_timeout());
+}
 
-    // Radio Menu page (two-column layout)
+// Radio Menu page (two-column layout)
+static void ui_build_radio_menu_page(void)
+{
     lv_obj_t *sec_radio = lv_menu_section_create(ui_MenuPageRadioMenu);
     lv_obj_set_style_bg_color(ui_MenuPageRadioMenu, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_pad_all(sec_radio, ui_sx(20), LV_PART_MAIN | LV_STATE_DEFAULT);
@@ -1654,28 +1548,34 @@ void ui_Screen2_screen_init(void) {
     lv_obj_add_event_cb(ui_Acc2OutputSlider, ui_event_RadioMenuSlider, LV_EVENT_VALUE_CHANGED, &g_radio_menu_acc2_output);
     ui_update_radio_menu_item(&g_radio_menu_acc2_output, acc2_out_init);
 
-    // Enhanced CAT page
+    // Request CW menu values; the screen's observers update the sliders when they arrive
+    cat_request_cw_menu_update();
+}
+
+// CAT & Transverter page
+static void ui_build_cat_page(void)
+{
     lv_obj_t *sec_cat = lv_menu_section_create(ui_MenuPageCat);
     lv_obj_set_style_bg_color(ui_MenuPageCat, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_pad_all(sec_cat, ui_sx(20), LV_PART_MAIN | LV_STATE_DEFAULT);
 
     // XVTR offset mix with icon
-    lv_obj_t *row_xvtr = create_switch(sec_cat, NULL, "XVTR Offset Mix", false);
+    lv_obj_t *row_xvtr = create_switch(sec_cat, NULL, "XVTR Offset Mix", xvtr_offset_mix_enabled);
     ui_PlaceholderButton1 = lv_obj_get_child(row_xvtr, -1); // Get the switch from the container
     lv_obj_add_event_cb(ui_PlaceholderButton1, ui_event_PlaceholderButton1_clicked, LV_EVENT_VALUE_CHANGED, NULL);
 
     // Transverter (UIXD) with icon
-    lv_obj_t *row_transverter = create_switch(sec_cat, NULL, "Transverter", false);
+    lv_obj_t *row_transverter = create_switch(sec_cat, NULL, "Transverter", transverter_enabled);
     ui_TransverterButton = lv_obj_get_child(row_transverter, -1); // Get the switch from the container
     lv_obj_add_event_cb(ui_TransverterButton, ui_event_TransverterButton_clicked, LV_EVENT_VALUE_CHANGED, NULL);
 
     // Panel Data (UIDE) with icon - controls data updates from panel
-    lv_obj_t *row_panel_data = create_switch(sec_cat, NULL, "Panel Data", true); // Default: enabled
+    lv_obj_t *row_panel_data = create_switch(sec_cat, NULL, "Panel Data", panel_data_enabled);
     ui_PanelDataButton = lv_obj_get_child(row_panel_data, -1); // Get the switch from the container
     lv_obj_add_event_cb(ui_PanelDataButton, ui_event_PanelDataButton_clicked, LV_EVENT_VALUE_CHANGED, NULL);
 
     // CAT polling with icon
-    lv_obj_t *row_poll = create_switch(sec_cat, NULL, "CAT Polling", false);
+    lv_obj_t *row_poll = create_switch(sec_cat, NULL, "CAT Polling", cat_polling_get_user_override());
     ui_PlaceholderButton2 = lv_obj_get_child(row_poll, -1); // Get the switch from the container
     lv_obj_add_event_cb(ui_PlaceholderButton2, ui_event_PollingButton_clicked, LV_EVENT_VALUE_CHANGED, NULL);
 
@@ -1685,45 +1585,44 @@ void ui_Screen2_screen_init(void) {
     ui_PlaceholderLabel3 = lv_obj_get_child(ui_PlaceholderButton3, 0); // Get the label from the button
     lv_obj_add_event_cb(ui_PlaceholderButton3, ui_event_AIModeButton_clicked, LV_EVENT_CLICKED, NULL);
 
-    // Enhanced Meter page
+    ui_update_polling_controls();
+}
+
+// Meter page
+static void ui_build_meter_page(void)
+{
     lv_obj_t *sec_meter = lv_menu_section_create(ui_MenuPageMeter);
     lv_obj_set_style_bg_color(ui_MenuPageMeter, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_pad_all(sec_meter, ui_sx(20), LV_PART_MAIN | LV_STATE_DEFAULT);
 
     // S-meter averaging with icon
-    lv_obj_t *row_savg = create_switch(sec_meter, NULL, "S-Meter Averaging", true);
+    lv_obj_t *row_savg = create_switch(sec_meter, NULL, "S-Meter Averaging",
+                                      lv_subject_get_int(&radio_smeter_averaging_subject) != 0);
     ui_SMeterAveragingSwitch = lv_obj_get_child(row_savg, -1); // Get the switch from the container
     lv_obj_add_event_cb(ui_SMeterAveragingSwitch, ui_event_SMeterAveragingSwitch, LV_EVENT_VALUE_CHANGED, NULL);
 
     // Peak hold toggle with icon
-    lv_obj_t *row_phold = create_switch(sec_meter, NULL, "Peak Hold", false);
+    lv_obj_t *row_phold = create_switch(sec_meter, NULL, "Peak Hold",
+                                       lv_subject_get_int(&radio_peak_hold_enabled_subject) != 0);
     ui_PeakHoldSwitch = lv_obj_get_child(row_phold, -1); // Get the switch from the container
     lv_obj_add_event_cb(ui_PeakHoldSwitch, ui_event_PeakHoldSwitch, LV_EVENT_VALUE_CHANGED, NULL);
 
     // Peak hold duration with icon
-    lv_obj_t *row_phdur = create_slider(sec_meter, NULL, "Peak Duration", 10, 1000, 100);
+    lv_obj_t *row_phdur = create_slider(sec_meter, NULL, "Peak Duration", 10, 1000,
+                                       lv_subject_get_int(&radio_peak_hold_duration_subject));
     ui_PeakHoldDurationSlider = lv_obj_get_child(row_phdur, -1); // Get the slider from the container
     ui_PeakHoldDurationValueLabel = lv_obj_get_child(row_phdur, -2); // Get the value label from the container
     lv_obj_add_event_cb(ui_PeakHoldDurationSlider, ui_event_PeakHoldDurationSlider, LV_EVENT_VALUE_CHANGED, NULL);
 
     // PEP display toggle with icon
-    lv_obj_t *row_pep = create_switch(sec_meter, NULL, "Peak Envelope Power", true);
+    lv_obj_t *row_pep = create_switch(sec_meter, NULL, "Peak Envelope Power", current_settings.pep_enabled);
     ui_PepToggleSwitch = lv_obj_get_child(row_pep, -1); // Get the switch from the container
     lv_obj_add_event_cb(ui_PepToggleSwitch, ui_event_PepToggleSwitch, LV_EVENT_VALUE_CHANGED, NULL);
+}
 
-    // Enhanced System page
-    lv_obj_t *sec_sys = lv_menu_section_create(ui_MenuPageSystem);
-    lv_obj_set_style_bg_color(ui_MenuPageSystem, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_all(sec_sys, ui_sx(20), LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Reboot button with icon
-    lv_obj_t *row_reboot = create_button(sec_sys, NULL, "System", "Restart");
-    ui_RebootButton = lv_obj_get_child(row_reboot, -1); // Get the button from the container
-    lv_obj_set_style_bg_color(ui_RebootButton, lv_color_hex(COLOR_RED_LIGHT), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(ui_RebootButton, lv_color_hex(0xFF6666), LV_PART_MAIN | LV_STATE_PRESSED);
-    lv_obj_add_event_cb(ui_RebootButton, ui_event_RebootButton, LV_EVENT_CLICKED, NULL);
-
-    // Enhanced Antennas page
+// Antennas page: 8 selection buttons and the WebSocket enable switch
+static void ui_build_antennas_page(void)
+{
     lv_obj_t *sec_antennas = lv_menu_section_create(ui_MenuPageAntennas);
     lv_obj_set_style_bg_color(ui_MenuPageAntennas, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_pad_all(sec_antennas, ui_sx(20), LV_PART_MAIN | LV_STATE_DEFAULT);
@@ -1790,65 +1689,13 @@ void ui_Screen2_screen_init(void) {
     }
 
     // Create antenna switch enable/disable toggle at the bottom of the page
-    lv_obj_t *row_antenna_switch = create_switch(sec_antennas, NULL, "Enable", false);
+    lv_obj_t *row_antenna_switch = create_switch(sec_antennas, NULL, "Enable", current_settings.antenna_switch_enabled);
     ui_AntennaSwitchButton = lv_obj_get_child(row_antenna_switch, -1); // Get the switch from container
     lv_obj_add_event_cb(ui_AntennaSwitchButton, ui_event_AntennaSwitchButton_clicked, LV_EVENT_VALUE_CHANGED, NULL);
 
-    // NVS save task DISABLED due to ESP32-S3 RGB LCD hardware limitation
-    // Flash writes cause display corruption regardless of timing/batching
-    // See: https://github.com/espressif/esp-idf/issues/10010
-    // Settings will not persist across reboots
-    ESP_LOGW("UI_Screen2", "NVS save disabled - settings won't persist (display stability)");
-
-    // Apply settings and control sync immediately
-    ui_update_polling_controls();
-    ui_load_saved_settings();
-
-    // Initialize macro management UI
-    ui_macro_populate_list();
-
-    // Subscribe to messages (LVGL 9 native observers only - legacy removed)
-    // Transverter state updates
-    lv_subject_add_observer_obj(&radio_transverter_state_subject, ui_transverter_observer_cb, ui_Screen2, NULL);
-    lv_subject_add_observer_obj(&radio_transverter_xo_subject, ui_transverter_observer_cb, ui_Screen2, NULL);
-    lv_subject_add_observer_obj(&radio_transverter_ex056_subject, ui_transverter_observer_cb, ui_Screen2, NULL);
-
-    // CAT polling state updates
-    lv_subject_add_observer_obj(&radio_cat_polling_state_subject, ui_polling_observer_cb, ui_Screen2, NULL);
-
-    // Display refresh notifications
-    lv_subject_add_observer_obj(&radio_force_refresh_subject, ui_display_refresh_observer_cb, ui_Screen2, NULL);
-
-    // Backlight level updates
-    lv_subject_add_observer_obj(&radio_backlight_subject, ui_backlight_observer_cb, ui_Screen2, NULL);
-
-    // CW menu updates
-    lv_subject_add_observer_obj(&radio_cw_sidetone_volume_subject, ui_cw_sidetone_observer_cb, ui_Screen2, NULL);
-    lv_subject_add_observer_obj(&radio_cw_pitch_hz_subject, ui_cw_pitch_observer_cb, ui_Screen2, NULL);
-    lv_subject_add_observer_obj(&radio_fm_mic_gain_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_fm_mic_gain);
-    lv_subject_add_observer_obj(&radio_usb_input_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_usb_input);
-    lv_subject_add_observer_obj(&radio_usb_output_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_usb_output);
-    lv_subject_add_observer_obj(&radio_acc2_input_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_acc2_input);
-    lv_subject_add_observer_obj(&radio_acc2_output_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_acc2_output);
-
-    // XVTR Offset Mix toggle updates
-    lv_subject_add_observer_obj(&radio_xvtr_offset_mix_subject, ui_xvtr_offset_mix_observer_cb, ui_Screen2, NULL);
-
-    // Transverter toggle updates
-    lv_subject_add_observer_obj(&radio_transverter_enabled_subject, ui_transverter_enabled_observer_cb, ui_Screen2, NULL);
-
-    // Antenna status updates
-    ESP_LOGD("UI_Screen2", "Registering antenna observers");
-    lv_subject_add_observer_obj(&radio_antenna_state_subject, ui_antenna_state_observer_cb, ui_Screen2, NULL);
-    lv_subject_add_observer_obj(&radio_antenna_names_subject, ui_antenna_names_observer_cb, ui_Screen2, NULL);
-    ESP_LOGD("UI_Screen2", "Antenna observers registered successfully");
-
-    // Request CW menu values once UI observers are ready
-    cat_request_cw_menu_update();
-    
-    // Check WebSocket connection status during init
+    // Fetch current antenna state now that there are buttons to show it
     bool ws_connected = websocket_client_is_connected();
-    ESP_LOGI("UI_Screen2", "WebSocket connection status during init: %s", ws_connected ? "CONNECTED" : "DISCONNECTED");
+    ESP_LOGI("UI_Screen2", "WebSocket connection status: %s", ws_connected ? "CONNECTED" : "DISCONNECTED");
     
     // If WebSocket is connected, actively request antenna status and subscribe to events
     if (ws_connected) {
@@ -1880,18 +1727,246 @@ void ui_Screen2_screen_init(void) {
     } else {
         ESP_LOGW("UI_Screen2", "WebSocket not connected - cannot request antenna status");
     }
-    
-    // Note: Legacy test message for LVGL messaging verification removed
-    // Antenna state is now managed via observer pattern (radio_antenna_state_subject)
+}
+
+// Macros page
+static void ui_build_macros_page(void)
+{
+    ui_macro_populate_list();
+}
+
+// System page
+static void ui_build_system_page(void)
+{
+    lv_obj_t *sec_sys = lv_menu_section_create(ui_MenuPageSystem);
+    lv_obj_set_style_bg_color(ui_MenuPageSystem, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(sec_sys, ui_sx(20), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // Reboot button with icon
+    lv_obj_t *row_reboot = create_button(sec_sys, NULL, "System", "Restart");
+    ui_RebootButton = lv_obj_get_child(row_reboot, -1); // Get the button from the container
+    lv_obj_set_style_bg_color(ui_RebootButton, lv_color_hex(COLOR_RED_LIGHT), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(ui_RebootButton, lv_color_hex(0xFF6666), LV_PART_MAIN | LV_STATE_PRESSED);
+    lv_obj_add_event_cb(ui_RebootButton, ui_event_RebootButton, LV_EVENT_CLICKED, NULL);
+}
+
+void ui_Screen2_screen_init(void) {
+    
+    // If already created, avoid rebuilding to keep init work minimal
+    if (ui_Screen2 && lv_obj_is_valid(ui_Screen2)) {
+        ESP_LOGI("UI_Screen2", "Screen2 already exists - skipping init");
+        return;
+    }
+    
+    ESP_LOGI("UI_Screen2", "Creating Screen2 UI elements...");
+    int64_t start_us = esp_timer_get_time();
+    size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    // Base screen
+    ui_Screen2 = lv_obj_create(NULL);
+    lv_obj_remove_flag(ui_Screen2, (lv_obj_flag_t)(LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC | LV_OBJ_FLAG_SCROLL_MOMENTUM));
+    // Match Screen1 palette: keep a deep background for content area
+    lv_obj_set_style_bg_color(ui_Screen2, lv_color_hex(0x101418), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(ui_Screen2, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // Create a full-screen opaque background panel to prevent Screen1 bleed-through
+    // This sits behind the menu and ensures complete coverage without modifying menu styling
+    lv_obj_t *bg_panel = lv_obj_create(ui_Screen2);
+    lv_obj_remove_style_all(bg_panel);
+    lv_obj_set_size(bg_panel, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_color(bg_panel, lv_color_hex(0x101418), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(bg_panel, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_remove_flag(bg_panel, LV_OBJ_FLAG_SCROLLABLE);
+
+    // Create LVGL Complex Menu
+    ESP_LOGI("UI_Screen2", "Creating menu on Screen2=%p", (void*)ui_Screen2);
+    ui_Menu = lv_menu_create(ui_Screen2);
+    ESP_LOGI("UI_Screen2", "Menu created: ui_Menu=%p", (void*)ui_Menu);
+
+    if (ui_Menu == NULL) {
+        ESP_LOGE("UI_Screen2", "FATAL: lv_menu_create returned NULL!");
+        return;
+    }
+
+    // DEBUG: Check menu internal structure
+    lv_menu_t* menu_priv = (lv_menu_t*)ui_Menu;
+    ESP_LOGI("UI_Screen2", "Menu internals: storage=%p main=%p main_header=%p",
+             (void*)menu_priv->storage, (void*)menu_priv->main, (void*)menu_priv->main_header);
+
+    lv_obj_set_size(ui_Menu, LV_PCT(100), LV_PCT(100));
+    lv_obj_center(ui_Menu);
+    lv_menu_set_mode_header(ui_Menu, LV_MENU_HEADER_TOP_FIXED);
+    // Enable proper LVGL menu back button instead of custom overlay
+    lv_menu_set_mode_root_back_button(ui_Menu, LV_MENU_ROOT_BACK_BUTTON_ENABLED);
+    lv_obj_add_event_cb(ui_Menu, back_event_handler, LV_EVENT_CLICKED, ui_Menu);
+
+    // Style the menu header and back button properly
+    lv_obj_t *header = lv_menu_get_main_header(ui_Menu);
+    ESP_LOGI("UI_Screen2", "Got menu header: header=%p", (void*)header);
+    lv_obj_set_style_bg_color(header, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(header, lv_color_hex(COLOR_TEXT), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // Set header font that supports LVGL symbols (for back button arrow LV_SYMBOL_LEFT)
+    lv_obj_set_style_text_font(header, ui_symbol_font_lg(), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // Ensure the menu inherits the main background for the content panel
+    lv_obj_set_style_bg_color(ui_Menu, lv_color_hex(0x101418), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(ui_Menu, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // Create root page with proper sidebar styling
+    ESP_LOGI("UI_Screen2", "About to create menu page with ui_Menu=%p", (void*)ui_Menu);
+    lv_obj_t *root = lv_menu_page_create(ui_Menu, "Settings");
+    lv_obj_set_style_pad_hor(root, lv_obj_get_style_pad_left(lv_menu_get_main_header(ui_Menu), LV_PART_MAIN), 0);
+
+    // Enhanced sidebar styling with width for text content
+    lv_obj_set_width(root, ui_sx(225)); // Wider for better text spacing
+    lv_obj_set_scroll_dir(root, LV_DIR_VER); // Disable horizontal scrolling on sidebar
+
+    // Clean sidebar styling without border
+    lv_obj_set_style_bg_color(root, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(root, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(root, 0, LV_PART_MAIN | LV_STATE_DEFAULT);  // Remove blue border
+    lv_obj_set_style_shadow_width(root, 8, LV_PART_MAIN | LV_STATE_DEFAULT);  // Subtle shadow
+    lv_obj_set_style_shadow_color(root, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);  // Dark shadow
+    lv_obj_set_style_shadow_opa(root, 30, LV_PART_MAIN | LV_STATE_DEFAULT);   // Subtle opacity
+    lv_obj_set_style_radius(root, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    lv_obj_t *root_sec = lv_menu_section_create(root);
+    // Add padding for better spacing
+    lv_obj_set_style_pad_all(root_sec, ui_sx(15), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_top(root, ui_sy(18), 0);      // extra space above the first section
+    lv_obj_set_style_pad_top(root_sec, ui_sy(18), 0);  // and above the section contents
+
+    // Sub pages; their contents are built by ui_settings_build_page
+    ui_MenuPageDisplay = lv_menu_page_create(ui_Menu, "Display");
+    ui_MenuPageRadioMenu = lv_menu_page_create(ui_Menu, "Radio Menu");
+    ui_MenuPageCat = lv_menu_page_create(ui_Menu, "CAT & Transverter");
+    ui_MenuPageMeter = lv_menu_page_create(ui_Menu, "Meter");
+    ui_MenuPageAntennas = lv_menu_page_create(ui_Menu, "Antennas");
+    ui_MenuPageMacros = lv_menu_page_create(ui_Menu, "Macros");
+    ui_MenuPageSystem = lv_menu_page_create(ui_Menu, "System");
+
+    // Disable horizontal scrolling on all menu pages to prevent unwanted shifts
+    lv_obj_set_scroll_dir(ui_MenuPageDisplay, LV_DIR_VER);
+    lv_obj_set_scroll_dir(ui_MenuPageRadioMenu, LV_DIR_VER);
+    lv_obj_set_scroll_dir(ui_MenuPageCat, LV_DIR_VER);
+    lv_obj_set_scroll_dir(ui_MenuPageMeter, LV_DIR_VER);
+    lv_obj_set_scroll_dir(ui_MenuPageAntennas, LV_DIR_VER);
+    lv_obj_set_scroll_dir(ui_MenuPageMacros, LV_DIR_VER);
+    lv_obj_set_scroll_dir(ui_MenuPageSystem, LV_DIR_VER);
+
+    // Create sidebar menu items with themed colored LVGL symbols
+    lv_obj_t *it_display = create_text_colored(root_sec, LV_SYMBOL_IMAGE, "Display", COLOR_AQUA_LIGHT);
+    ui_settings_bind_page(it_display, UI_SETTINGS_PAGE_DISPLAY);
+
+    lv_obj_t *it_radio_menu = create_text_colored(root_sec, LV_SYMBOL_AUDIO, "Radio Menu", COLOR_ORANGE_VIBRANT);
+    ui_settings_bind_page(it_radio_menu, UI_SETTINGS_PAGE_RADIO_MENU);
+
+    lv_obj_t *it_cat = create_text_colored(root_sec, LV_SYMBOL_LIST, "CAT & Transverter", COLOR_SELECTIVE_YELLOW);
+    ui_settings_bind_page(it_cat, UI_SETTINGS_PAGE_CAT);
+
+    lv_obj_t *it_meter = create_text_colored(root_sec, LV_SYMBOL_BARS, "Meter", COLOR_SUCCESS_GREEN);
+    ui_settings_bind_page(it_meter, UI_SETTINGS_PAGE_METER);
+
+    lv_obj_t *it_antennas = create_text_colored(root_sec, LV_SYMBOL_WIFI, "Antennas", COLOR_PURPLE_ACCENT);
+    ui_settings_bind_page(it_antennas, UI_SETTINGS_PAGE_ANTENNAS);
+
+    lv_obj_t *it_macros = create_text_colored(root_sec, LV_SYMBOL_SHUFFLE, "Macros", COLOR_SELECTIVE_YELLOW);
+    ui_settings_bind_page(it_macros, UI_SETTINGS_PAGE_MACROS);
+
+    lv_obj_t *it_system = create_text_colored(root_sec, LV_SYMBOL_SETTINGS, "System", COLOR_ARGENTINIAN_BLUE);
+    ui_settings_bind_page(it_system, UI_SETTINGS_PAGE_SYSTEM);
+
+    // Set the sidebar and default main page
+    lv_menu_set_sidebar_page(ui_Menu, root);
+    lv_menu_set_page(ui_Menu, ui_MenuPageDisplay);
+
+    // Disable horizontal scrolling on menu and its internal components to prevent
+    // unwanted horizontal shifts when interacting with switches/buttons
+    lv_obj_set_scroll_dir(ui_Menu, LV_DIR_VER);
+    if (menu_priv->main) {
+        lv_obj_set_scroll_dir(menu_priv->main, LV_DIR_VER);
+    }
+    if (menu_priv->sidebar) {
+        lv_obj_set_scroll_dir(menu_priv->sidebar, LV_DIR_VER);
+    }
+
+    // Style the sidebar header
+    lv_obj_t *sidebar_header = lv_menu_get_sidebar_header(ui_Menu);
+    if (sidebar_header) {
+        lv_obj_set_style_pad_ver(sidebar_header, ui_sy(12), LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_pad_hor(sidebar_header, ui_sx(15), LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_bg_color(sidebar_header, lv_color_hex(COLOR_BG_DARK), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+        // Find the existing "Settings" label created by lv_menu and style it
+        lv_obj_t *header_label = lv_obj_get_child(sidebar_header, 0);
+        if (header_label && lv_obj_check_type(header_label, &lv_label_class)) {
+            lv_obj_set_style_text_font(header_label, ui_font30(), LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_set_style_text_color(header_label, lv_color_hex(COLOR_TEXT), LV_PART_MAIN | LV_STATE_DEFAULT);
+        }
+    }
+
+#if CONFIG_UI_SETTINGS_AT_BOOT
+    for (int i = 0; i < UI_SETTINGS_PAGE_COUNT; i++) {
+        ui_settings_build_page((ui_settings_page_id_t)i);
+    }
+#else
+    // Other pages are built when first selected in the sidebar
+    ui_settings_build_page(UI_SETTINGS_PAGE_DISPLAY);
+#endif
+
+    // NVS save task DISABLED due to ESP32-S3 RGB LCD hardware limitation
+    // Flash writes cause display corruption regardless of timing/batching
+    // See: https://github.com/espressif/esp-idf/issues/10010
+    // Settings will not persist across reboots
+    ESP_LOGW("UI_Screen2", "NVS save disabled - settings won't persist (display stability)");
+
+    // Subscribe to messages (LVGL 9 native observers only - legacy removed)
+    // Transverter state updates
+    lv_subject_add_observer_obj(&radio_transverter_state_subject, ui_transverter_observer_cb, ui_Screen2, NULL);
+    lv_subject_add_observer_obj(&radio_transverter_xo_subject, ui_transverter_observer_cb, ui_Screen2, NULL);
+    lv_subject_add_observer_obj(&radio_transverter_ex056_subject, ui_transverter_observer_cb, ui_Screen2, NULL);
+
+    // CAT polling state updates
+    lv_subject_add_observer_obj(&radio_cat_polling_state_subject, ui_polling_observer_cb, ui_Screen2, NULL);
+
+    // Display refresh notifications
+    lv_subject_add_observer_obj(&radio_force_refresh_subject, ui_display_refresh_observer_cb, ui_Screen2, NULL);
+
+    // Backlight level updates
+    lv_subject_add_observer_obj(&radio_backlight_subject, ui_backlight_observer_cb, ui_Screen2, NULL);
+
+    // CW menu updates
+    lv_subject_add_observer_obj(&radio_cw_sidetone_volume_subject, ui_cw_sidetone_observer_cb, ui_Screen2, NULL);
+    lv_subject_add_observer_obj(&radio_cw_pitch_hz_subject, ui_cw_pitch_observer_cb, ui_Screen2, NULL);
+    lv_subject_add_observer_obj(&radio_fm_mic_gain_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_fm_mic_gain);
+    lv_subject_add_observer_obj(&radio_usb_input_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_usb_input);
+    lv_subject_add_observer_obj(&radio_usb_output_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_usb_output);
+    lv_subject_add_observer_obj(&radio_acc2_input_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_acc2_input);
+    lv_subject_add_observer_obj(&radio_acc2_output_level_subject, ui_radio_menu_observer_cb, ui_Screen2, &g_radio_menu_acc2_output);
+
+    // XVTR Offset Mix toggle updates
+    lv_subject_add_observer_obj(&radio_xvtr_offset_mix_subject, ui_xvtr_offset_mix_observer_cb, ui_Screen2, NULL);
+
+    // Transverter toggle updates
+    lv_subject_add_observer_obj(&radio_transverter_enabled_subject, ui_transverter_enabled_observer_cb, ui_Screen2, NULL);
+
+    // Antenna status updates
+    ESP_LOGD("UI_Screen2", "Registering antenna observers");
+    lv_subject_add_observer_obj(&radio_antenna_state_subject, ui_antenna_state_observer_cb, ui_Screen2, NULL);
+    lv_subject_add_observer_obj(&radio_antenna_names_subject, ui_antenna_names_observer_cb, ui_Screen2, NULL);
+    ESP_LOGD("UI_Screen2", "Antenna observers registered successfully");
+
+    
+    // Note: Legacy test message for LVGL messaging verification removed
+    // Antenna state is now managed via observer pattern (radio_antenna_state_subject)
     ESP_LOGD("UI_Screen2", "Menu UI initialization complete");
 
     // Initialize background NVS save task and queue (DISABLED - causes heap corruption)
     ESP_LOGW("UI_Screen2", "NVS save task creation DISABLED - settings will not persist");
 
-    // Mark deferred build as complete since we built everything immediately
-    ui_MenuDeferredBuilt = true;
-
-    ESP_LOGI("UI_Screen2", "Menu UI initialized successfully");
+    ESP_LOGI("UI_Screen2", "Menu UI initialized in %lu us, heap %ld bytes",
+             (unsigned long)(esp_timer_get_time() - start_us),
+             (long)heap_before - (long)heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
 }
 
 // Helper function to update antenna button states based on WebSocket status
@@ -2135,6 +2210,74 @@ void ui_Screen2_screen_destroy(void) {
     ui_PepToggleSwitch = NULL;
     ui_SMeterAveragingSwitch = NULL;
     ui_RebootButton = NULL;
+    ui_ScreensaverButton = NULL;
+    ui_ScreensaverLabel = NULL;
+    ui_CwSidetoneSlider = NULL;
+    ui_CwSidetoneValueLabel = NULL;
+    ui_CwPitchSlider = NULL;
+    ui_CwPitchValueLabel = NULL;
+    ui_FmMicGainSlider = NULL;
+    ui_FmMicGainValueLabel = NULL;
+    ui_UsbAudioInputSlider = NULL;
+    ui_UsbAudioInputValueLabel = NULL;
+    ui_UsbAudioOutputSlider = NULL;
+    ui_UsbAudioOutputValueLabel = NULL;
+    ui_Acc2InputSlider = NULL;
+    ui_Acc2InputValueLabel = NULL;
+    ui_Acc2OutputSlider = NULL;
+    ui_Acc2OutputValueLabel = NULL;
+    ui_TransverterButton = NULL;
+    ui_AntennaSwitchButton = NULL;
+    ui_PanelDataButton = NULL;
+
+    // Menu and pages; the next ui_Screen2_screen_init starts from empty pages
+    ui_Menu = NULL;
+    for (int i = 0; i < UI_SETTINGS_PAGE_COUNT; i++) {
+        *ui_settings_pages[i].page = NULL;
+        ui_settings_pages[i].built = false;
+    }
+
+    radio_menu_slider_t *radio_items[] = {&g_radio_menu_fm_mic_gain, &g_radio_menu_usb_input, &g_radio_menu_usb_output,
+                                          &g_radio_menu_acc2_input, &g_radio_menu_acc2_output};
+    for (size_t i = 0; i < sizeof(radio_items) / sizeof(radio_items[0]); i++) {
+        radio_items[i]->slider = NULL;
+        radio_items[i]->value_label = NULL;
+    }
+
+    memset(g_antenna_buttons, 0, sizeof(g_antenna_buttons));
+    g_antenna_cache.cache_valid = false;
+
+    // Macro rows, editor and popups were children of the screen
+    memset(ui_macro_rows, 0, sizeof(ui_macro_rows));
+    ui_macro_row_pool = 0;
+    ui_macro_list_end = NULL;
+    memset(&macro_editor, 0, sizeof(macro_editor));
+    delete_confirm_popup = NULL;
+    ui_macro_selected_index = -1;
+}
+
+#if CONFIG_UI_SETTINGS_LAZY_FREE
+// Runs after the click that left Screen2 has finished dispatching
+static void ui_Screen2_free_async_cb(void *user_data)
+{
+    LV_UNUSED(user_data);
+    if (ui_Screen2 == NULL || ui_Screen2 == lv_screen_active()) {
+        return;
+    }
+
+    size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    ui_Screen2_screen_destroy();
+    ESP_LOGI("UI_Screen2", "Screen2 freed, heap %ld bytes",
+             (long)heap_caps_get_free_size(MALLOC_CAP_DEFAULT) - (long)heap_before);
+}
+#endif
+
+// Called after switching back to Screen1
+static void ui_Screen2_leave(void)
+{
+#if CONFIG_UI_SETTINGS_LAZY_FREE
+    lv_async_call(ui_Screen2_free_async_cb, NULL);
+#endif
 }
 
 
@@ -2433,7 +2576,6 @@ void ui_macro_hide_fkey_popup(void)
 // ============================================================================
 
 static uint8_t delete_confirm_macro_id = 0;
-static lv_obj_t *delete_confirm_popup = NULL;
 
 static void ui_macro_delete_confirm_cb(lv_event_t *e)
 {
@@ -2553,18 +2695,21 @@ static void ui_macro_keyboard_event_cb(lv_event_t *e)
 void ui_macro_start_inline_edit(int cache_index, bool edit_name)
 {
     if (cache_index < 0 || cache_index >= ui_macro_count) return;
+    if (ui_macro_cache[cache_index].truncated) {
+        // Either field is saved with the other, so a cut-short command would overwrite the radio's
+        ESP_LOGW(TAG, "Macro %d is too long to edit here (name max %d, command max %d chars)",
+                 ui_macro_cache[cache_index].id, MACRO_NAME_MAX - 1, MACRO_COMMAND_MAX - 1);
+        return;
+    }
 
     macro_editor.editing_macro_id = ui_macro_cache[cache_index].id;
     macro_editor.is_editing = true;
     macro_editor.editing_name = edit_name;
-    ui_macro_selected_index = cache_index;
 
     ui_macro_item_t *macro = &ui_macro_cache[cache_index];
 
     // Highlight selected row before showing overlay
-    if (macro->row_container) {
-        lv_obj_set_style_bg_color(macro->row_container, lv_color_hex(MACRO_COLOR_ROW_SELECTED), 0);
-    }
+    ui_macro_select(cache_index);
 
     // Create dual-pane overlay: top 50% = context, bottom 50% = textarea + keyboard
     if (!macro_editor.edit_overlay) {
@@ -2756,7 +2901,9 @@ static void ui_macro_inline_save(void)
     char cmd_buf[256];
     snprintf(cmd_buf, sizeof(cmd_buf), "MXW%02d,%s,%s;", macro->id, macro->name, macro->command);
     ESP_LOGI(TAG, "Saving macro: %s", cmd_buf);
-    uart_write_message(cmd_buf);
+    if (uart_write_message(cmd_buf) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to send macro %02d to radio", macro->id);
+    }
 
     ui_macro_end_inline_edit(true);
 }
@@ -2780,13 +2927,7 @@ void ui_macro_end_inline_edit(bool save)
     }
 
     // Reset row color
-    if (ui_macro_selected_index >= 0 && ui_macro_selected_index < ui_macro_count) {
-        ui_macro_item_t *macro = &ui_macro_cache[ui_macro_selected_index];
-        if (macro->row_container) {
-            lv_obj_set_style_bg_color(macro->row_container, lv_color_hex(MACRO_COLOR_ROW_BG), 0);
-        }
-    }
-    ui_macro_selected_index = -1;
+    ui_macro_select(-1);
 
     ui_macro_refresh_list();
 }
@@ -2804,6 +2945,10 @@ void ui_macro_set_cached(uint8_t id, const char *name, const char *cmd)
 
     // Skip empty/undefined macros (empty name means slot is not defined)
     bool is_empty = (!name || name[0] == '\0');
+    bool truncated = !is_empty && (strlen(name) >= MACRO_NAME_MAX || (cmd && strlen(cmd) >= MACRO_COMMAND_MAX));
+    if (truncated) {
+        ESP_LOGW(TAG, "Macro %d is longer than the editor holds, shown read-only", id);
+    }
 
     // Check if already cached
     for (int i = 0; i < ui_macro_count; i++) {
@@ -2822,6 +2967,7 @@ void ui_macro_set_cached(uint8_t id, const char *name, const char *cmd)
                 ui_macro_cache[i].name[MACRO_NAME_MAX - 1] = '\0';
                 strncpy(ui_macro_cache[i].command, cmd, MACRO_COMMAND_MAX - 1);
                 ui_macro_cache[i].command[MACRO_COMMAND_MAX - 1] = '\0';
+                ui_macro_cache[i].truncated = truncated;
             }
             return;
         }
@@ -2840,7 +2986,7 @@ void ui_macro_set_cached(uint8_t id, const char *name, const char *cmd)
         ui_macro_cache[ui_macro_count].name[MACRO_NAME_MAX - 1] = '\0';
         strncpy(ui_macro_cache[ui_macro_count].command, cmd, MACRO_COMMAND_MAX - 1);
         ui_macro_cache[ui_macro_count].command[MACRO_COMMAND_MAX - 1] = '\0';
-        ui_macro_cache[ui_macro_count].row_container = NULL;
+        ui_macro_cache[ui_macro_count].truncated = truncated;
         ui_macro_count++;
         ui_macro_sort_cache();
     }
@@ -2878,49 +3024,31 @@ void ui_macro_set_fkey_assignment(uint8_t fkey, uint8_t macro_id)
 
 static void ui_macro_row_fkey_cb(lv_event_t *e)
 {
-    lv_obj_t *target = static_cast<lv_obj_t *>(lv_event_get_target(e));
-    uint8_t macro_id = (uintptr_t)lv_obj_get_user_data(target);
+    const ui_macro_row_t *r = (const ui_macro_row_t *)lv_event_get_user_data(e);
+    if (r->index < 0 || r->index >= ui_macro_count) return;
+    uint8_t macro_id = ui_macro_cache[r->index].id;
     ESP_LOGI(TAG, "F-key column clicked for macro %d", macro_id);
     ui_macro_show_fkey_popup(macro_id);
 }
 
 static void ui_macro_row_name_cb(lv_event_t *e)
 {
-    lv_obj_t *target = static_cast<lv_obj_t *>(lv_event_get_target(e));
-    int cache_idx = (intptr_t)lv_obj_get_user_data(target);
-    ESP_LOGI(TAG, "Name column clicked for cache index %d", cache_idx);
-    ui_macro_start_inline_edit(cache_idx, true);
+    const ui_macro_row_t *r = (const ui_macro_row_t *)lv_event_get_user_data(e);
+    ESP_LOGI(TAG, "Name column clicked for cache index %d", r->index);
+    ui_macro_start_inline_edit(r->index, true);
 }
 
 static void ui_macro_row_cmd_cb(lv_event_t *e)
 {
-    lv_obj_t *target = static_cast<lv_obj_t *>(lv_event_get_target(e));
-    int cache_idx = (intptr_t)lv_obj_get_user_data(target);
-    ESP_LOGI(TAG, "Command column clicked for cache index %d", cache_idx);
-    ui_macro_start_inline_edit(cache_idx, false);
+    const ui_macro_row_t *r = (const ui_macro_row_t *)lv_event_get_user_data(e);
+    ESP_LOGI(TAG, "Command column clicked for cache index %d", r->index);
+    ui_macro_start_inline_edit(r->index, false);
 }
 
 static void ui_macro_row_select_cb(lv_event_t *e)
 {
-    lv_obj_t *target = static_cast<lv_obj_t *>(lv_event_get_target(e));
-    int cache_idx = (intptr_t)lv_obj_get_user_data(target);
-
-    // Deselect previous
-    if (ui_macro_selected_index >= 0 && ui_macro_selected_index < ui_macro_count) {
-        if (ui_macro_cache[ui_macro_selected_index].row_container) {
-            lv_obj_set_style_bg_color(ui_macro_cache[ui_macro_selected_index].row_container,
-                                       lv_color_hex(MACRO_COLOR_ROW_BG), 0);
-        }
-    }
-
-    // Select new
-    ui_macro_selected_index = cache_idx;
-    if (cache_idx >= 0 && cache_idx < ui_macro_count) {
-        if (ui_macro_cache[cache_idx].row_container) {
-            lv_obj_set_style_bg_color(ui_macro_cache[cache_idx].row_container,
-                                       lv_color_hex(MACRO_COLOR_ROW_SELECTED), 0);
-        }
-    }
+    const ui_macro_row_t *r = (const ui_macro_row_t *)lv_event_get_user_data(e);
+    ui_macro_select(r->index);
 }
 
 // ============================================================================
@@ -2992,14 +3120,8 @@ static void ui_macro_nav_sidebar_cb(lv_event_t *e)
 static void ui_macro_nav_refresh_cb(lv_event_t *e)
 {
     ESP_LOGI(TAG, "Refreshing macros from panel");
-    // Query panel for latest macro data using MX protocol
-    uart_write_message("MXA;");  // Get F-key assignments
-    // Query all macros individually (no list command in MX protocol)
-    for (int i = 1; i <= 50; i++) {
-        char cmd[16];
-        snprintf(cmd, sizeof(cmd), "MXR%02d;", i);
-        uart_write_message(cmd);
-    }
+    // Query panel for F-key assignments and every macro slot (no list command in MX protocol)
+    cat_polling_request_macros();
 }
 
 static void ui_macro_nav_delete_cb(lv_event_t *e)
@@ -3011,6 +3133,214 @@ static void ui_macro_nav_delete_cb(lv_event_t *e)
     }
 }
 
+// ============================================================================
+// ROW POOL - VIRTUALIZED TABLE
+// ============================================================================
+
+// Setters that skip unchanged values, so rebinding a row whose macro did not
+// change does not invalidate it
+static void ui_macro_set_label(lv_obj_t *label, const char *text)
+{
+    if (strcmp(lv_label_get_text(label), text) != 0) {
+        lv_label_set_text(label, text);
+    }
+}
+
+static void ui_macro_set_bg(lv_obj_t *obj, uint32_t color)
+{
+    if (!lv_color_eq(lv_obj_get_style_bg_color(obj, LV_PART_MAIN), lv_color_hex(color))) {
+        lv_obj_set_style_bg_color(obj, lv_color_hex(color), 0);
+    }
+}
+
+static void ui_macro_set_text_color(lv_obj_t *obj, uint32_t color)
+{
+    if (!lv_color_eq(lv_obj_get_style_text_color(obj, LV_PART_MAIN), lv_color_hex(color))) {
+        lv_obj_set_style_text_color(obj, lv_color_hex(color), 0);
+    }
+}
+
+// Show cache entry `index` in a pooled row, or hide the row if out of range
+static void ui_macro_bind_row(ui_macro_row_t *r, int index)
+{
+    if (index < 0 || index >= ui_macro_count) {
+        r->index = -1;
+        if (!lv_obj_has_flag(r->row, LV_OBJ_FLAG_HIDDEN)) {
+            lv_obj_add_flag(r->row, LV_OBJ_FLAG_HIDDEN);
+        }
+        return;
+    }
+
+    const ui_macro_item_t *macro = &ui_macro_cache[index];
+    char txt[8];
+
+    r->index = index;
+    lv_obj_set_y(r->row, ui_macro_rows_y0 + index * ui_macro_row_pitch);
+    if (lv_obj_has_flag(r->row, LV_OBJ_FLAG_HIDDEN)) {
+        lv_obj_remove_flag(r->row, LV_OBJ_FLAG_HIDDEN);
+    }
+    ui_macro_set_bg(r->row, index == ui_macro_selected_index ? MACRO_COLOR_ROW_SELECTED : MACRO_COLOR_ROW_BG);
+
+    snprintf(txt, sizeof(txt), "%d", macro->id);
+    ui_macro_set_label(r->id_lbl, txt);
+
+    bool assigned = macro->fkey > 0 && macro->fkey <= MACRO_FKEY_SLOTS;
+    if (assigned) {
+        snprintf(txt, sizeof(txt), "F%d", macro->fkey);
+    }
+    ui_macro_set_label(r->fkey_lbl, assigned ? txt : "--");
+    ui_macro_set_bg(r->fkey_btn, assigned ? MACRO_COLOR_FKEY_ACTIVE : MACRO_COLOR_FKEY_EMPTY);
+    ui_macro_set_text_color(r->fkey_lbl, assigned ? 0xFFFFFF : 0x999999);
+
+    ui_macro_set_label(r->name_lbl, macro->name);
+
+    bool has_cmd = macro->command[0] != '\0';
+    ui_macro_set_label(r->cmd_lbl, has_cmd ? macro->command : "(tap to edit)");
+    ui_macro_set_text_color(r->cmd_lbl, has_cmd ? 0xBBBBBB : 0x666666);
+}
+
+// Bind the pool to the rows around the scroll position. Index i always uses
+// slot i % pool, so scrolling by one row rebinds one slot.
+static void ui_macro_update_visible_rows(bool rebind_all)
+{
+    lv_obj_t *table = macro_editor.table_container;
+    if (table == NULL || ui_macro_row_pool == 0) return;
+
+    int32_t first = (lv_obj_get_scroll_y(table) - ui_macro_rows_y0) / ui_macro_row_pitch - MACRO_ROW_MARGIN;
+    if (first < 0) first = 0;
+
+    for (int i = first; i < first + ui_macro_row_pool; i++) {
+        ui_macro_row_t *r = &ui_macro_rows[i % ui_macro_row_pool];
+        if (rebind_all || r->index != i) {
+            ui_macro_bind_row(r, i);
+        }
+    }
+}
+
+static void ui_macro_table_scroll_cb(lv_event_t *e)
+{
+    (void)e;
+    ui_macro_update_visible_rows(false);
+}
+
+// Re-read the cache after it changed: resize the scroll range and rebind the
+// pooled rows in place
+static void ui_macro_list_sync(void)
+{
+    lv_obj_t *table = macro_editor.table_container;
+    if (table == NULL) return;
+
+    int32_t end_y = ui_macro_rows_y0 + ui_macro_count * ui_macro_row_pitch;
+    lv_obj_set_y(ui_macro_list_end, end_y > 0 ? end_y - 1 : 0);
+    lv_obj_update_layout(table);
+    lv_obj_readjust_scroll(table, LV_ANIM_OFF);  // Clamp if the list got shorter
+
+    ui_macro_update_visible_rows(true);
+}
+
+static void ui_macro_rebind_index(int index)
+{
+    if (index < 0 || ui_macro_row_pool == 0) return;
+    ui_macro_row_t *r = &ui_macro_rows[index % ui_macro_row_pool];
+    if (r->index == index) {
+        ui_macro_bind_row(r, index);
+    }
+}
+
+// Move the selection highlight (-1 = none)
+static void ui_macro_select(int cache_index)
+{
+    int old_index = ui_macro_selected_index;
+    ui_macro_selected_index = (cache_index >= 0 && cache_index < ui_macro_count) ? cache_index : -1;
+    ui_macro_rebind_index(old_index);
+    ui_macro_rebind_index(ui_macro_selected_index);
+}
+
+// Create one pooled row with the column layout of the table header
+static void ui_macro_create_row(lv_obj_t *table_area, ui_macro_row_t *r)
+{
+    r->index = -1;
+
+    lv_obj_t *row = lv_obj_create(table_area);
+    lv_obj_set_size(row, LV_PCT(100), MACRO_ROW_H);
+    lv_obj_set_style_bg_color(row, lv_color_hex(MACRO_COLOR_ROW_BG), 0);
+    lv_obj_set_style_radius(row, 0, 0);
+    lv_obj_set_style_border_width(row, 1, 0);
+    lv_obj_set_style_border_color(row, lv_color_hex(0x505050), 0);
+    lv_obj_set_style_border_side(row, LV_BORDER_SIDE_BOTTOM, 0);
+    lv_obj_set_style_pad_left(row, ui_sx(8), 0);
+    lv_obj_set_style_pad_right(row, ui_sx(4), 0);
+    lv_obj_set_style_pad_top(row, ui_sy(4), 0);
+    lv_obj_set_style_pad_bottom(row, ui_sy(4), 0);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_remove_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(row, ui_macro_row_select_cb, LV_EVENT_CLICKED, r);
+    r->row = row;
+
+    // Column 1: ID
+    r->id_lbl = lv_label_create(row);
+    lv_label_set_text(r->id_lbl, "");
+    lv_obj_set_style_text_color(r->id_lbl, lv_color_hex(0x888888), 0);
+    lv_obj_set_style_text_font(r->id_lbl, ui_font16(), 0);
+    lv_obj_set_width(r->id_lbl, MACRO_COL_ID_W);
+
+    // Column 2: F-key button
+    r->fkey_btn = lv_button_create(row);
+    lv_obj_set_size(r->fkey_btn, MACRO_COL_FKEY_W, MACRO_ROW_H - ui_sy(8));
+    lv_obj_set_style_radius(r->fkey_btn, 4, 0);
+    lv_obj_set_style_pad_all(r->fkey_btn, 0, 0);
+    lv_obj_add_event_cb(r->fkey_btn, ui_macro_row_fkey_cb, LV_EVENT_CLICKED, r);
+
+    r->fkey_lbl = lv_label_create(r->fkey_btn);
+    lv_label_set_text(r->fkey_lbl, "");
+    lv_obj_set_style_text_font(r->fkey_lbl, ui_font16(), 0);
+    lv_obj_center(r->fkey_lbl);
+
+    // Column 3: Name (clickable button with visible background)
+    // Wider name column when sidebar is collapsed for more editing space
+    const int name_width = MACRO_COL_NAME_W;
+    lv_obj_t *name_btn = lv_button_create(row);
+    lv_obj_set_size(name_btn, name_width, MACRO_ROW_H - ui_sy(8));
+    lv_obj_set_style_bg_color(name_btn, lv_color_hex(0x3a3a3a), 0);
+    lv_obj_set_style_bg_color(name_btn, lv_color_hex(0x4a4a4a), LV_STATE_PRESSED);
+    lv_obj_set_style_radius(name_btn, 4, 0);
+    lv_obj_set_style_border_width(name_btn, 1, 0);
+    lv_obj_set_style_border_color(name_btn, lv_color_hex(0x555555), 0);
+    lv_obj_set_style_pad_left(name_btn, ui_sx(6), 0);
+    lv_obj_set_style_pad_right(name_btn, ui_sx(2), 0);
+    lv_obj_add_event_cb(name_btn, ui_macro_row_name_cb, LV_EVENT_CLICKED, r);
+
+    r->name_lbl = lv_label_create(name_btn);
+    lv_label_set_text(r->name_lbl, "");
+    lv_label_set_long_mode(r->name_lbl, LV_LABEL_LONG_CLIP);
+    lv_obj_set_width(r->name_lbl, name_width - ui_sx(12));
+    lv_obj_set_style_text_color(r->name_lbl, lv_color_hex(COLOR_SELECTIVE_YELLOW), 0);
+    lv_obj_set_style_text_font(r->name_lbl, ui_font16(), 0);
+    lv_obj_align(r->name_lbl, LV_ALIGN_LEFT_MID, 0, 0);
+
+    // Column 4: Command (flex, clickable button with visible background)
+    lv_obj_t *cmd_btn = lv_button_create(row);
+    lv_obj_set_flex_grow(cmd_btn, 1);
+    lv_obj_set_height(cmd_btn, MACRO_ROW_H - ui_sy(8));
+    lv_obj_set_style_bg_color(cmd_btn, lv_color_hex(0x2a2a2a), 0);
+    lv_obj_set_style_bg_color(cmd_btn, lv_color_hex(0x3a3a3a), LV_STATE_PRESSED);
+    lv_obj_set_style_radius(cmd_btn, 4, 0);
+    lv_obj_set_style_border_width(cmd_btn, 1, 0);
+    lv_obj_set_style_border_color(cmd_btn, lv_color_hex(0x444444), 0);
+    lv_obj_set_style_pad_left(cmd_btn, ui_sx(6), 0);
+    lv_obj_set_style_pad_right(cmd_btn, ui_sx(2), 0);
+    lv_obj_add_event_cb(cmd_btn, ui_macro_row_cmd_cb, LV_EVENT_CLICKED, r);
+
+    r->cmd_lbl = lv_label_create(cmd_btn);
+    lv_label_set_text(r->cmd_lbl, "");
+    lv_label_set_long_mode(r->cmd_lbl, LV_LABEL_LONG_CLIP);
+    lv_obj_set_width(r->cmd_lbl, LV_PCT(100));
+    lv_obj_set_style_text_font(r->cmd_lbl, ui_font16(), 0);
+    lv_obj_align(r->cmd_lbl, LV_ALIGN_LEFT_MID, 0, 0);
+}
+
 // ============================================================================
 // MAIN LIST POPULATION - KENWOOD STYLE TABLE
 // ============================================================================
@@ -3042,8 +3372,8 @@ void ui_macro_populate_list(void)
     lv_obj_set_style_bg_opa(table_area, LV_OPA_TRANSP, 0);
     lv_obj_set_style_border_width(table_area, 0, 0);
     lv_obj_set_style_pad_all(table_area, 0, 0);
-    lv_obj_set_flex_flow(table_area, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_scroll_dir(table_area, LV_DIR_VER);
+    lv_obj_add_event_cb(table_area, ui_macro_table_scroll_cb, LV_EVENT_SCROLL, NULL);
     macro_editor.table_container = table_area;
 
     // Header row with column labels
@@ -3109,106 +3439,21 @@ void ui_macro_populate_list(void)
         ui_macro_sort_cache();
     }
 
-    // Table rows
-    for (int i = 0; i < ui_macro_count; i++) {
-        ui_macro_item_t *macro = &ui_macro_cache[i];
-
-        lv_obj_t *row = lv_obj_create(table_area);
-        lv_obj_set_size(row, LV_PCT(100), MACRO_ROW_H);
-        lv_obj_set_style_bg_color(row, lv_color_hex(MACRO_COLOR_ROW_BG), 0);
-        lv_obj_set_style_radius(row, 0, 0);
-        lv_obj_set_style_border_width(row, 1, 0);
-        lv_obj_set_style_border_color(row, lv_color_hex(0x505050), 0);
-        lv_obj_set_style_border_side(row, LV_BORDER_SIDE_BOTTOM, 0);
-        lv_obj_set_style_pad_left(row, ui_sx(8), 0);
-        lv_obj_set_style_pad_right(row, ui_sx(4), 0);
-        lv_obj_set_style_pad_top(row, ui_sy(4), 0);
-        lv_obj_set_style_pad_bottom(row, ui_sy(4), 0);
-        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
-        lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-        lv_obj_remove_flag(row, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_set_user_data(row, (void*)(intptr_t)i);
-        lv_obj_add_event_cb(row, ui_macro_row_select_cb, LV_EVENT_CLICKED, NULL);
-        macro->row_container = row;
-
-        // Column 1: ID
-        lv_obj_t *id_lbl = lv_label_create(row);
-        char id_txt[4];
-        snprintf(id_txt, sizeof(id_txt), "%d", macro->id);
-        lv_label_set_text(id_lbl, id_txt);
-        lv_obj_set_style_text_color(id_lbl, lv_color_hex(0x888888), 0);
-        lv_obj_set_style_text_font(id_lbl, ui_font16(), 0);
-        lv_obj_set_width(id_lbl, MACRO_COL_ID_W);
-
-        // Column 2: F-key button
-        lv_obj_t *fkey_btn = lv_button_create(row);
-        lv_obj_set_size(fkey_btn, MACRO_COL_FKEY_W, MACRO_ROW_H - ui_sy(8));
-        lv_obj_set_style_radius(fkey_btn, 4, 0);
-        lv_obj_set_style_pad_all(fkey_btn, 0, 0);
-        lv_obj_set_user_data(fkey_btn, (void*)(uintptr_t)macro->id);
-        lv_obj_add_event_cb(fkey_btn, ui_macro_row_fkey_cb, LV_EVENT_CLICKED, NULL);
-
-        lv_obj_t *fkey_lbl = lv_label_create(fkey_btn);
-        if (macro->fkey > 0 && macro->fkey <= 6) {
-            char fkey_txt[4];
-            snprintf(fkey_txt, sizeof(fkey_txt), "F%d", macro->fkey);
-            lv_label_set_text(fkey_lbl, fkey_txt);
-            lv_obj_set_style_bg_color(fkey_btn, lv_color_hex(MACRO_COLOR_FKEY_ACTIVE), 0);
-            lv_obj_set_style_text_color(fkey_lbl, lv_color_hex(0xFFFFFF), 0);
-        } else {
-            lv_label_set_text(fkey_lbl, "--");
-            lv_obj_set_style_bg_color(fkey_btn, lv_color_hex(MACRO_COLOR_FKEY_EMPTY), 0);
-            lv_obj_set_style_text_color(fkey_lbl, lv_color_hex(0x999999), 0);
-        }
-        lv_obj_set_style_text_font(fkey_lbl, ui_font16(), 0);
-        lv_obj_center(fkey_lbl);
-
-        // Column 3: Name (clickable button with visible background)
-        // Wider name column when sidebar is collapsed for more editing space
-        const int name_width = MACRO_COL_NAME_W;
-        lv_obj_t *name_btn = lv_button_create(row);
-        lv_obj_set_size(name_btn, name_width, MACRO_ROW_H - ui_sy(8));
-        lv_obj_set_style_bg_color(name_btn, lv_color_hex(0x3a3a3a), 0);
-        lv_obj_set_style_bg_color(name_btn, lv_color_hex(0x4a4a4a), LV_STATE_PRESSED);
-        lv_obj_set_style_radius(name_btn, 4, 0);
-        lv_obj_set_style_border_width(name_btn, 1, 0);
-        lv_obj_set_style_border_color(name_btn, lv_color_hex(0x555555), 0);
-        lv_obj_set_style_pad_left(name_btn, ui_sx(6), 0);
-        lv_obj_set_style_pad_right(name_btn, ui_sx(2), 0);
-        lv_obj_set_user_data(name_btn, (void*)(intptr_t)i);
-        lv_obj_add_event_cb(name_btn, ui_macro_row_name_cb, LV_EVENT_CLICKED, NULL);
-
-        lv_obj_t *name_lbl = lv_label_create(name_btn);
-        lv_label_set_text(name_lbl, macro->name);
-        lv_label_set_long_mode(name_lbl, LV_LABEL_LONG_CLIP);
-        lv_obj_set_width(name_lbl, name_width - ui_sx(12));
-        lv_obj_set_style_text_color(name_lbl, lv_color_hex(COLOR_SELECTIVE_YELLOW), 0);
-        lv_obj_set_style_text_font(name_lbl, ui_font16(), 0);
-        lv_obj_align(name_lbl, LV_ALIGN_LEFT_MID, 0, 0);
-
-        // Column 4: Command (flex, clickable button with visible background)
-        lv_obj_t *cmd_btn = lv_button_create(row);
-        lv_obj_set_flex_grow(cmd_btn, 1);
-        lv_obj_set_height(cmd_btn, MACRO_ROW_H - ui_sy(8));
-        lv_obj_set_style_bg_color(cmd_btn, lv_color_hex(0x2a2a2a), 0);
-        lv_obj_set_style_bg_color(cmd_btn, lv_color_hex(0x3a3a3a), LV_STATE_PRESSED);
-        lv_obj_set_style_radius(cmd_btn, 4, 0);
-        lv_obj_set_style_border_width(cmd_btn, 1, 0);
-        lv_obj_set_style_border_color(cmd_btn, lv_color_hex(0x444444), 0);
-        lv_obj_set_style_pad_left(cmd_btn, ui_sx(6), 0);
-        lv_obj_set_style_pad_right(cmd_btn, ui_sx(2), 0);
-        lv_obj_set_user_data(cmd_btn, (void*)(intptr_t)i);
-        lv_obj_add_event_cb(cmd_btn, ui_macro_row_cmd_cb, LV_EVENT_CLICKED, NULL);
-
-        lv_obj_t *cmd_lbl = lv_label_create(cmd_btn);
-        lv_label_set_text(cmd_lbl, strlen(macro->command) > 0 ? macro->command : "(tap to edit)");
-        lv_label_set_long_mode(cmd_lbl, LV_LABEL_LONG_CLIP);
-        lv_obj_set_width(cmd_lbl, LV_PCT(100));
-        lv_obj_set_style_text_color(cmd_lbl, lv_color_hex(strlen(macro->command) > 0 ? 0xBBBBBB : 0x666666), 0);
-        lv_obj_set_style_text_font(cmd_lbl, ui_font16(), 0);
-        lv_obj_align(cmd_lbl, LV_ALIGN_LEFT_MID, 0, 0);
+    // Rows are positioned by index below the header; only the pool is created
+    ui_macro_row_pitch = MACRO_ROW_H + lv_obj_get_style_pad_row(table_area, LV_PART_MAIN);
+    ui_macro_rows_y0 = ui_sy(32) + lv_obj_get_style_pad_row(table_area, LV_PART_MAIN);
+    ui_macro_row_pool = (ui_sy(310) + ui_macro_row_pitch - 1) / ui_macro_row_pitch + 1 + 2 * MACRO_ROW_MARGIN;
+    if (ui_macro_row_pool > MACRO_ROW_POOL_MAX) ui_macro_row_pool = MACRO_ROW_POOL_MAX;
+    for (int i = 0; i < ui_macro_row_pool; i++) {
+        ui_macro_create_row(table_area, &ui_macro_rows[i]);
     }
 
+    ui_macro_list_end = lv_obj_create(table_area);
+    lv_obj_remove_style_all(ui_macro_list_end);
+    lv_obj_set_size(ui_macro_list_end, 1, 1);
+    lv_obj_remove_flag(ui_macro_list_end, LV_OBJ_FLAG_CLICKABLE);
+    ui_macro_list_sync();
+
     // ===== RIGHT: Navigation buttons (5 buttons) =====
     lv_obj_t *nav_panel = lv_obj_create(main_container);
     lv_obj_set_size(nav_panel, MACRO_NAV_BTN_W, ui_sy(310));  // 6 buttons @ 48px + gaps
@@ -3298,20 +3543,9 @@ void ui_macro_refresh_list(void)
     ESP_LOGD(TAG, "Refreshing macro list");
 
     lvgl_port_lock(0);
-
-    // Clean up editor state
-    macro_editor.edit_overlay = NULL;
-    macro_editor.keyboard = NULL;
-    macro_editor.active_textarea = NULL;
-    macro_editor.edit_label = NULL;
-    macro_editor.table_container = NULL;
-    macro_editor.fkey_popup = NULL;
-
-    // Remove all children from macros page
-    lv_obj_clean(ui_MenuPageMacros);
-
-    // Rebuild list (will call lvgl_port_unlock internally but we need symmetry)
+    // Not built yet (or freed): the cache is shown when the page is next built
+    if (ui_settings_pages[UI_SETTINGS_PAGE_MACROS].built) {
+        ui_macro_list_sync();
+    }
     lvgl_port_unlock();
-
-    ui_macro_populate_list();
 }
@@ -13,6 +13,8 @@ extern "C" {
 // SCREEN: ui_Screen2
 extern void ui_Screen2_screen_init(void);
 extern void ui_Screen2_screen_destroy(void);
+// Apply saved settings to system state at boot (Screen2 may not be built yet)
+extern void ui_Screen2_apply_saved_settings(void);
 extern lv_obj_t * ui_Screen2;
 extern lv_obj_t * ui_TextArea1;
 extern lv_obj_t * ui_DebugLabel;
@@ -5,8 +5,12 @@
 
 #include "ui.h"
 #include "ui_helpers.h"
+#include "components/ui_styles.h"
+#include "gfx/lcd_config.h"  // H_RES/V_RES of the target panel
 #include "esp_lvgl_port.h"   // For lvgl_port_lock/unlock
 #include "esp_log.h"         // For ESP_LOGE
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 
 static const char *TAG_UI = "UI_INIT"; // Tag for logging
 
@@ -41,18 +45,31 @@ lv_anim_t * test_Animation(lv_obj_t * TargetObject, int delay)
 void ui_init(void)
 {
     if (lvgl_port_lock(5000)) {  // 5 second timeout for UI init
+        int64_t start_us = esp_timer_get_time();
+        size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
         lv_display_t * dispp = lv_display_get_default();
         lv_theme_t * theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
                                                    true, LV_FONT_DEFAULT);
         lv_display_set_theme(dispp, theme);
+        ui_styles_init();  // Shared styles must exist before widgets reference them
         ui_Screen1_screen_init();
+        // Saved settings drive Screen1 and the CAT link, not just the Settings widgets
+        ui_Screen2_apply_saved_settings();
+#if CONFIG_UI_SETTINGS_AT_BOOT
         // Pre-create Settings screen to avoid heavy creation during event handling
         // This prevents long-running UI builds inside lv_timer_handler that can starve IDLE tasks.
         ui_Screen2_screen_init();
+#endif
         // Initial actions container (kept for compatibility)
         ui____initial_actions0 = lv_obj_create(NULL);
         lv_screen_load(ui_Screen1);
 
+        int64_t build_us = esp_timer_get_time() - start_us;
+        ESP_LOGI(TAG_UI, "UI built for %dx%d in %lu.%02lu ms, heap %ld bytes (settings screen %s)",
+                 H_RES, V_RES, (unsigned long)(build_us / 1000), (unsigned long)((build_us % 1000) / 10),
+                 (long)heap_before - (long)heap_caps_get_free_size(MALLOC_CAP_DEFAULT),
+                 ui_Screen2 ? "built" : "deferred");
+
         lvgl_port_unlock();
     } else {
         ESP_LOGE(TAG_UI, "Failed to take LVGL mutex in ui_init!");
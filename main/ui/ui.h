@@ -53,20 +53,8 @@ void ui_destroy(void);
 
 // ULTRA-FAST VFO UPDATE SUPPORT
 // Exposed for direct CAT parser access to bypass messaging overhead
-extern lv_obj_t *ui_VfoAFreqMHz;
-extern lv_obj_t *ui_VfoAFreqKHz;
-extern lv_obj_t *ui_VfoAFreqHz;
+extern lv_obj_t *ui_VfoAFreqDisplay;
 extern lv_obj_t *ui_VfoBValue;
-extern lv_obj_t *ui_VfoAFreqContainer;
-
-// Frequency string cache for ultra-fast updates
-extern const char* g_khz_cache[1000];
-extern const char* g_hz_cache[1000];
-extern const char* g_mhz_cache[1000];
-extern bool g_freq_cache_initialized;
-
-// Function to initialize frequency cache from CAT parser
-void init_freq_cache_extern(void);
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -34,19 +34,10 @@ void changeMode(lv_event_t * e)
         // Send the mode command to radio
         uart_write_message(mode_commands[dropdown_idx]);
         
-        // Update s_current_radio_mode for immediate UI consistency
-        switch (dropdown_idx) {
-            case 0: s_current_radio_mode = 2; break; // USB
-            case 1: s_current_radio_mode = 1; break; // LSB
-            case 2: s_current_radio_mode = 3; break; // CW
-            case 3: s_current_radio_mode = 9; break; // DATA
-            case 4: s_current_radio_mode = 4; break; // FM
-            case 5: s_current_radio_mode = 5; break; // AM
-            default: s_current_radio_mode = -1; break;
-        }
-        
-        // Update filter visibility immediately without waiting for CAT response
-        update_filter_visibility_from_dropdown_idx(dropdown_idx);
+        // Show the new mode (label, s_current_radio_mode, filter visibility)
+        // immediately; the radio's MD/IF echo confirms it
+        const int cat_modes[] = {2, 1, 3, 9, 4, 5};
+        ui_screen1_request_mode(cat_modes[dropdown_idx]);
         
         ESP_LOGI("UI_EVENTS", "Mode changed to index %u (CAT mode %d)", dropdown_idx, s_current_radio_mode);
     }
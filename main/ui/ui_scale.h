@@ -8,69 +8,79 @@
  * On S3: ui_sx(x) == x, ui_sy(y) == y (identity, optimized away).
  * On P4 (1280x720): ui_sx(100) == 160, ui_sy(100) == 150.
  *
- * All arguments are typically compile-time constants, so these resolve
- * at compile time with zero runtime cost.
+ * The target resolution (H_RES/V_RES from lcd_config.h) is fixed at compile
+ * time, and in C++ ui_sx/ui_sy are constexpr, so scaled coordinates are
+ * constants and can initialise static tables.
  *
- * Font accessors return the correct font for the current target.
- * Both screens are 5" diagonal; P4 has ~1.6x higher DPI, so all
- * fonts scale by the same factor to maintain physical size.
+ * Font accessors return the font for the current target. Both screens are
+ * 5" diagonal; P4 has ~1.6x higher DPI, so all fonts scale by the same factor
+ * to maintain physical size. Only the target's font set is compiled and
+ * linked (see main/CMakeLists.txt).
  */
 
 #include "gfx/lcd_config.h"
 #include "lvgl.h"
+#if CONFIG_UI_FONTS_FROM_STORAGE
+#include "gfx/font_store.h"
+#endif
+
+// Resolution the layouts are designed for
+#define UI_DESIGN_H_RES 800
+#define UI_DESIGN_V_RES 480
 
+// ui_sx: scale a horizontal (X-axis) design value from 800px reference to actual H_RES
+// ui_sy: scale a vertical (Y-axis) design value from 480px reference to actual V_RES
 #ifdef __cplusplus
-extern "C" {
-#endif
+constexpr lv_coord_t ui_sx(int x) {
+    return (lv_coord_t)((int32_t)x * H_RES / UI_DESIGN_H_RES);
+}
+
+constexpr lv_coord_t ui_sy(int y) {
+    return (lv_coord_t)((int32_t)y * V_RES / UI_DESIGN_V_RES);
+}
 
-// Scale a horizontal (X-axis) design value from 800px reference to actual H_RES
+static_assert(ui_sx(UI_DESIGN_H_RES) == H_RES && ui_sy(UI_DESIGN_V_RES) == V_RES,
+              "UI scale must map the design size to the panel");
+#else
 static inline lv_coord_t ui_sx(int x) {
-    return (lv_coord_t)((int32_t)x * H_RES / 800);
+    return (lv_coord_t)((int32_t)x * H_RES / UI_DESIGN_H_RES);
 }
 
-// Scale a vertical (Y-axis) design value from 480px reference to actual V_RES
 static inline lv_coord_t ui_sy(int y) {
-    return (lv_coord_t)((int32_t)y * V_RES / 480);
+    return (lv_coord_t)((int32_t)y * V_RES / UI_DESIGN_V_RES);
 }
+#endif
 
-// --- P4 font declarations (all guarded) ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Target selection helpers
 #if CONFIG_IDF_TARGET_ESP32P4
-LV_FONT_DECLARE(ui_font_Font16_P4);
-LV_FONT_DECLARE(ui_font_Font18_P4);
-LV_FONT_DECLARE(ui_font_Font30_P4);
-LV_FONT_DECLARE(ui_font_Font48_P4);
-LV_FONT_DECLARE(ui_font_Frequency_P4);
-LV_FONT_DECLARE(ui_font_FrequencyFont_P4);
-LV_FONT_DECLARE(ui_font_FrequencyFontSmall_P4);
-LV_FONT_DECLARE(ui_font_ButtonFont_P4);
-LV_FONT_DECLARE(ui_font_ButtonFontLargeBold_P4);
-LV_FONT_DECLARE(ui_font_ButtonFontSmallMedium_P4);
-LV_FONT_DECLARE(ui_font_ButtonSmallRegular_P4);
-LV_FONT_DECLARE(ui_font_MeterFont_P4);
-LV_FONT_DECLARE(ui_font_UTCTime_P4);
-LV_FONT_DECLARE(ui_font_Glyphs24_P4);
-LV_FONT_DECLARE(ui_font_Glyphs30_P4);
-LV_FONT_DECLARE(ui_font_Glyphs58_P4);
-LV_FONT_DECLARE(ui_font_Glyphs70_P4);
+#define IF_P4(p4_val, s3_val) (p4_val)
+#define UI_TARGET_FONT(s3_font, p4_font) p4_font
+#else
+#define IF_P4(p4_val, s3_val) (s3_val)
+#define UI_TARGET_FONT(s3_font, p4_font) s3_font
 #endif
 
 // --- Font accessor functions ---
-// Each returns S3 original or P4 scaled variant based on target.
+// Each declares and returns only the current target's font, so the other
+// target's font is never referenced. With CONFIG_UI_FONTS_FROM_STORAGE the
+// fonts come from the storage partition bundle instead, which holds the
+// target's set under the 800x480 names.
 
+#if CONFIG_UI_FONTS_FROM_STORAGE
 #define UI_FONT_ACCESSOR(func_name, s3_font, p4_font) \
     static inline const lv_font_t *func_name(void) { \
-        _Pragma("GCC diagnostic push") \
-        _Pragma("GCC diagnostic ignored \"-Wunused-function\"") \
-        extern const lv_font_t s3_font; \
-        _Pragma("GCC diagnostic pop") \
-        return IF_P4(&p4_font, &s3_font); \
+        return font_store_get(#s3_font); \
     }
-
-// Target selection helper
-#if CONFIG_IDF_TARGET_ESP32P4
-#define IF_P4(p4_val, s3_val) (p4_val)
 #else
-#define IF_P4(p4_val, s3_val) (s3_val)
+#define UI_FONT_ACCESSOR(func_name, s3_font, p4_font) \
+    static inline const lv_font_t *func_name(void) { \
+        extern const lv_font_t UI_TARGET_FONT(s3_font, p4_font); \
+        return &UI_TARGET_FONT(s3_font, p4_font); \
+    }
 #endif
 
 // Text fonts
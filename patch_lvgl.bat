@@ -24,6 +24,21 @@ if exist "%LVGL_CMAKE%" (
     echo LVGL: %LVGL_CMAKE% not found
 )
 
+REM Patch LVGL FreeRTOS OSAL - create threads through LV_FREERTOS_TASK_CREATE (lv_conf.h)
+REM so the draw threads can be pinned to cores
+set "LVGL_OSAL=managed_components\lvgl__lvgl\src\osal\lv_freertos.c"
+if exist "%LVGL_OSAL%" (
+    findstr /C:"= LV_FREERTOS_TASK_CREATE(" "%LVGL_OSAL%" >nul 2>&1
+    if !errorlevel! equ 0 (
+        echo LVGL OSAL: Already patched
+    ) else (
+        powershell -Command "(Get-Content '%LVGL_OSAL%') -replace '= xTaskCreate\(', '= LV_FREERTOS_TASK_CREATE(' | Set-Content '%LVGL_OSAL%'"
+        echo LVGL OSAL: Patched ^(thread placement^)
+    )
+) else (
+    echo LVGL OSAL: %LVGL_OSAL% not found
+)
+
 REM Patch esp_websocket_client - disable redirect support (not available in ESP-IDF 5.5)
 set "WS_CLIENT=managed_components\espressif__esp_websocket_client\esp_websocket_client.c"
 if exist "%WS_CLIENT%" (
@@ -30,6 +30,22 @@ else
     echo "LVGL: $LVGL_CMAKE not found"
 fi
 
+# Patch LVGL FreeRTOS OSAL - create threads through LV_FREERTOS_TASK_CREATE (lv_conf.h)
+# so the draw threads can be pinned to cores
+LVGL_OSAL="managed_components/lvgl__lvgl/src/osal/lv_freertos.c"
+if [ -f "$LVGL_OSAL" ]; then
+    if grep -q "= LV_FREERTOS_TASK_CREATE(" "$LVGL_OSAL"; then
+        echo "LVGL OSAL: Already patched (thread placement)"
+    elif grep -q "= xTaskCreate(" "$LVGL_OSAL"; then
+        sed -i 's/= xTaskCreate(/= LV_FREERTOS_TASK_CREATE(/' "$LVGL_OSAL"
+        echo "LVGL OSAL: Patch applied successfully (thread placement)"
+    else
+        echo "LVGL OSAL: Pattern not found"
+    fi
+else
+    echo "LVGL OSAL: $LVGL_OSAL not found"
+fi
+
 # Patch esp_lvgl_port - needs main to access lv_conf.h
 PORT_CMAKE="managed_components/espressif__esp_lvgl_port/CMakeLists.txt"
 if [ -f "$PORT_CMAKE" ]; then
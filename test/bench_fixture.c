@@ -0,0 +1,98 @@
+/**
+ * @file bench_fixture.c
+ * @brief Shared LVGL display fixture for the UI component benchmarks
+ */
+
+#include "bench_fixture.h"
+#include "esp_timer.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef BENCH_HEAP_COUNT
+#define BENCH_HEAP_COUNT 0
+#endif
+#if BENCH_HEAP_COUNT
+#include "host_mem_count.h"
+#endif
+
+static lv_display_t *s_disp;
+static uint8_t *s_draw_buf;
+static bench_counters_t s_counters;
+#if BENCH_HEAP_COUNT
+static host_mem_count_t s_heap_base;
+#endif
+
+static void bench_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    (void)px_map;
+    s_counters.flushed_px += lv_area_get_size(area);
+    s_counters.flushes++;
+    lv_display_flush_ready(disp);
+}
+
+static void bench_invalidate_cb(lv_event_t *e) {
+    (void)e;
+    s_counters.invalidations++;
+}
+
+static uint32_t bench_tick_cb(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+lv_display_t *bench_display_init(int32_t h_res, int32_t v_res, int32_t buf_lines) {
+    if (s_disp != NULL) return s_disp;
+    lv_init();
+    lv_tick_set_cb(bench_tick_cb);
+    s_disp = lv_display_create(h_res, v_res);
+    TEST_ASSERT_NOT_NULL(s_disp);
+    size_t buf_size = (size_t)h_res * buf_lines * 2;
+    s_draw_buf = (uint8_t *)malloc(buf_size);
+    TEST_ASSERT_NOT_NULL(s_draw_buf);
+    lv_display_set_color_format(s_disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(s_disp, s_draw_buf, NULL, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(s_disp, bench_flush_cb);
+    lv_display_add_event_cb(s_disp, bench_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    return s_disp;
+}
+
+bool bench_heap_counted(void) {
+    return BENCH_HEAP_COUNT != 0;
+}
+
+void bench_counters_reset(void) {
+    memset(&s_counters, 0, sizeof(s_counters));
+#if BENCH_HEAP_COUNT
+    host_mem_count_get(&s_heap_base);
+#endif
+}
+
+void bench_counters_get(bench_counters_t *out) {
+    *out = s_counters;
+#if BENCH_HEAP_COUNT
+    host_mem_count_t now;
+    host_mem_count_get(&now);
+    out->heap_allocs = (now.allocs - s_heap_base.allocs) + (now.reallocs - s_heap_base.reallocs);
+    out->heap_frees = now.frees - s_heap_base.frees;
+#endif
+}
+
+void bench_result_begin(bench_result_t *result) {
+    memset(result, 0, sizeof(*result));
+    bench_counters_reset();
+}
+
+uint32_t bench_result_sample(bench_result_t *result, int64_t start_us) {
+    uint32_t us = (uint32_t)(esp_timer_get_time() - start_us);
+    result->samples++;
+    result->us_total += us;
+    if (us > result->us_max) result->us_max = us;
+    return us;
+}
+
+void bench_result_end(bench_result_t *result) {
+    bench_counters_get(&result->counters);
+}
+
+uint32_t bench_result_avg_us(const bench_result_t *result) {
+    return result->samples ? result->us_total / result->samples : 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file bench_fixture.h
+ * @brief Shared LVGL display fixture for the UI component benchmarks
+ *
+ * One RGB565 display with a partial draw buffer and a flush callback that
+ * only counts, created on first use and kept for the whole test binary. The
+ * counters cover what a benchmark run hands to the panel: flushed pixels,
+ * flush calls and invalidated areas. Each benchmark keeps its own trace and
+ * report; the fixture only owns the display, the counters and the timing.
+ *
+ * With BENCH_HEAP_COUNT (host builds) LVGL allocates through
+ * host/host_mem_count.c and the LVGL heap calls are counted as well; the
+ * firmware uses the C library allocator directly and they stay zero.
+ *
+ * Built by the ESP-IDF unit test app and by the host CMake (host/), where
+ * host/bench_main.c calls app_main().
+ */
+
+#ifndef BENCH_FIXTURE_H
+#define BENCH_FIXTURE_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t flushed_px;       // Pixels passed to the flush callback
+    uint32_t flushes;          // Flush callback calls
+    uint32_t invalidations;    // LV_EVENT_INVALIDATE_AREA events
+    uint32_t heap_allocs;      // LVGL malloc and realloc calls, BENCH_HEAP_COUNT only
+    uint32_t heap_frees;       // LVGL free calls, BENCH_HEAP_COUNT only
+} bench_counters_t;
+
+typedef struct {
+    uint32_t samples;
+    uint32_t us_total;
+    uint32_t us_max;
+    bench_counters_t counters;  // Counted between bench_result_begin() and bench_result_end()
+} bench_result_t;
+
+/**
+ * @brief Create the benchmark display, or return the one already created
+ *
+ * Initialises LVGL with a millisecond tick from esp_timer_get_time(). Later
+ * calls return the existing display whatever size they ask for, so every
+ * test in a binary should pass the same values.
+ *
+ * @param h_res     Display width
+ * @param v_res     Display height
+ * @param buf_lines Partial draw buffer height in lines
+ * @return The display
+ */
+lv_display_t *bench_display_init(int32_t h_res, int32_t v_res, int32_t buf_lines);
+
+/**
+ * @brief Whether the heap counters are measured in this build
+ */
+bool bench_heap_counted(void);
+
+/**
+ * @brief Zero the flush, invalidation and heap counters
+ */
+void bench_counters_reset(void);
+
+/**
+ * @brief Copy the counters accumulated since the last reset
+ */
+void bench_counters_get(bench_counters_t *out);
+
+/**
+ * @brief Zero a result and reset the counters before a run
+ */
+void bench_result_begin(bench_result_t *result);
+
+/**
+ * @brief Add one timed sample to a result
+ *
+ * @param result   Result of the current run
+ * @param start_us esp_timer_get_time() when the sample started
+ * @return Duration of the sample in microseconds
+ */
+uint32_t bench_result_sample(bench_result_t *result, int64_t start_us);
+
+/**
+ * @brief Store the counters accumulated during the run in the result
+ */
+void bench_result_end(bench_result_t *result);
+
+/**
+ * @brief Average sample time of a result in microseconds
+ */
+uint32_t bench_result_avg_us(const bench_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_FIXTURE_H
@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "cat_rx_framer.h"
+#include "uart_tx_arena.h"
+
+// Mirrors the uart.cpp configuration: frames up to CAT_FRAME_MAX_LEN (default
+// 256), 64-byte queue slots, long frames staged in a 1KB RX arena
+#define TEST_FRAME_MAX 256
+#define TEST_SLOT_SIZE 64
+#define TEST_ARENA_SIZE 1024
+
+static char frame_buf[TEST_FRAME_MAX];
+static cat_rx_framer_t framer;
+static uint8_t arena_mem[TEST_ARENA_SIZE];
+static uart_tx_arena_t arena;
+
+// Longest macro the Screen2 editor saves: 31-character name, 63-character command list
+static const char *s_long_mxr =
+    "MXR07,Contest 20m CW run, 100W, NB on,"
+    "FA00014025000|MD3|FW0400|PC100|SH05|SL02|KS028|RA00|PA1|NB1|NR0";
+
+typedef struct {
+    char frames[8][TEST_FRAME_MAX];
+    int count;
+    int overflows;
+} test_sink_t;
+
+// Feeds a byte stream in chunks of chunk_size, as uart_read_bytes returns it,
+// and stages every frame the way read_uart queues it
+static void test_feed(const char *stream, size_t chunk_size, test_sink_t *sink) {
+    size_t total = strlen(stream);
+    memset(sink, 0, sizeof(*sink));
+    for (size_t pos = 0; pos < total; pos += chunk_size) {
+        size_t n = total - pos < chunk_size ? total - pos : chunk_size;
+        for (size_t i = 0; i < n; i++) {
+            size_t len = 0;
+            cat_rx_result_t r = cat_rx_framer_push(&framer, stream[pos + i], &len);
+            if (r == CAT_RX_OVERFLOW) {
+                sink->overflows++;
+            } else if (r == CAT_RX_FRAME) {
+                TEST_ASSERT_EQUAL_size_t(strlen(frame_buf), len);
+                if (len < TEST_SLOT_SIZE) {
+                    memcpy(sink->frames[sink->count], frame_buf, len + 1);
+                } else {
+                    int first = uart_tx_arena_alloc(&arena, len + 1);
+                    TEST_ASSERT_TRUE(first >= 0);
+                    memcpy(uart_tx_arena_ptr(&arena, first), frame_buf, len + 1);
+                    // Parser side: read the frame back and release the run
+                    memcpy(sink->frames[sink->count], uart_tx_arena_ptr(&arena, first), len + 1);
+                    uart_tx_arena_free(&arena, first, uart_tx_arena_blocks_for(len + 1));
+                }
+                sink->count++;
+            }
+        }
+    }
+}
+
+void setUp(void) {
+    cat_rx_framer_init(&framer, frame_buf, sizeof(frame_buf));
+    uart_tx_arena_init(&arena, arena_mem, sizeof(arena_mem));
+}
+
+void tearDown(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, arena.used_blocks);
+}
+
+void test_long_mxr_reads_back_whole(void) {
+    char stream[512];
+    snprintf(stream, sizeof(stream), "FA00014074000;%s;IF00014074000     +00000000002000000;", s_long_mxr);
+    TEST_ASSERT_TRUE(strlen(s_long_mxr) > TEST_SLOT_SIZE);
+
+    const size_t chunks[] = {1, 7, 38, 64, sizeof(stream)};
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+        test_sink_t sink;
+        test_feed(stream, chunks[c], &sink);
+        TEST_ASSERT_EQUAL_INT(0, sink.overflows);
+        TEST_ASSERT_EQUAL_INT(3, sink.count);
+        TEST_ASSERT_EQUAL_STRING("FA00014074000", sink.frames[0]);
+        TEST_ASSERT_EQUAL_STRING(s_long_mxr, sink.frames[1]);
+        TEST_ASSERT_EQUAL_STRING("IF00014074000     +00000000002000000", sink.frames[2]);
+    }
+}
+
+void test_empty_frames_and_crlf_are_skipped(void) {
+    test_sink_t sink;
+    test_feed(";;\r\nID021;\r\n", 3, &sink);
+    TEST_ASSERT_EQUAL_INT(1, sink.count);
+    TEST_ASSERT_EQUAL_STRING("ID021", sink.frames[0]);
+}
+
+void test_frame_filling_the_buffer_is_kept(void) {
+    static char stream[TEST_FRAME_MAX + 8];
+    memset(stream, 'A', TEST_FRAME_MAX - 1);
+    memcpy(stream, "MX", 2);
+    strcpy(stream + TEST_FRAME_MAX - 1, ";FA1;");
+
+    test_sink_t sink;
+    test_feed(stream, 16, &sink);
+    TEST_ASSERT_EQUAL_INT(0, sink.overflows);
+    TEST_ASSERT_EQUAL_INT(2, sink.count);
+    TEST_ASSERT_EQUAL_size_t(TEST_FRAME_MAX - 1, strlen(sink.frames[0]));
+    TEST_ASSERT_EQUAL_STRING("FA1", sink.frames[1]);
+}
+
+// Too long for any answer: dropped as one frame, and no headless tail (here one
+// that would parse as an FA answer) reaches the parser
+void test_overlong_frame_is_dropped_whole(void) {
+    static char stream[TEST_FRAME_MAX + 64];
+    memset(stream, 'x', TEST_FRAME_MAX + 20);
+    memcpy(stream, "MXR01,", 6);
+    memcpy(stream + TEST_FRAME_MAX - 1, "FA00014074000", 13);
+    strcpy(stream + TEST_FRAME_MAX + 20, ";MD2;");
+
+    test_sink_t sink;
+    test_feed(stream, 64, &sink);
+    TEST_ASSERT_EQUAL_INT(1, sink.overflows);
+    TEST_ASSERT_EQUAL_INT(1, sink.count);
+    TEST_ASSERT_EQUAL_STRING("MD2", sink.frames[0]);
+}
+
+void app_main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_long_mxr_reads_back_whole);
+    RUN_TEST(test_empty_frames_and_crlf_are_skipped);
+    RUN_TEST(test_frame_filling_the_buffer_is_kept);
+    RUN_TEST(test_overlong_frame_is_dropped_whole);
+
+    UNITY_END();
+}
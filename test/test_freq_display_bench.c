@@ -0,0 +1,197 @@
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "bench_fixture.h"
+#include "ui_scale.h"
+#include "components/ui_freq_display.h"
+
+// Render benchmark for the main frequency readout: three labels fed from the
+// former 3x1000 string caches versus ui_freq_display blitting from its digit
+// atlas. Every tune step is followed by a synchronous refresh so the timing
+// covers the update call, invalidation, rendering and a no-op flush.
+
+#define BENCH_H_RES 1280
+#define BENCH_V_RES 400
+#define BENCH_BUF_LINES 60
+
+static lv_display_t *s_disp;
+
+typedef struct {
+    const char *name;
+    uint32_t start_hz;
+    int32_t step_hz;
+    int steps;
+} tune_pattern_t;
+
+static const tune_pattern_t s_patterns[] = {
+    {"10 Hz steps",   14074000, 10,      300},   // Slow VFO knob
+    {"1 kHz steps",   7000000,  1000,    200},   // Fast knob / band scan
+    {"band jumps",    1840000,  6000000, 20},    // Band buttons 160m .. 10m
+};
+
+// ---- Previous implementation: MHz / kHz / Hz labels ----
+
+static char s_mhz_strings[1000][4];
+static char s_khz_strings[1000][4];
+static lv_obj_t *s_mhz_label;
+static lv_obj_t *s_khz_label;
+static lv_obj_t *s_hz_label;
+static uint32_t s_prev_mhz, s_prev_khz, s_prev_hz;
+
+static lv_obj_t *legacy_label(lv_obj_t *parent, const char *text, lv_text_align_t align) {
+    lv_point_t size;
+    lv_obj_t *label = lv_label_create(parent);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_font(label, ui_freq_font(), 0);
+    lv_obj_set_style_text_align(label, align, 0);
+    lv_text_get_size(&size, strcmp(text, ".") == 0 ? "." : "000", ui_freq_font(), 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    lv_obj_set_width(label, size.x);
+    return label;
+}
+
+static lv_obj_t *legacy_create(lv_obj_t *parent) {
+    for (int i = 0; i < 1000; i++) {
+        snprintf(s_mhz_strings[i], 4, "%d", i);
+        snprintf(s_khz_strings[i], 4, "%03d", i);
+    }
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW);
+    s_mhz_label = legacy_label(cont, "14", LV_TEXT_ALIGN_RIGHT);
+    legacy_label(cont, ".", LV_TEXT_ALIGN_LEFT);
+    s_khz_label = legacy_label(cont, "012", LV_TEXT_ALIGN_CENTER);
+    legacy_label(cont, ".", LV_TEXT_ALIGN_LEFT);
+    s_hz_label = legacy_label(cont, "000", LV_TEXT_ALIGN_LEFT);
+    s_prev_mhz = s_prev_khz = s_prev_hz = 0xFFFFFFFF;
+    return cont;
+}
+
+static void legacy_set_freq(uint32_t freq) {
+    uint32_t mhz = freq / 1000000;
+    uint32_t khz = (freq / 1000) % 1000;
+    uint32_t hz = freq % 1000;
+    if (mhz != s_prev_mhz) {
+        lv_label_set_text_static(s_mhz_label, s_mhz_strings[mhz]);
+        s_prev_mhz = mhz;
+    }
+    if (khz != s_prev_khz) {
+        lv_label_set_text_static(s_khz_label, s_khz_strings[khz]);
+        s_prev_khz = khz;
+    }
+    if (hz != s_prev_hz) {
+        lv_label_set_text_static(s_hz_label, s_khz_strings[hz]);
+        s_prev_hz = hz;
+    }
+}
+
+// ---- Benchmark driver ----
+
+static void bench_run(bool use_atlas, const tune_pattern_t *pattern, bench_result_t *result) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x292831), 0);
+    lv_obj_set_style_text_color(scr, lv_color_white(), 0);
+    lv_screen_load(scr);
+
+    lv_obj_t *freq_obj = use_atlas ? ui_freq_display_create(scr, ui_freq_font()) : legacy_create(scr);
+    TEST_ASSERT_NOT_NULL(freq_obj);
+    lv_obj_center(freq_obj);
+    if (use_atlas) {
+        ui_freq_display_set_freq(freq_obj, pattern->start_hz);
+    } else {
+        legacy_set_freq(pattern->start_hz);
+    }
+    lv_refr_now(s_disp);
+
+    bench_result_begin(result);
+    uint32_t freq = pattern->start_hz;
+    for (int n = 0; n < pattern->steps; n++) {
+        freq += pattern->step_hz;
+        if (freq > 30000000) freq = 1840000 + (freq % 1000);
+
+        int64_t start_us = esp_timer_get_time();
+        if (use_atlas) {
+            ui_freq_display_set_freq(freq_obj, freq);
+        } else {
+            legacy_set_freq(freq);
+        }
+        lv_refr_now(s_disp);
+        bench_result_sample(result, start_us);
+    }
+    bench_result_end(result);
+
+    if (use_atlas) {
+        TEST_ASSERT_EQUAL_UINT32(freq, ui_freq_display_get_freq(freq_obj));
+        printf("Atlas: %lu bytes\n", (unsigned long)ui_freq_display_atlas_size(freq_obj));
+    }
+    lv_obj_delete(scr);
+}
+
+static void bench_report(const char *name, const bench_result_t *r) {
+    printf("  %-7s avg %5lu us/step, max %5lu us, %7lu px/step\n", name,
+           (unsigned long)bench_result_avg_us(r), (unsigned long)r->us_max,
+           (unsigned long)(r->counters.flushed_px / r->samples));
+}
+
+void setUp(void) {
+    s_disp = bench_display_init(BENCH_H_RES, BENCH_V_RES, BENCH_BUF_LINES);
+}
+
+void tearDown(void) {
+    // Display is kept for all tests
+}
+
+void test_freq_display_invalidates_changed_digits_only(void) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_screen_load(scr);
+    lv_obj_t *display = ui_freq_display_create(scr, ui_freq_font());
+    TEST_ASSERT_NOT_NULL(display);
+    TEST_ASSERT_TRUE(ui_freq_display_set_freq(display, 14074000));
+    lv_refr_now(s_disp);
+
+    int32_t height = lv_obj_get_height(display);
+    int32_t width = lv_obj_get_width(display);
+
+    // 14.074.000 -> 14.074.010: one digit cell
+    bench_counters_t counters;
+    bench_counters_reset();
+    TEST_ASSERT_TRUE(ui_freq_display_set_freq(display, 14074010));
+    lv_refr_now(s_disp);
+    bench_counters_get(&counters);
+    TEST_ASSERT_TRUE(counters.flushed_px > 0);
+    TEST_ASSERT_TRUE(counters.flushed_px <= (uint32_t)(width * height) / 8);
+
+    TEST_ASSERT_FALSE(ui_freq_display_set_freq(display, 14074010));
+    TEST_ASSERT_FALSE(ui_freq_display_set_freq(display, 1000000000));
+    TEST_ASSERT_EQUAL_UINT32(14074010, ui_freq_display_get_freq(display));
+    lv_obj_delete(scr);
+}
+
+void test_freq_display_vs_labels(void) {
+    for (size_t i = 0; i < sizeof(s_patterns) / sizeof(s_patterns[0]); i++) {
+        const tune_pattern_t *pattern = &s_patterns[i];
+        bench_result_t labels;
+        bench_result_t atlas;
+
+        bench_run(false, pattern, &labels);
+        bench_run(true, pattern, &atlas);
+
+        printf("%s (%d steps):\n", pattern->name, pattern->steps);
+        bench_report("labels", &labels);
+        bench_report("atlas", &atlas);
+
+        // Labels invalidate a whole 3-digit group per change, cells never more
+        TEST_ASSERT_TRUE(atlas.counters.flushed_px <= labels.counters.flushed_px);
+    }
+}
+
+void app_main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_freq_display_invalidates_changed_digits_only);
+    RUN_TEST(test_freq_display_vs_labels);
+
+    UNITY_END();
+}
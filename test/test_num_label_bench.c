@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include "unity.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "bench_fixture.h"
+#include "components/ui_num_label.h"
+
+// Steady-state benchmark for the Screen1 numeric readouts (RIT, XIT, filter
+// high/low cut) refreshed on every IF poll, formatted with snprintf into
+// lv_label_set_text() versus ui_num_label. The values only change every
+// couple of seconds, as they do while the operator is not turning a knob.
+// LVGL heap calls are counted by the host build's allocator hook
+// (bench_fixture.h), including those of the refresh after each update;
+// elsewhere only time and invalidations are reported.
+
+#define BENCH_H_RES 800
+#define BENCH_V_RES 480
+#define BENCH_BUF_LINES 48
+#define BENCH_READOUTS 4
+#define BENCH_IF_PERIOD_MS 150   // POLLING_INTERVAL_IF
+#define BENCH_UPDATES 400        // 60 seconds of IF polls
+#define BENCH_CHANGE_EVERY 13    // Values change about every 2 seconds
+
+static lv_display_t *s_disp;
+
+static void bench_run(bool use_num_label, bench_result_t *result) {
+    static ui_num_label_t texts[BENCH_READOUTS];
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_screen_load(scr);
+    lv_obj_t *labels[BENCH_READOUTS];
+    for (int i = 0; i < BENCH_READOUTS; i++) {
+        labels[i] = lv_label_create(scr);
+        lv_label_set_text(labels[i], "");
+        lv_obj_set_pos(labels[i], 10, 10 + i * 40);
+    }
+    lv_refr_now(s_disp);
+
+    bench_result_begin(result);
+    for (int n = 0; n < BENCH_UPDATES; n++) {
+        int32_t step = n / BENCH_CHANGE_EVERY;
+        int32_t rit_hz = -500 + step * 10;
+        int32_t values[BENCH_READOUTS] = {rit_hz, rit_hz, 2400 + step * 50, 100 + step * 50};
+
+        int64_t start_us = esp_timer_get_time();
+        for (int i = 0; i < BENCH_READOUTS; i++) {
+            if (use_num_label) {
+                if (i < 2) {
+                    ui_num_label_set_fixed(labels[i], &texts[i], values[i] / 10, 2, true, NULL);
+                } else {
+                    ui_num_label_set_int(labels[i], &texts[i], NULL, values[i], 0, NULL);
+                }
+            } else {
+                char buf[16];
+                if (i < 2) {
+                    snprintf(buf, sizeof(buf), "%+.2f", (float)values[i] / 1000.0f);
+                } else {
+                    snprintf(buf, sizeof(buf), "%u", (unsigned)values[i]);
+                }
+                lv_label_set_text(labels[i], buf);
+            }
+        }
+        bench_result_sample(result, start_us);
+        lv_refr_now(s_disp);
+    }
+    bench_result_end(result);
+
+    if (use_num_label) {
+        for (int i = 0; i < BENCH_READOUTS; i++) {
+            TEST_ASSERT_EQUAL_PTR(texts[i].text, lv_label_get_text(labels[i]));
+        }
+    }
+    lv_obj_delete(scr);
+}
+
+static void bench_report(const char *name, const bench_result_t *r) {
+    uint32_t seconds = BENCH_UPDATES * BENCH_IF_PERIOD_MS / 1000;
+    printf("  %-16s %4lu us/update, %3lu invalidations/s", name, (unsigned long)bench_result_avg_us(r),
+           (unsigned long)(r->counters.invalidations / seconds));
+    if (bench_heap_counted()) {
+        printf(", %3lu heap allocs/s, %3lu frees/s", (unsigned long)(r->counters.heap_allocs / seconds),
+               (unsigned long)(r->counters.heap_frees / seconds));
+    }
+    printf("\n");
+}
+
+void setUp(void) {
+    s_disp = bench_display_init(BENCH_H_RES, BENCH_V_RES, BENCH_BUF_LINES);
+}
+
+void tearDown(void) {
+    // Display is kept for all tests
+}
+
+void test_num_label_formats_and_skips_unchanged(void) {
+    static ui_num_label_t text;
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *label = lv_label_create(scr);
+
+    TEST_ASSERT_TRUE(ui_num_label_set_fixed(label, &text, 125, 2, true, NULL));
+    TEST_ASSERT_EQUAL_STRING("+1.25", lv_label_get_text(label));
+    TEST_ASSERT_FALSE(ui_num_label_set_fixed(label, &text, 125, 2, true, NULL));
+    TEST_ASSERT_TRUE(ui_num_label_set_fixed(label, &text, -5, 2, true, NULL));
+    TEST_ASSERT_EQUAL_STRING("-0.05", lv_label_get_text(label));
+    TEST_ASSERT_TRUE(ui_num_label_set_fixed(label, &text, 0, 0, true, "Hz"));
+    TEST_ASSERT_EQUAL_STRING("+0Hz", lv_label_get_text(label));
+    TEST_ASSERT_TRUE(ui_num_label_set_int(label, &text, "M.CH ", 5, 2, NULL));
+    TEST_ASSERT_EQUAL_STRING("M.CH 05", lv_label_get_text(label));
+    TEST_ASSERT_TRUE(ui_num_label_set_int(label, &text, "M.CH ", 120, 2, NULL));
+    TEST_ASSERT_EQUAL_STRING("M.CH 120", lv_label_get_text(label));
+    TEST_ASSERT_TRUE(ui_num_label_set_str(label, &text, "0123456789abcdefgh"));
+    TEST_ASSERT_EQUAL_STRING("0123456789abcde", lv_label_get_text(label));
+
+    // A label that does not show the buffer (e.g. recreated) is always set
+    lv_label_set_text(label, "x");
+    TEST_ASSERT_TRUE(ui_num_label_set_str(label, &text, "0123456789abcde"));
+    TEST_ASSERT_EQUAL_PTR(text.text, lv_label_get_text(label));
+    lv_obj_delete(scr);
+}
+
+void test_num_label_vs_set_text_steady_state(void) {
+    bench_result_t legacy;
+    bench_result_t num_label;
+    bench_run(false, &legacy);
+    bench_run(true, &num_label);
+    printf("%d readouts at the IF poll rate (%d ms), values changing every ~2 s:\n", BENCH_READOUTS,
+           BENCH_IF_PERIOD_MS);
+    bench_report("lv_label_set_text", &legacy);
+    bench_report("ui_num_label", &num_label);
+    TEST_ASSERT_TRUE(num_label.counters.invalidations < legacy.counters.invalidations);
+    if (bench_heap_counted()) {
+        TEST_ASSERT_TRUE(num_label.counters.heap_allocs < legacy.counters.heap_allocs);
+    }
+}
+
+void app_main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_num_label_formats_and_skips_unchanged);
+    RUN_TEST(test_num_label_vs_set_text_steady_state);
+    UNITY_END();
+}
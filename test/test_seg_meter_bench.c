@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include "unity.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "bench_fixture.h"
+#include "components/ui_seg_meter.h"
+
+// Render benchmark: 30-segment S-meter driven at 20 Hz, built either from one
+// lv_bar per segment (the previous ui_Screen1 approach) or from ui_seg_meter.
+// Each sample is followed by a synchronous refresh so the timing covers the
+// update call, invalidation, rendering and a no-op flush.
+
+#define BENCH_H_RES 800
+#define BENCH_V_RES 480
+#define BENCH_BUF_LINES 48
+#define BENCH_SEGMENTS 30
+#define BENCH_SAMPLE_MS 50       // 20 Hz meter rate
+#define BENCH_SAMPLES 400        // 20 seconds of samples
+
+static lv_display_t *s_disp;
+
+// Deterministic S-meter trace: slow fading signal with fast noise bursts
+static int bench_trace_level(int sample) {
+    static uint32_t seed = 12345;
+    if (sample == 0) seed = 12345;
+    seed = seed * 1103515245u + 12345u;
+    int base = 12 + (int)(8.0f * (float)((sample / 20) % 4) / 3.0f);
+    int noise = (int)((seed >> 16) % 7) - 3;
+    int level = base + noise;
+    if ((sample % 37) < 3) level += 10; // Burst
+    if (level < 0) level = 0;
+    if (level > BENCH_SEGMENTS) level = BENCH_SEGMENTS;
+    return level;
+}
+
+// Peak hold with one segment of decay per sample
+static int bench_peak(int level, int *peak) {
+    if (level > *peak) {
+        *peak = level;
+    } else if (*peak > 0) {
+        (*peak)--;
+        if (*peak < level) *peak = level;
+    }
+    return *peak;
+}
+
+// ---- Previous implementation: one lv_bar per segment ----
+
+static lv_obj_t *s_bars[BENCH_SEGMENTS];
+static int s_bar_state[BENCH_SEGMENTS];
+
+static lv_obj_t *legacy_meter_create(lv_obj_t *parent, const lv_color_t colors[]) {
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, BENCH_SEGMENTS * 7 + (BENCH_SEGMENTS - 1) * 2, LV_SIZE_CONTENT);
+    lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_column(cont, 2, 0);
+    for (int i = 0; i < BENCH_SEGMENTS; i++) {
+        s_bars[i] = lv_bar_create(cont);
+        lv_obj_set_size(s_bars[i], 7, 22);
+        lv_bar_set_range(s_bars[i], 0, 1);
+        lv_bar_set_value(s_bars[i], 0, LV_ANIM_OFF);
+        lv_obj_set_style_radius(s_bars[i], 0, LV_PART_MAIN);
+        lv_obj_set_style_bg_color(s_bars[i], lv_color_hex(0x363636), LV_PART_MAIN);
+        lv_obj_set_style_bg_opa(s_bars[i], 200, LV_PART_MAIN);
+        lv_obj_set_style_radius(s_bars[i], 0, LV_PART_INDICATOR);
+        lv_obj_set_style_bg_color(s_bars[i], colors[i], LV_PART_INDICATOR);
+        lv_obj_set_style_bg_opa(s_bars[i], 255, LV_PART_INDICATOR);
+        s_bar_state[i] = 0;
+    }
+    return cont;
+}
+
+static void legacy_meter_update(int level, int peak) {
+    for (int i = 0; i < BENCH_SEGMENTS; i++) {
+        int target = (i < level || (peak > level && i == peak - 1)) ? 1 : 0;
+        if (s_bars[i] != NULL && lv_obj_is_valid(s_bars[i]) && s_bar_state[i] != target) {
+            lv_bar_set_value(s_bars[i], target, LV_ANIM_OFF);
+            s_bar_state[i] = target;
+        }
+    }
+}
+
+// ---- Benchmark driver ----
+
+static lv_obj_t *s_meter;
+static bool s_use_widget;
+
+static void bench_run(bench_result_t *result) {
+    lv_color_t colors[BENCH_SEGMENTS];
+    for (int i = 0; i < BENCH_SEGMENTS; i++) {
+        colors[i] = lv_color_hex(i < 15 ? 0x2884f6 : 0xD6251F);
+    }
+
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x292831), 0);
+    lv_screen_load(scr);
+    if (s_use_widget) {
+        s_meter = ui_seg_meter_create(scr, BENCH_SEGMENTS, 7, 22, 2);
+        ui_seg_meter_set_colors(s_meter, colors, BENCH_SEGMENTS);
+    } else {
+        s_meter = legacy_meter_create(scr, colors);
+    }
+    lv_obj_set_pos(s_meter, 100, 35);
+    lv_refr_now(s_disp);
+
+    bench_result_begin(result);
+    int peak = 0;
+    int last_level = 0;
+    for (int n = 0; n < BENCH_SAMPLES; n++) {
+        int level = bench_trace_level(n);
+        last_level = level;
+        int peak_now = bench_peak(level, &peak);
+
+        int64_t start_us = esp_timer_get_time();
+        if (s_use_widget) {
+            ui_seg_meter_set_value(s_meter, level, peak_now);
+        } else {
+            legacy_meter_update(level, peak_now);
+        }
+        lv_refr_now(s_disp);
+        bench_result_sample(result, start_us);
+    }
+    bench_result_end(result);
+
+    if (s_use_widget) {
+        TEST_ASSERT_EQUAL_INT32(last_level, ui_seg_meter_get_level(s_meter));
+    }
+
+    lv_obj_delete(scr);
+    s_meter = NULL;
+}
+
+static void bench_report(const char *name, const bench_result_t *r) {
+    uint32_t avg_us = bench_result_avg_us(r);
+    // Share of one core spent on the meter at 20 Hz, x10 for one decimal
+    uint32_t load_x10 = (avg_us * 1000) / (BENCH_SAMPLE_MS * 1000);
+    printf("%-10s avg %5lu us/frame, max %5lu us, %6lu px/frame, %4lu flushes, %lu.%lu%% CPU at 20 Hz\n",
+           name, (unsigned long)avg_us, (unsigned long)r->us_max,
+           (unsigned long)(r->counters.flushed_px / BENCH_SAMPLES), (unsigned long)r->counters.flushes,
+           (unsigned long)(load_x10 / 10), (unsigned long)(load_x10 % 10));
+}
+
+void setUp(void) {
+    s_disp = bench_display_init(BENCH_H_RES, BENCH_V_RES, BENCH_BUF_LINES);
+}
+
+void tearDown(void) {
+    // Display is kept for all tests
+}
+
+void test_seg_meter_invalidates_only_changed_span(void) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_screen_load(scr);
+    lv_obj_t *meter = ui_seg_meter_create(scr, BENCH_SEGMENTS, 7, 22, 2);
+    TEST_ASSERT_NOT_NULL(meter);
+    lv_refr_now(s_disp);
+    bench_counters_t counters;
+
+    bench_counters_reset();
+    TEST_ASSERT_TRUE(ui_seg_meter_set_value(meter, 5, 0));
+    lv_refr_now(s_disp);
+    bench_counters_get(&counters);
+    // Five segments plus four gaps, full height
+    TEST_ASSERT_EQUAL_UINT32((5 * 7 + 4 * 2) * 22, counters.flushed_px);
+
+    bench_counters_reset();
+    TEST_ASSERT_FALSE(ui_seg_meter_set_value(meter, 5, 3)); // Peak below level is hidden
+    TEST_ASSERT_TRUE(ui_seg_meter_set_value(meter, 6, 0));
+    lv_refr_now(s_disp);
+    bench_counters_get(&counters);
+    TEST_ASSERT_EQUAL_UINT32(7 * 22, counters.flushed_px);
+
+    ui_seg_meter_set_value(meter, 99, 0);
+    TEST_ASSERT_EQUAL_INT32(BENCH_SEGMENTS, ui_seg_meter_get_level(meter));
+    lv_obj_delete(scr);
+}
+
+void test_seg_meter_vs_bar_objects_20hz(void) {
+    bench_result_t legacy;
+    bench_result_t widget;
+
+    s_use_widget = false;
+    bench_run(&legacy);
+    s_use_widget = true;
+    bench_run(&widget);
+
+    printf("S-meter, %d samples at 20 Hz:\n", BENCH_SAMPLES);
+    bench_report("lv_bar x30", &legacy);
+    bench_report("seg_meter", &widget);
+
+    // Spans include the gaps between segments, so allow a little more area than per-bar invalidation
+    TEST_ASSERT_TRUE(widget.counters.flushed_px <= legacy.counters.flushed_px + legacy.counters.flushed_px / 4);
+}
+
+void app_main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_seg_meter_invalidates_only_changed_span);
+    RUN_TEST(test_seg_meter_vs_bar_objects_20hz);
+
+    UNITY_END();
+}
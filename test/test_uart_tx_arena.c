@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "esp_timer.h"
+#include "uart_tx_arena.h"
+
+// Mirrors the uart.cpp configuration: 1KB arena, 64-byte queue slots, 20-deep queue
+#define TEST_ARENA_SIZE 1024
+#define TEST_SLOT_SIZE 64
+#define TEST_QUEUE_DEPTH 20
+
+static uint8_t arena_mem[TEST_ARENA_SIZE];
+static uart_tx_arena_t arena;
+
+typedef struct {
+    char data[TEST_SLOT_SIZE];
+    size_t len;
+    int first;
+    uint8_t blocks;
+} test_item_t;
+
+void setUp(void) {
+    memset(arena_mem, 0, sizeof(arena_mem));
+    uart_tx_arena_init(&arena, arena_mem, sizeof(arena_mem));
+}
+
+void tearDown(void) {
+    // Clean up after each test
+}
+
+void test_arena_block_count(void) {
+    TEST_ASSERT_EQUAL_UINT8(16, arena.block_count);
+    TEST_ASSERT_EQUAL_UINT8(1, uart_tx_arena_blocks_for(1));
+    TEST_ASSERT_EQUAL_UINT8(1, uart_tx_arena_blocks_for(64));
+    TEST_ASSERT_EQUAL_UINT8(2, uart_tx_arena_blocks_for(65));
+    TEST_ASSERT_EQUAL_UINT8(4, uart_tx_arena_blocks_for(256));
+}
+
+void test_arena_alloc_is_contiguous(void) {
+    int a = uart_tx_arena_alloc(&arena, 100); // 2 blocks
+    int b = uart_tx_arena_alloc(&arena, 200); // 4 blocks
+    TEST_ASSERT_EQUAL_INT(0, a);
+    TEST_ASSERT_EQUAL_INT(2, b);
+    TEST_ASSERT_EQUAL_UINT8(6, arena.used_blocks);
+
+    // Freeing the first run leaves a 2-block hole that a 3-block request must skip
+    uart_tx_arena_free(&arena, a, 2);
+    int c = uart_tx_arena_alloc(&arena, 150);
+    TEST_ASSERT_EQUAL_INT(6, c);
+    int d = uart_tx_arena_alloc(&arena, 64);
+    TEST_ASSERT_EQUAL_INT(0, d);
+}
+
+void test_arena_exhaustion_and_recovery(void) {
+    int runs[4];
+    for (int i = 0; i < 4; i++) {
+        runs[i] = uart_tx_arena_alloc(&arena, 256);
+        TEST_ASSERT_TRUE(runs[i] >= 0);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, uart_tx_arena_alloc(&arena, 10));
+    TEST_ASSERT_EQUAL_INT(-1, uart_tx_arena_alloc(&arena, TEST_ARENA_SIZE + 1));
+
+    uart_tx_arena_free(&arena, runs[2], 4);
+    TEST_ASSERT_EQUAL_INT(runs[2], uart_tx_arena_alloc(&arena, 256));
+    TEST_ASSERT_EQUAL_UINT8(16, arena.peak_blocks);
+}
+
+// Producer/consumer run with three short polling commands per MXW macro write,
+// the mix the macro editor produces while polling is active. Every message must
+// reach the sink intact and the arena must never run dry at queue depth.
+void test_mixed_short_long_throughput(void) {
+    static test_item_t queue[TEST_QUEUE_DEPTH];
+    static char sink[TEST_ARENA_SIZE];
+    const int total_messages = 20000;
+    size_t head = 0, tail = 0, pending = 0;
+    uint32_t bytes = 0;
+    uint32_t long_count = 0;
+    int produced = 0;
+    int consumed = 0;
+    char msg[256];
+
+    int64_t start_us = esp_timer_get_time();
+    while (consumed < total_messages) {
+        // Fill the queue the way bursts of UI events and timers do
+        while (produced < total_messages && pending < TEST_QUEUE_DEPTH) {
+            test_item_t *item = &queue[head];
+            if ((produced % 4) == 3) {
+                int len = snprintf(msg, sizeof(msg), "MXW%02d,Macro %d,FA00014074000;MD2;PC050;EX0060000;AN1;SH01;SL05;VV;",
+                                   produced % 50, produced);
+                item->first = uart_tx_arena_alloc(&arena, (size_t)len + 3);
+                TEST_ASSERT_TRUE(item->first >= 0);
+                item->blocks = uart_tx_arena_blocks_for((size_t)len + 3);
+                memcpy(uart_tx_arena_ptr(&arena, item->first), msg, (size_t)len + 1);
+                item->len = (size_t)len;
+                long_count++;
+            } else {
+                int len = snprintf(item->data, sizeof(item->data), "FA%011d;", produced);
+                item->first = -1;
+                item->blocks = 0;
+                item->len = (size_t)len;
+            }
+            head = (head + 1) % TEST_QUEUE_DEPTH;
+            pending++;
+            produced++;
+        }
+
+        // Drain one item as the TX task would
+        test_item_t *item = &queue[tail];
+        if (item->first >= 0) {
+            const char *src = uart_tx_arena_ptr(&arena, item->first);
+            memcpy(sink, src, item->len);
+            TEST_ASSERT_EQUAL_MEMORY("MXW", sink, 3);
+            uart_tx_arena_free(&arena, item->first, item->blocks);
+        } else {
+            memcpy(sink, item->data, item->len);
+            TEST_ASSERT_EQUAL_MEMORY("FA", sink, 2);
+        }
+        bytes += item->len;
+        tail = (tail + 1) % TEST_QUEUE_DEPTH;
+        pending--;
+        consumed++;
+    }
+    int64_t elapsed_us = esp_timer_get_time() - start_us;
+
+    TEST_ASSERT_EQUAL_UINT8(0, arena.used_blocks);
+    TEST_ASSERT_EQUAL_UINT32(long_count, arena.alloc_count);
+    TEST_ASSERT_TRUE(arena.peak_blocks <= arena.block_count);
+
+    if (elapsed_us > 0) {
+        printf("Mixed TX: %d messages (%lu long), %lu bytes in %lld us -> %llu msg/s, %llu KB/s, peak %u/%u blocks\n",
+               total_messages, (unsigned long)long_count, (unsigned long)bytes, (long long)elapsed_us,
+               (unsigned long long)total_messages * 1000000ULL / (unsigned long long)elapsed_us,
+               (unsigned long long)bytes * 1000000ULL / 1024ULL / (unsigned long long)elapsed_us,
+               arena.peak_blocks, arena.block_count);
+    }
+}
+
+void app_main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_arena_block_count);
+    RUN_TEST(test_arena_alloc_is_contiguous);
+    RUN_TEST(test_arena_exhaustion_and_recovery);
+    RUN_TEST(test_mixed_short_long_throughput);
+
+    UNITY_END();
+}